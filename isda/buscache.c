@@ -23,6 +23,12 @@
 #define stricmp strcasecmp
 #endif
 
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
 /*---------------------------------------------------------------------------
  *                  MACROS used in this file.
  *---------------------------------------------------------------------------
@@ -55,11 +61,44 @@ typedef struct _THoliday
 {
     char         *name;   /* Upper case name associated with this entry */
     THolidayList *hl;     /* Holiday list */
+    TBoolean      fromFile; /* Loaded on first use of a file name */
     void         *next;
 } THoliday;
 
 
-THoliday *cache = NULL;
+static THoliday *cache = NULL;
+
+/* Entries loaded from file, which are evicted oldest first beyond the limit.
+ * Entries added explicitly stay until they are evicted by name. */
+static long nbFileEntries = 0;
+static long fileEntryLimit = JPMCDS_HOLIDAY_CACHE_LIMIT;
+
+/*
+ * The cache is read on every business day adjustment and written only when
+ * a calendar is loaded, so lookups share the lock and updates take it alone.
+ * An entry is fully built before it is linked in under the exclusive lock.
+ *
+ * The cache holds one reference to each holiday list and every lookup takes
+ * another under the lock, so an entry that is replaced or evicted is freed
+ * by whichever of the cache and its callers lets go of it last.
+ */
+#if defined(_WIN32)
+static SRWLOCK cacheLock = SRWLOCK_INIT;
+#define CACHE_READ_LOCK()       AcquireSRWLockShared(&cacheLock)
+#define CACHE_READ_UNLOCK()     ReleaseSRWLockShared(&cacheLock)
+#define CACHE_WRITE_LOCK()      AcquireSRWLockExclusive(&cacheLock)
+#define CACHE_WRITE_UNLOCK()    ReleaseSRWLockExclusive(&cacheLock)
+#define HOLIDAY_REF_INC(n)      InterlockedIncrement(n)
+#define HOLIDAY_REF_DEC(n)      InterlockedDecrement(n)
+#else
+static pthread_rwlock_t cacheLock = PTHREAD_RWLOCK_INITIALIZER;
+#define CACHE_READ_LOCK()       pthread_rwlock_rdlock(&cacheLock)
+#define CACHE_READ_UNLOCK()     pthread_rwlock_unlock(&cacheLock)
+#define CACHE_WRITE_LOCK()      pthread_rwlock_wrlock(&cacheLock)
+#define CACHE_WRITE_UNLOCK()    pthread_rwlock_unlock(&cacheLock)
+#define HOLIDAY_REF_INC(n)      __sync_add_and_fetch(n, 1)
+#define HOLIDAY_REF_DEC(n)      __sync_sub_and_fetch(n, 1)
+#endif
 
 
 /*
@@ -71,12 +110,25 @@ static int verifyHolidayList
 (THolidayList *hl /* (I/O) Holiday list */
 );
 
-/* Finds an entry associated with a name in the cache. */
+static int holidayListCompile
+(THolidayList *hl /* (I/O) Holiday list */
+);
+
+/* Finds an entry associated with a name in the cache. Caller holds the lock. */
 static THoliday *holidayFind(char *name);
 
+/* Adds NONE and NO_WEEKENDS to an empty cache. Caller holds the write lock. */
+static int holidayBuiltIns(void);
+
+/* Looks up the holiday list for a name under the read lock and references it. */
+static THolidayList *holidayLookup(char *name);
+
 /* Delete holiday calendar from cache. */
 static void holidayDelete(THoliday *hol);
 
+/* Evicts the oldest file entries beyond the limit. Caller holds the write lock. */
+static void holidayTrim(void);
+
 /* Create holiday calendar. */
 static THoliday* JpmcdsNewHoliday(THolidayList *hl, char *name);
 
@@ -116,7 +168,9 @@ void JpmcdsFreeHoliday(THoliday *holiday);
 ** This behaviour exactly duplicates the behaviour when using a holiday
 ** name as an input to any analytics function.
 **
-** Returns NULL on failure, a valid THolidayList pointer on success.
+** Returns NULL on failure, a valid THolidayList pointer on success. The
+** list is shared with the cache, so release it with JpmcdsHolidayListDelete
+** once done with it.
 ***************************************************************************
 */
 THolidayList* JpmcdsHolidayListFromCache
@@ -135,22 +189,46 @@ THolidayList* JpmcdsHolidayListFromCache
         goto done;
     }
 
-    /* Use holidayFind to find in the cache. Note that NONE and NO_WEEKENDS are always in the cache. */
-    hol = holidayFind (name);
-    if (hol != NULL)
-    {
-        hl = hol->hl;
-    }
-    else
+    /* Use holidayLookup to find in the cache. Note that NONE and NO_WEEKENDS are always in the cache. */
+    hl = holidayLookup (name);
+    if (hl == NULL)
     {
-        /* Not in the cache, so use JpmcdsHolidayListRead to read from file. */
-        hl = JpmcdsHolidayListRead (name);
-        if (hl == NULL)
+        THolidayList *fileHl;
+
+        /* Not in the cache, so use JpmcdsHolidayListRead to read from file.
+           The file is read outside the lock. */
+        fileHl = JpmcdsHolidayListRead (name);
+        if (fileHl == NULL)
             goto done;
 
-        /* Now add hl to the cache. This takes a shallow copy, but is
-           guaranteed to be destructive if the operation fails. */
-        if (JpmcdsHolidayListAddToCache (name, hl) != SUCCESS)
+        /* Another thread may have loaded the same name meanwhile, in which
+           case its entry wins and ours is discarded. */
+        CACHE_WRITE_LOCK();
+        hol = holidayFind (name);
+        if (hol != NULL)
+        {
+            hl = hol->hl;
+            HOLIDAY_REF_INC(&hl->nbRefs);
+        }
+        else
+        {
+            hol = JpmcdsNewHoliday (fileHl, name);
+            fileHl = NULL; /* Now owned by hol */
+            if (hol != NULL)
+            {
+                hol->fromFile = TRUE;
+                hol->next = cache;
+                cache = hol;
+                hl = hol->hl;
+                HOLIDAY_REF_INC(&hl->nbRefs);
+                ++nbFileEntries;
+                holidayTrim();
+            }
+        }
+        CACHE_WRITE_UNLOCK();
+
+        JpmcdsHolidayListDelete (fileHl);
+        if (hl == NULL)
             goto done;
     }
 
@@ -193,6 +271,15 @@ int JpmcdsHolidayListAddToCache
     if (hol == NULL)
         goto done;
 
+    CACHE_WRITE_LOCK();
+
+    /* The built-in calendars go in first so that they cannot be replaced. */
+    if (holidayBuiltIns() != SUCCESS)
+    {
+        CACHE_WRITE_UNLOCK();
+        goto done;
+    }
+
     /* If necessary get rid of the old entry with the same name. 
        Use hol->name since this has been capitalized. */
     oldHol = holidayFind(hol->name);
@@ -207,6 +294,7 @@ int JpmcdsHolidayListAddToCache
             if (strcmp(hol->name, "NONE") == 0 || strcmp (hol->name, "NO_WEEKENDS") == 0)
             {
                 JpmcdsErrMsg ("%s: Attempt to over-write standard holiday %s\n", routine, hol->name);
+                CACHE_WRITE_UNLOCK();
                 goto done;
             }
         }
@@ -220,6 +308,8 @@ int JpmcdsHolidayListAddToCache
     hol = NULL; /* Now owned by cache */
     status = SUCCESS;
 
+    CACHE_WRITE_UNLOCK();
+
 done:
     JpmcdsFreeHoliday (hol);
 
@@ -232,7 +322,8 @@ done:
 
 /*f
 ***************************************************************************
-** Empty holiday cache
+** Empty holiday cache. Holiday lists still held by callers of
+** JpmcdsHolidayListFromCache are freed when those callers release them.
 ***************************************************************************
 */
 void JpmcdsHolidayEmptyCache (void)
@@ -240,18 +331,163 @@ void JpmcdsHolidayEmptyCache (void)
     THoliday *node;
     THoliday *next;
 
-    if(cache != NULL)
+    CACHE_WRITE_LOCK();
+
+    node = cache;
+    while (node)
     {
-        node = cache;
         next = node->next;
-        while (node)
+        JpmcdsFreeHoliday(node);
+        node = next;
+    }
+    cache = NULL;
+    nbFileEntries = 0;
+
+    CACHE_WRITE_UNLOCK();
+}
+
+
+/*f
+***************************************************************************
+** Removes the entry associated with a name from the holiday cache, so the
+** next use of the name reads it from file again. NONE and NO_WEEKENDS
+** cannot be evicted. The holiday list is freed once the threads still
+** using it release it.
+***************************************************************************
+*/
+int JpmcdsHolidayEvictFromCache
+(char *name)   /* (I) Name associated with the holidays */
+{
+    static char routine[] = "JpmcdsHolidayEvictFromCache";
+    int         status    = FAILURE;
+
+    THoliday   *hol;
+
+    if (name == NULL)
+    {
+        JpmcdsErrMsg ("%s: NULL inputs.\n", routine);
+        goto done;
+    }
+
+    if (stricmp(name, "NONE") == 0 || stricmp(name, "NO_WEEKENDS") == 0)
+    {
+        JpmcdsErrMsg ("%s: Attempt to evict standard holiday %s\n", routine, name);
+        goto done;
+    }
+
+    CACHE_WRITE_LOCK();
+    hol = holidayFind(name);
+    if (hol != NULL)
+    {
+        holidayDelete(hol);
+        status = SUCCESS;
+    }
+    CACHE_WRITE_UNLOCK();
+
+    if (status != SUCCESS)
+        JpmcdsErrMsg ("%s: %s is not in the cache.\n", routine, name);
+
+done:
+
+    return status;
+}
+
+
+/*f
+***************************************************************************
+** Sets how many holiday lists loaded from file the cache keeps, evicting
+** the oldest beyond that. Zero keeps them all and a negative limit only
+** reads it. Returns the previous limit.
+***************************************************************************
+*/
+long JpmcdsHolidaySetCacheLimit
+(long maxFileEntries)   /* (I) Limit on entries loaded from file */
+{
+    long previous;
+
+    CACHE_WRITE_LOCK();
+    previous = fileEntryLimit;
+    if (maxFileEntries >= 0)
+    {
+        fileEntryLimit = maxFileEntries;
+        holidayTrim();
+    }
+    CACHE_WRITE_UNLOCK();
+
+    return previous;
+}
+
+
+/*
+***************************************************************************
+** Looks up the holiday list associated with a name and takes a reference
+** to it. The built-in calendars are added the first time the cache is used.
+***************************************************************************
+*/
+static THolidayList *holidayLookup(char *name)
+{
+    THolidayList *hl = NULL;
+    THoliday     *hol;
+    TBoolean      empty;
+
+    CACHE_READ_LOCK();
+    empty = (cache == NULL);
+    hol = holidayFind(name);
+    if (hol != NULL)
+    {
+        hl = hol->hl;
+        HOLIDAY_REF_INC(&hl->nbRefs);
+    }
+    CACHE_READ_UNLOCK();
+
+    if (empty)
+    {
+        CACHE_WRITE_LOCK();
+        if (holidayBuiltIns() == SUCCESS)
         {
-            JpmcdsFreeHoliday(node);
-            node = next;
-            if(node) next = node->next;
+            hol = holidayFind(name);
+            if (hol != NULL)
+            {
+                hl = hol->hl;
+                HOLIDAY_REF_INC(&hl->nbRefs);
+            }
         }
-        cache = NULL;
+        CACHE_WRITE_UNLOCK();
+    }
+
+    return hl;
+}
+
+
+/*
+***************************************************************************
+** Ensures that the built-in calendars are present in the cache.
+***************************************************************************
+*/
+static int holidayBuiltIns(void)
+{
+    THoliday *none;
+    THoliday *noWeekends;
+
+    if (cache != NULL)
+        return SUCCESS;
+
+    none = JpmcdsNewHoliday(JpmcdsHolidayListNewGeneral(NULL, JPMCDS_WEEKEND_SATURDAY | JPMCDS_WEEKEND_SUNDAY), "NONE");
+    if (none == NULL)
+        return FAILURE;
+
+    noWeekends = JpmcdsNewHoliday(JpmcdsHolidayListNewGeneral(NULL, JPMCDS_WEEKEND_NO_WEEKENDS), "NO_WEEKENDS");
+    if (noWeekends == NULL)
+    {
+        JpmcdsFreeHoliday(none);
+        return FAILURE;
     }
+
+    none->next = noWeekends;
+    noWeekends->next = NULL;
+    cache = none;
+
+    return SUCCESS;
 }
 
 
@@ -265,25 +501,6 @@ static THoliday *holidayFind(char *name)
 {
     THoliday *hol = NULL;
 
-    /* ensure that built-in calendars are present in the cache */
-    if (cache == NULL)
-    {
-        THoliday *h;
-
-        h = JpmcdsNewHoliday(JpmcdsHolidayListNewGeneral(NULL, JPMCDS_WEEKEND_SATURDAY | JPMCDS_WEEKEND_SUNDAY), "NONE");
-        if (h == NULL)
-            return NULL;
-
-        cache = h;
-        
-        h = JpmcdsNewHoliday(JpmcdsHolidayListNewGeneral(NULL, JPMCDS_WEEKEND_NO_WEEKENDS), "NO_WEEKENDS");
-        if (h == NULL)
-            return NULL;
-        
-        cache->next = h;
-        h->next = NULL;
-    }
-    
     hol = cache;
     if (name != NULL)
     {
@@ -303,12 +520,43 @@ static THoliday *holidayFind(char *name)
 
 /*
 ***************************************************************************
-** Deletes an entry in the holiday cache.
+** Evicts the oldest entries loaded from file until no more than the limit
+** remain. New entries go to the front of the cache, so the oldest is the
+** last one.
+***************************************************************************
+*/
+static void holidayTrim(void)
+{
+    while (fileEntryLimit > 0 && nbFileEntries > fileEntryLimit)
+    {
+        THoliday *node;
+        THoliday *oldest = NULL;
+
+        for (node = cache; node != NULL; node = node->next)
+        {
+            if (node->fromFile)
+                oldest = node;
+        }
+        if (oldest == NULL)
+            break;
+
+        holidayDelete(oldest);
+    }
+}
+
+
+/*
+***************************************************************************
+** Deletes an entry in the holiday cache. Its holiday list is freed when
+** the last thread using it releases it.
 ***************************************************************************
 */
 static void holidayDelete(THoliday *hol)
 {
     THoliday *node;
+
+    if (hol->fromFile)
+        --nbFileEntries;
     
     /* remove node from cache list */
     if (cache == hol)
@@ -325,7 +573,6 @@ static void holidayDelete(THoliday *hol)
         }
     }
 
-    /* Free memory. */
     JpmcdsFreeHoliday(hol);
 }
 
@@ -362,6 +609,7 @@ static THoliday* JpmcdsNewHoliday
     if (hol->name == NULL)
         goto done;
 
+    hol->fromFile = FALSE;
     hol->next = NULL;
     status = SUCCESS;
 
@@ -450,11 +698,16 @@ THolidayList* JpmcdsHolidayListNewGeneral
     /* fill in holiday list */
     hl->dateList     = dl;
     hl->weekends     = weekends;
+    hl->busDays      = NULL;
+    hl->nbRefs       = 1;
     dl               = NULL; /* Now owned by hl */
 
     if (verifyHolidayList (hl) != SUCCESS)
         goto done;
 
+    if (holidayListCompile (hl) != SUCCESS)
+        goto done;
+
     status = SUCCESS;
 
 done:
@@ -474,15 +727,22 @@ done:
 
 /*
 ***************************************************************************
-** Deletes a holiday list structure.
+** Deletes a holiday list structure. A list shared with the holiday cache
+** is only freed when the cache and every caller have released it.
 ***************************************************************************
 */
 void JpmcdsHolidayListDelete
 (THolidayList *hl)  /* (I) Holiday list to delete */
 {
-    if (hl != NULL)
+    if (hl != NULL && HOLIDAY_REF_DEC(&hl->nbRefs) == 0)
     {
         JpmcdsFreeDateList (hl->dateList);
+        if (hl->busDays != NULL)
+        {
+            FREE(hl->busDays->isBusinessDay);
+            FREE(hl->busDays->nbBefore);
+            FREE(hl->busDays);
+        }
         FREE(hl);
     }
 }
@@ -724,3 +984,100 @@ done:
 
     return status;
 }
+
+
+/*
+***************************************************************************
+** Compiles the business day calendar of a verified holiday list. It covers
+** the years JPMCDS_BUSINESS_DAYS_FIRST_YEAR to JPMCDS_BUSINESS_DAYS_LAST_YEAR
+** and every holiday, so there are no holidays after the dates it covers.
+***************************************************************************
+*/
+static int holidayListCompile
+(THolidayList *hl /* (I/O) Holiday list */
+)
+{
+    static char routine[] = "holidayListCompile";
+    int         status    = FAILURE;
+
+    TBusinessDays *bd = NULL;
+    TDateList  *dl = hl->dateList;
+    TDate       firstDate;
+    TDate       lastDate;
+    long        idx;
+    long        w;
+
+    hl->busDays = NULL;
+
+    /* nothing to compile when every day is a weekend */
+    if ((hl->weekends & 0x7f) == 0x7f)
+        return SUCCESS;
+
+    firstDate = JpmcdsDate (JPMCDS_BUSINESS_DAYS_FIRST_YEAR, 1, 1);
+    lastDate  = JpmcdsDate (JPMCDS_BUSINESS_DAYS_LAST_YEAR, 12, 31);
+    if (firstDate == FAILURE || lastDate == FAILURE)
+        goto done;
+
+    if (dl->fNumItems > 0)
+    {
+        firstDate = MIN(firstDate, dl->fArray[0]);
+        lastDate  = MAX(lastDate, dl->fArray[dl->fNumItems - 1]);
+    }
+
+    bd = NEW(TBusinessDays);
+    if (bd == NULL)
+        goto done;
+
+    bd->startDate     = firstDate;
+    bd->nbWords       = (lastDate - firstDate) / 64 + 1;
+    bd->isBusinessDay = NEW_ARRAY(uint64_t, bd->nbWords);
+    bd->nbBefore      = NEW_ARRAY(long, bd->nbWords + 1);
+    if (bd->isBusinessDay == NULL || bd->nbBefore == NULL)
+        goto done;
+
+    for (w = 0; w < bd->nbWords; ++w)
+    {
+        uint64_t word = 0;
+        for (idx = 0; idx < 64; ++idx)
+        {
+            if (JPMCDS_IS_WEEKDAY(firstDate + 64 * w + idx, hl->weekends))
+                word |= (uint64_t)1 << idx;
+        }
+        bd->isBusinessDay[w] = word;
+    }
+
+    /* holidays at weekends were removed by verifyHolidayList */
+    for (idx = 0; idx < dl->fNumItems; ++idx)
+    {
+        long offset = dl->fArray[idx] - firstDate;
+        bd->isBusinessDay[offset / 64] &= ~((uint64_t)1 << (offset % 64));
+    }
+
+    bd->nbBefore[0] = 0;
+    for (w = 0; w < bd->nbWords; ++w)
+    {
+        uint64_t word  = bd->isBusinessDay[w];
+        long     count = 0;
+        for (; word != 0; word &= word - 1)
+            ++count;
+        bd->nbBefore[w + 1] = bd->nbBefore[w] + count;
+    }
+
+    hl->busDays = bd;
+    bd = NULL; /* Now owned by hl */
+    status = SUCCESS;
+
+done:
+
+    if (bd != NULL)
+    {
+        FREE(bd->isBusinessDay);
+        FREE(bd->nbBefore);
+        FREE(bd);
+    }
+
+    if (status != SUCCESS)
+        JpmcdsErrMsg ("%s: Failed.\n", routine);
+
+    return status;
+}
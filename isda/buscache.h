@@ -13,6 +13,7 @@
 
 #include "cgeneral.h"
 #include "cdate.h"
+#include <stdint.h>
 
 #ifdef __cplusplus
 extern "C"
@@ -41,6 +42,34 @@ extern "C"
 #define JPMCDS_WEEKEND_NO_WEEKENDS 0x0000
 #define JPMCDS_WEEKEND_STANDARD    (JPMCDS_WEEKEND_SATURDAY | JPMCDS_WEEKEND_SUNDAY)
 
+/*
+** Default number of holiday lists loaded from file that the cache keeps.
+** Holiday lists added explicitly do not count towards it.
+*/
+#define JPMCDS_HOLIDAY_CACHE_LIMIT 64
+
+/*
+** Dates the compiled business day calendar of a holiday list covers in
+** addition to the holidays themselves. Other dates use the date list.
+*/
+#define JPMCDS_BUSINESS_DAYS_FIRST_YEAR 1950
+#define JPMCDS_BUSINESS_DAYS_LAST_YEAR  2150
+
+/*t
+***************************************************************************
+** Business day calendar compiled from a holiday list. Bit i of word w is
+** set when startDate + 64w + i is a business day, and nbBefore[w] counts
+** the business days before word w, so tests and offsets need no search.
+***************************************************************************
+*/
+typedef struct _TBusinessDays
+{
+    TDate       startDate;    /* first date covered */
+    long        nbWords;      /* 64 dates per word */
+    uint64_t   *isBusinessDay;/* nbWords words */
+    long       *nbBefore;     /* nbWords + 1 counts */
+} TBusinessDays;
+
 /*t
 ***************************************************************************
 ** Contains holiday dates and a series of flags that indicate that
@@ -51,6 +80,8 @@ typedef struct _THolidayList
 {
     TDateList  *dateList;     /* date list of holidays */
     long        weekends;     /* weekends */
+    TBusinessDays *busDays;   /* compiled from the above, can be NULL */
+    long        nbRefs;       /* freed when the last holder deletes it */
 } THolidayList;
 
 
@@ -106,7 +137,9 @@ typedef struct _THolidayCache THolidayCache;
 ** This behaviour exactly duplicates the behaviour when using a holiday
 ** name as an input to any analytics function.
 **
-** Returns NULL on failure, a valid THolidayList pointer on success.
+** Returns NULL on failure, a valid THolidayList pointer on success. The
+** list is shared with the cache, so release it with JpmcdsHolidayListDelete
+** once done with it.
 ***************************************************************************
 */
 THolidayList * JpmcdsHolidayListFromCache
@@ -126,12 +159,34 @@ int JpmcdsHolidayListAddToCache
 
 /*f
 ***************************************************************************
-** Empty holiday cache
+** Empty holiday cache. Holiday lists still held by callers of
+** JpmcdsHolidayListFromCache are freed when those callers release them.
 ***************************************************************************
 */
 void JpmcdsHolidayEmptyCache (void);
 
 
+/*f
+***************************************************************************
+** Removes the entry associated with a name from the holiday cache. The
+** holiday list is freed once the threads still using it release it.
+***************************************************************************
+*/
+int JpmcdsHolidayEvictFromCache
+(char *name);   /* (I) Name associated with the holidays */
+
+
+/*f
+***************************************************************************
+** Sets how many holiday lists loaded from file the cache keeps, evicting
+** the oldest beyond that. Zero keeps them all and a negative limit only
+** reads it. Returns the previous limit.
+***************************************************************************
+*/
+long JpmcdsHolidaySetCacheLimit
+(long maxFileEntries);   /* (I) Limit on entries loaded from file */
+
+
 /*
 ***************************************************************************
 ** 2. Holiday list manipulation functions. These are functions that
@@ -148,6 +203,9 @@ void JpmcdsHolidayEmptyCache (void);
 ** The date list can be NULL, in which case the resulting date list in the
 ** holiday structure will be a date list with no dates, e.g.
 **      hl->dateList->fNumItems = 0;
+**
+** The business day calendar is compiled here, so the date list and
+** weekends must not be changed afterwards.
 ***************************************************************************
 */
 THolidayList* JpmcdsHolidayListNewGeneral
@@ -158,7 +216,8 @@ THolidayList* JpmcdsHolidayListNewGeneral
 
 /*f
 ***************************************************************************
-** Deletes a holiday list structure.
+** Deletes a holiday list structure. A list shared with the holiday cache
+** is only freed when the cache and every caller have released it.
 ***************************************************************************
 */
 void JpmcdsHolidayListDelete
@@ -120,6 +120,37 @@ static int stringToDate(
     long  *date                 /* (O) date              */
 );
 
+/*
+** Lookups in the compiled business day calendar. Those returning TBoolean
+** return FALSE when it does not cover the dates they need, in which case
+** the caller uses the holiday date list instead.
+*/
+static TBoolean busDaysIsBusinessDay (
+    TBusinessDays *bd,          /* (I) compiled calendar */
+    TDate          date,        /* (I) date to test */
+    TBoolean      *isBusinessDay/* (O) TRUE if a business day */
+);
+
+static TBoolean busDaysNext (
+    TBusinessDays *bd,          /* (I) compiled calendar */
+    TDate          date,        /* (I) starting date */
+    long           direction,   /* (I) +1=forwards, -1=backwards */
+    TDate         *nextDate     /* (O) first business day on or after (before) */
+);
+
+static TBoolean busDaysCount (
+    TBusinessDays *bd,          /* (I) compiled calendar */
+    TDate          date,        /* (I) date */
+    long          *count        /* (O) business days before date */
+);
+
+static TBoolean busDaysSelect (
+    TBusinessDays *bd,          /* (I) compiled calendar */
+    long           count,       /* (I) business days before the result */
+    TDate          nearDate,    /* (I) date close to the result */
+    TDate         *date         /* (O) business day */
+);
+
 /*---------------------------------------------------------------------------
  *                              Static Data.
  *---------------------------------------------------------------------------
@@ -209,6 +240,7 @@ int  JpmcdsDateFromBusDaysOffset
     status = SUCCESS;
 
 done:
+    JpmcdsHolidayListDelete (hl);
     if (status != SUCCESS)
         JpmcdsErrMsg ("%s: Failed.\n", routine);
 
@@ -253,6 +285,7 @@ int  JpmcdsBusinessDay
     status = SUCCESS;
 
 done:
+    JpmcdsHolidayListDelete (hl);
 
     if (status != SUCCESS)
         JpmcdsErrMsg ("%s: Failed.\n", routine);
@@ -329,6 +362,7 @@ int  JpmcdsIsBusinessDay
     status = SUCCESS;
 
 done:
+    JpmcdsHolidayListDelete (hl);
 
     if (status != SUCCESS)
         JpmcdsErrMsg ("%s: Failed.\n", routine);
@@ -351,7 +385,7 @@ int JpmcdsDateToBusinessEOM
     static char   routine[] = "JpmcdsDateToBusinessEOM";
     int           status = FAILURE;
 
-    THolidayList *hl;
+    THolidayList *hl = NULL;
 
     hl = JpmcdsHolidayListFromCache (name);
     if (hl == NULL)
@@ -363,6 +397,7 @@ int JpmcdsDateToBusinessEOM
     status = SUCCESS;
 
 done:
+    JpmcdsHolidayListDelete (hl);
 
     if (status != SUCCESS)
         JpmcdsErrMsgFailure(routine);
@@ -404,6 +439,52 @@ done:
 }
 
 
+/*
+***************************************************************************
+** Adds a holiday cache entry from an array of dates, removing old one if
+** it exists.
+***************************************************************************
+*/
+EXPORT int JpmcdsHolidayLoadFromDates
+(char  *name,                        /* (I) name associated with holidays */
+ int    nbDates,                     /* (I) number of holidays */
+ TDate *dates,                       /* (I) holidays */
+ long   weekends)                    /* (I) use JPMCDS_WEEKEND_... */
+{
+    static char routine[] = "JpmcdsHolidayLoadFromDates";
+    int         status    = FAILURE;
+
+    THolidayList *hl = NULL;
+    TDateList    *dl = NULL;
+
+    if (nbDates > 0)
+    {
+        dl = JpmcdsNewDateListFromDates (dates, nbDates);
+        if (dl == NULL)
+            goto done;
+    }
+
+    /* NULL gives an empty date list */
+    hl = JpmcdsHolidayListNewGeneral (dl, weekends);
+    if (hl == NULL)
+        goto done;
+
+    if (JpmcdsHolidayListAddToCache (name, hl) != SUCCESS)
+        goto done;
+
+    status = SUCCESS;
+
+done:
+
+    JpmcdsFreeDateList (dl);
+
+    if (status != SUCCESS)
+        JpmcdsErrMsg ("%s: Failed.\n", routine);
+
+    return status;
+}
+
+
 /*
 ***************************************************************************
 ** 2. The new interface. These are functions that use a holiday list
@@ -435,6 +516,10 @@ int  JpmcdsHolidayListIsBusinessDay
         return FAILURE;
     }
 
+    if (hl->busDays != NULL &&
+        busDaysIsBusinessDay (hl->busDays, date, isBusinessDay))
+        return SUCCESS;
+
     /* First check for week-ends */
     if (JPMCDS_IS_WEEKEND (date, hl->weekends))
     {
@@ -486,6 +571,15 @@ int  JpmcdsHolidayListIsHoliday
         return SUCCESS;
     }
 
+    /* Holidays at weekends have been removed from the list, so a holiday
+       is a weekday which is not a business day. */
+    if (hl->busDays != NULL &&
+        busDaysIsBusinessDay (hl->busDays, date, isHoliday))
+    {
+        *isHoliday = JPMCDS_IS_WEEKDAY (date, hl->weekends) && !*isHoliday;
+        return SUCCESS;
+    }
+
     dates = hl->dateList->fArray ;
     if (dates == NULL)
     {
@@ -755,6 +849,10 @@ static int getNextBusDate
     TDate                * holArray = hl->dateList->fArray;
     TDate                  curDate = startDate;
 
+    if (hl->busDays != NULL &&
+        busDaysNext (hl->busDays, startDate, direction, nextDate))
+        return SUCCESS;
+
     if (IS_EMPTY_DATELIST(hl->dateList))
     {
         doneSearchingList = TRUE;
@@ -892,6 +990,26 @@ int  JpmcdsHolidayListBusinessDaysDiff
     if (fromDate == toDate)
         return SUCCESS;
 
+    /*
+    ** With the compiled calendar the result is the difference of two counts
+    ** of business days, over [FROM+1,TO] or [TO,FROM-1].
+    */
+    if (hl->busDays != NULL)
+    {
+        long fromCount;
+        long toCount;
+
+        if (toDate > fromDate ?
+            busDaysCount (hl->busDays, fromDate + 1, &fromCount) &&
+            busDaysCount (hl->busDays, toDate + 1, &toCount) :
+            busDaysCount (hl->busDays, fromDate, &fromCount) &&
+            busDaysCount (hl->busDays, toDate, &toCount))
+        {
+            *result = toCount - fromCount;
+            return SUCCESS;
+        }
+    }
+
     /* Set the direction. */
     if (toDate < fromDate)
     {
@@ -1012,6 +1130,25 @@ int  JpmcdsHolidayListAddBusinessDays
         goto done;
     }
 
+    /*
+    ** With the compiled calendar the result is the business day with the
+    ** right count of business days before it.
+    */
+    if (hl->busDays != NULL && numBusDays != 0)
+    {
+        long count;
+
+        if (busDaysCount (hl->busDays, numBusDays > 0 ? fromDate + 1 : fromDate, &count) &&
+            busDaysSelect (hl->busDays,
+                           count + numBusDays - (numBusDays > 0 ? 1 : 0),
+                           fromDate,
+                           resultDate))
+        {
+            status = SUCCESS;
+            goto done;
+        }
+    }
+
     /*
     ** Get the number of business days per week. In-line for speed.
     */
@@ -1525,3 +1662,187 @@ done:
 
     return status;
 }
+
+
+/*---------------------------------------------------------------------------
+ * Start of private functions using the compiled business day calendar.
+ *---------------------------------------------------------------------------
+ */
+
+/* Number of bits set */
+static int bitCount (uint64_t x)
+{
+#if defined(__GNUC__)
+    return __builtin_popcountll (x);
+#else
+    x = x - ((x >> 1) & 0x5555555555555555ULL);
+    x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+    x = (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+    return (int)((x * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+/* Index of the lowest bit set, x must not be zero */
+static int lowestBit (uint64_t x)
+{
+#if defined(__GNUC__)
+    return __builtin_ctzll (x);
+#else
+    return bitCount ((x & (~x + 1)) - 1);
+#endif
+}
+
+/* Index of the highest bit set, x must not be zero */
+static int highestBit (uint64_t x)
+{
+#if defined(__GNUC__)
+    return 63 - __builtin_clzll (x);
+#else
+    x |= x >> 1;
+    x |= x >> 2;
+    x |= x >> 4;
+    x |= x >> 8;
+    x |= x >> 16;
+    x |= x >> 32;
+    return bitCount (x) - 1;
+#endif
+}
+
+
+/*
+***************************************************************************
+** Tests one bit of the compiled calendar.
+***************************************************************************
+*/
+static TBoolean busDaysIsBusinessDay (
+    TBusinessDays *bd,          /* (I) compiled calendar */
+    TDate          date,        /* (I) date to test */
+    TBoolean      *isBusinessDay/* (O) TRUE if a business day */
+)
+{
+    long offset = date - bd->startDate;
+
+    if (offset < 0 || offset >= 64 * bd->nbWords)
+        return FALSE;
+
+    *isBusinessDay = (TBoolean)((bd->isBusinessDay[offset / 64] >> (offset % 64)) & 1);
+    return TRUE;
+}
+
+
+/*
+***************************************************************************
+** Finds the first business day on or after (before) a date by masking the
+** bits of its word, and then moving a word at a time.
+***************************************************************************
+*/
+static TBoolean busDaysNext (
+    TBusinessDays *bd,          /* (I) compiled calendar */
+    TDate          date,        /* (I) starting date */
+    long           direction,   /* (I) +1=forwards, -1=backwards */
+    TDate         *nextDate     /* (O) first business day on or after (before) */
+)
+{
+    long     offset = date - bd->startDate;
+    long     w;
+    int      bit;
+    uint64_t word;
+
+    if (offset < 0 || offset >= 64 * bd->nbWords)
+        return FALSE;
+
+    w   = offset / 64;
+    bit = (int)(offset % 64);
+
+    if (direction > 0)
+    {
+        word = bd->isBusinessDay[w] & (~(uint64_t)0 << bit);
+        while (word == 0)
+        {
+            if (++w >= bd->nbWords)
+                return FALSE;
+            word = bd->isBusinessDay[w];
+        }
+        *nextDate = bd->startDate + 64 * w + lowestBit (word);
+    }
+    else
+    {
+        word = bd->isBusinessDay[w] & (~(uint64_t)0 >> (63 - bit));
+        while (word == 0)
+        {
+            if (--w < 0)
+                return FALSE;
+            word = bd->isBusinessDay[w];
+        }
+        *nextDate = bd->startDate + 64 * w + highestBit (word);
+    }
+
+    return TRUE;
+}
+
+
+/*
+***************************************************************************
+** Counts the business days from the start of the compiled calendar up to
+** but excluding a date, which may be the day after the last date covered.
+***************************************************************************
+*/
+static TBoolean busDaysCount (
+    TBusinessDays *bd,          /* (I) compiled calendar */
+    TDate          date,        /* (I) date */
+    long          *count        /* (O) business days before date */
+)
+{
+    long offset = date - bd->startDate;
+    long w;
+    int  bit;
+
+    if (offset < 0 || offset > 64 * bd->nbWords)
+        return FALSE;
+
+    w   = offset / 64;
+    bit = (int)(offset % 64);
+
+    *count = bd->nbBefore[w];
+    if (bit > 0)
+        *count += bitCount (bd->isBusinessDay[w] & ((((uint64_t)1) << bit) - 1));
+
+    return TRUE;
+}
+
+
+/*
+***************************************************************************
+** Finds the business day with a given count of business days before it.
+** The search for its word starts from the word of nearDate, so it only
+** moves a word or so for the offsets used in schedules.
+***************************************************************************
+*/
+static TBoolean busDaysSelect (
+    TBusinessDays *bd,          /* (I) compiled calendar */
+    long           count,       /* (I) business days before the result */
+    TDate          nearDate,    /* (I) date close to the result */
+    TDate         *date         /* (O) business day */
+)
+{
+    long     w = (nearDate - bd->startDate) / 64;
+    long     i;
+    uint64_t word;
+
+    if (count < 0 || count >= bd->nbBefore[bd->nbWords])
+        return FALSE;
+
+    w = MAX(0, MIN(w, bd->nbWords - 1));
+    while (bd->nbBefore[w + 1] <= count)
+        ++w;
+    while (bd->nbBefore[w] > count)
+        --w;
+
+    /* clear the business days of the word which come before the result */
+    word = bd->isBusinessDay[w];
+    for (i = bd->nbBefore[w]; i < count; ++i)
+        word &= word - 1;
+
+    *date = bd->startDate + 64 * w + lowestBit (word);
+    return TRUE;
+}
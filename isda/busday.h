@@ -135,6 +135,20 @@ EXPORT int JpmcdsHolidayLoadFromDisk
  char  *filename);                   /* (I) filename to load */
 
 
+/*f
+***************************************************************************
+** Adds a holiday cache entry from an array of dates in increasing order,
+** removing old one if it exists. Business day functions given the name
+** then never read a holiday file.
+***************************************************************************
+*/
+EXPORT int JpmcdsHolidayLoadFromDates
+(char  *name,                        /* (I) name associated with holidays */
+ int    nbDates,                     /* (I) number of holidays */
+ TDate *dates,                       /* (I) holidays */
+ long   weekends);                   /* (I) use JPMCDS_WEEKEND_... */
+
+
 /*
 ***************************************************************************
 ** 2. The new interface. These are functions that use a holiday list
@@ -370,6 +370,368 @@ EXPORT int JpmcdsCdsPrice
 }
 
 
+/*
+***************************************************************************
+** Makes a vanilla CDS for repeated pricing with JpmcdsCdsTradePrice.
+***************************************************************************
+*/
+EXPORT TCdsTrade* JpmcdsCdsTradeMake
+(TDate             today,
+ TDate             valueDate,
+ TDate             stepinDate,
+ TDate             startDate,
+ TDate             endDate,
+ double            couponRate,
+ TBoolean          payAccOnDefault,
+ TDateInterval    *dateInterval,
+ TStubMethod      *stubType,
+ long              paymentDcc,
+ long              badDayConv,
+ char             *calendar)
+{
+    static char routine[] = "JpmcdsCdsTradeMake";
+    int         status    = FAILURE;
+
+    TCdsTrade  *trade = NULL;
+    TBoolean    protectStart = TRUE;
+
+    REQUIRE(stepinDate >= today);
+
+    trade = NEW(TCdsTrade);
+    if (trade == NULL)
+        goto done;
+
+    trade->today         = today;
+    trade->valueDate     = valueDate;
+    trade->stepinDate    = stepinDate;
+    trade->fl            = NULL;
+    trade->cl            = NULL;
+    trade->nbDiscDates   = 0;
+    trade->nbSpreadDates = 0;
+    trade->curveDates    = NULL;
+    JpmcdsLegPVCacheInit(&trade->flCache, 0);
+    JpmcdsLegPVCacheInit(&trade->clCache, 0);
+
+    trade->fl = JpmcdsCdsFeeLegMake (startDate, endDate, payAccOnDefault,
+                                     dateInterval, stubType, 1.0, /* notional */
+                                     couponRate, paymentDcc, badDayConv,
+                                     calendar, protectStart);
+    if (trade->fl == NULL)
+        goto done;
+
+    if (MAX(stepinDate, startDate) <= endDate) 
+    {
+        trade->cl = JpmcdsCdsContingentLegMake (MAX(stepinDate, startDate),
+                                                endDate,
+                                                1.0, /* notional */
+                                                protectStart);
+        if (trade->cl == NULL)
+            goto done;
+    }
+
+    status = SUCCESS;
+
+ done:
+
+    if (status != SUCCESS)
+    {
+        JpmcdsErrMsgFailure (routine);
+        JpmcdsCdsTradeFree (trade);
+        trade = NULL;
+    }
+
+    return trade;
+}
+
+
+/*
+***************************************************************************
+** Checks whether the timelines of a trade were built from curves with the
+** same dates as the given curves.
+***************************************************************************
+*/
+static TBoolean cdsTradeSameCurveDates
+(TCdsTrade *trade,
+ TCurve    *discCurve,
+ TCurve    *spreadCurve)
+{
+    int i;
+
+    if (trade->curveDates == NULL ||
+        trade->nbDiscDates != discCurve->fNumItems ||
+        trade->nbSpreadDates != spreadCurve->fNumItems)
+        return FALSE;
+
+    for (i = 0; i < trade->nbDiscDates; ++i)
+    {
+        if (trade->curveDates[i] != discCurve->fArray[i].fDate)
+            return FALSE;
+    }
+    for (i = 0; i < trade->nbSpreadDates; ++i)
+    {
+        if (trade->curveDates[trade->nbDiscDates + i] != spreadCurve->fArray[i].fDate)
+            return FALSE;
+    }
+    return TRUE;
+}
+
+
+/*
+***************************************************************************
+** Computes the price for a vanilla CDS made by JpmcdsCdsTradeMake.
+***************************************************************************
+*/
+EXPORT int JpmcdsCdsTradePrice
+(TCdsTrade        *trade,
+ TCurve           *discCurve,
+ TCurve           *spreadCurve,
+ double            recoveryRate,
+ TBoolean          isPriceClean,
+ double           *price)
+{
+    static char routine[] = "JpmcdsCdsTradePrice";
+    int         status    = FAILURE;
+
+    REQUIRE(price != NULL);
+
+    if (JpmcdsCdsTradePriceAll (trade,
+                                discCurve,
+                                spreadCurve,
+                                recoveryRate,
+                                NULL,
+                                NULL,
+                                NULL,
+                                isPriceClean ? NULL : price,
+                                isPriceClean ? price : NULL) != SUCCESS)
+        goto done;
+
+    status = SUCCESS;
+
+ done:
+
+    if (status != SUCCESS)
+        JpmcdsErrMsgFailure (routine);
+
+    return status;
+}
+
+
+/*
+***************************************************************************
+** Computes the dirty and clean prices, accrued interest and leg values for
+** a vanilla CDS made by JpmcdsCdsTradeMake.
+**
+** The fee leg is valued dirty once, and the clean price follows by taking
+** off the accrued interest exactly as JpmcdsFeeLegPV does.
+**
+** The risky timelines only depend on the dates of the curves, so they are
+** rebuilt only when those dates change.
+***************************************************************************
+*/
+EXPORT int JpmcdsCdsTradePriceAll
+(TCdsTrade        *trade,
+ TCurve           *discCurve,
+ TCurve           *spreadCurve,
+ double            recoveryRate,
+ double           *feeLegPV,
+ double           *contingentLegPV,
+ double           *accrued,
+ double           *dirtyPrice,
+ double           *cleanPrice)
+{
+    static char routine[] = "JpmcdsCdsTradePriceAll";
+    int         status    = FAILURE;
+
+    double      myFeeLegPV = 0;
+    double      myContingentLegPV = 0;
+    double      ai = 0;
+    int         i;
+
+    REQUIRE(trade != NULL);
+    REQUIRE(discCurve != NULL);
+    REQUIRE(spreadCurve != NULL);
+
+    if (!cdsTradeSameCurveDates (trade, discCurve, spreadCurve))
+    {
+        JpmcdsLegPVCacheClear(&trade->flCache);
+        JpmcdsLegPVCacheClear(&trade->clCache);
+        JpmcdsLegPVCacheInit(&trade->flCache, 0);
+        JpmcdsLegPVCacheInit(&trade->clCache, 0);
+
+        FREE(trade->curveDates);
+        trade->nbDiscDates   = 0;
+        trade->nbSpreadDates = 0;
+        trade->curveDates    = NEW_ARRAY(TDate, discCurve->fNumItems +
+                                                spreadCurve->fNumItems);
+        if (trade->curveDates == NULL)
+            goto done;
+
+        for (i = 0; i < discCurve->fNumItems; ++i)
+            trade->curveDates[i] = discCurve->fArray[i].fDate;
+        for (i = 0; i < spreadCurve->fNumItems; ++i)
+            trade->curveDates[discCurve->fNumItems + i] = spreadCurve->fArray[i].fDate;
+        trade->nbDiscDates   = discCurve->fNumItems;
+        trade->nbSpreadDates = spreadCurve->fNumItems;
+    }
+
+    if (JpmcdsFeeLegPVCached (trade->fl,
+                              trade->today,
+                              trade->stepinDate,
+                              trade->valueDate,
+                              discCurve,
+                              spreadCurve,
+                              FALSE,
+                              &trade->flCache,
+                              -1,
+                              &myFeeLegPV,
+                              NULL) != SUCCESS)
+        goto done;
+
+    if (trade->cl != NULL)
+    {
+        if (JpmcdsContingentLegPVCached (trade->cl,
+                                         trade->today,
+                                         trade->valueDate,
+                                         trade->cl->startDate,
+                                         discCurve,
+                                         spreadCurve,
+                                         recoveryRate,
+                                         &trade->clCache,
+                                         -1,
+                                         &myContingentLegPV,
+                                         NULL) != SUCCESS)
+            goto done;
+    }
+
+    if (accrued != NULL || cleanPrice != NULL)
+    {
+        if (JpmcdsFeeLegAI (trade->fl, trade->stepinDate, &ai) != SUCCESS)
+            goto done;
+    }
+
+    if (feeLegPV != NULL)
+        *feeLegPV = myFeeLegPV;
+    if (contingentLegPV != NULL)
+        *contingentLegPV = myContingentLegPV;
+    if (accrued != NULL)
+        *accrued = ai;
+    if (dirtyPrice != NULL)
+        *dirtyPrice = myContingentLegPV - myFeeLegPV;
+    if (cleanPrice != NULL)
+        *cleanPrice = myContingentLegPV - (myFeeLegPV - ai);
+    status = SUCCESS;
+
+ done:
+
+    if (status != SUCCESS)
+        JpmcdsErrMsgFailure (routine);
+
+    return status;
+}
+
+
+/*
+***************************************************************************
+** Computes the price for a vanilla CDS made by JpmcdsCdsTradeMake and adds
+** its derivatives with respect to the continuously compounded ACT/365F
+** rates of the discount and spread curves to discGrad and spreadGrad.
+**
+** Both legs are swept in reverse over the timelines held by the trade, so
+** all the derivatives cost about as much as two more pricings.
+***************************************************************************
+*/
+EXPORT int JpmcdsCdsTradePriceRateGrad
+(TCdsTrade        *trade,
+ TCurve           *discCurve,
+ TCurve           *spreadCurve,
+ double            recoveryRate,
+ TBoolean          isPriceClean,
+ double           *price,
+ double           *discGrad,
+ double           *spreadGrad)
+{
+    static char routine[] = "JpmcdsCdsTradePriceRateGrad";
+    int         status    = FAILURE;
+
+    double      myFeeLegPV = 0;
+    double      myContingentLegPV = 0;
+
+    REQUIRE(price != NULL);
+
+    /* makes sure the timelines held by the trade match the curve dates */
+    if (JpmcdsCdsTradePriceAll (trade,
+                                discCurve,
+                                spreadCurve,
+                                recoveryRate,
+                                NULL,
+                                NULL,
+                                NULL,
+                                NULL,
+                                NULL) != SUCCESS)
+        goto done;
+
+    if (JpmcdsFeeLegPVRateGrad (trade->fl,
+                                trade->today,
+                                trade->stepinDate,
+                                trade->valueDate,
+                                discCurve,
+                                spreadCurve,
+                                isPriceClean,
+                                trade->flCache.tl,
+                                -1.0,
+                                &myFeeLegPV,
+                                discGrad,
+                                spreadGrad) != SUCCESS)
+        goto done;
+
+    if (trade->cl != NULL)
+    {
+        if (JpmcdsContingentLegPVRateGrad (trade->cl,
+                                           trade->today,
+                                           trade->valueDate,
+                                           trade->cl->startDate,
+                                           discCurve,
+                                           spreadCurve,
+                                           recoveryRate,
+                                           trade->clCache.tl,
+                                           1.0,
+                                           &myContingentLegPV,
+                                           discGrad,
+                                           spreadGrad) != SUCCESS)
+            goto done;
+    }
+
+    *price = myContingentLegPV - myFeeLegPV;
+    status = SUCCESS;
+
+ done:
+
+    if (status != SUCCESS)
+        JpmcdsErrMsgFailure (routine);
+
+    return status;
+}
+
+
+/*
+***************************************************************************
+** Destructor for TCdsTrade
+***************************************************************************
+*/
+EXPORT void JpmcdsCdsTradeFree(TCdsTrade *trade)
+{
+    if (trade != NULL)
+    {
+        JpmcdsFeeLegFree (trade->fl);
+        FREE (trade->cl);
+        JpmcdsLegPVCacheClear (&trade->flCache);
+        JpmcdsLegPVCacheClear (&trade->clCache);
+        FREE (trade->curveDates);
+        FREE (trade);
+    }
+}
+
+
 /*
 ***************************************************************************
 ** Computes the par spread for a vanilla CDS which produces a zero price.
@@ -454,6 +816,87 @@ EXPORT int JpmcdsCdsParSpreads(
 }
 
 
+/*
+***************************************************************************
+** Computes the risky annuity of a vanilla CDS for each of a ladder of end
+** dates in one sweep along the timeline of the longest fee leg.
+***************************************************************************
+*/
+EXPORT int JpmcdsCdsRiskyAnnuities(
+    TDate           today,
+    TDate           valueDate,
+    TDate           stepinDate,
+    TDate           startDate,
+    long            nbEndDates,
+    TDate          *endDates,
+    TBoolean        payAccOnDefault,
+    TDateInterval  *couponInterval,
+    TStubMethod    *stubType,
+    long            paymentDcc,
+    long            badDayConv,
+    char           *calendar,
+    TCurve         *discCurve,
+    TCurve         *spreadCurve,
+    TBoolean        isPriceClean,
+    double         *annuity)
+{
+    static char routine[] = "JpmcdsCdsRiskyAnnuities";
+    int         status    = FAILURE;
+
+    TFeeLeg   **fls = NULL;
+    long        i;
+    TBoolean    protectStart = TRUE;
+
+    REQUIRE(annuity != NULL);
+    REQUIRE(endDates != NULL);
+    REQUIRE(nbEndDates >= 1);
+    REQUIRE(stepinDate >= today);
+    /* all other requirements can be handled by the routines we call */
+
+    fls = NEW_ARRAY(TFeeLeg*, nbEndDates);
+    if (fls == NULL)
+        goto done;
+
+    for(i = 0; i < nbEndDates; ++i)
+    {
+        fls[i] = JpmcdsCdsFeeLegMake (startDate, endDates[i], payAccOnDefault,
+                                      couponInterval, stubType, 1.0, /* notional */
+                                      1.0, /* couponRate */
+                                      paymentDcc, badDayConv,
+                                      calendar, protectStart);
+        if (fls[i] == NULL)
+            goto done;
+    }
+
+    if (JpmcdsFeeLegPVLadder ((int)nbEndDates,
+                              fls,
+                              today,
+                              stepinDate,
+                              valueDate,
+                              discCurve,
+                              spreadCurve,
+                              isPriceClean,
+                              annuity) != SUCCESS)
+        goto done;
+
+    status = SUCCESS;
+
+ done:
+
+    if (status != SUCCESS)
+        JpmcdsErrMsgFailure (routine);
+
+    if (fls != NULL)
+    {
+        for(i = 0; i < nbEndDates; ++i)
+            JpmcdsFeeLegFree (fls[i]);
+        FREE (fls);
+    }
+
+    return status;
+}
+
+
 /*
 ***************************************************************************
 ** Computes the non-contingent cash flows for a fee leg. These are the 
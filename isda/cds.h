@@ -19,6 +19,67 @@ extern "C"
 {
 #endif
 
+/** Root finder used for each benchmark of a credit curve bootstrap. */
+typedef enum
+{
+/** Brent root finder on the PV of the benchmark. */
+    JPMCDS_BOOTSTRAP_BRENT,                /* Brent */
+/** Newton iteration using the analytic derivative of the PV with respect
+    to the last hazard rate. Falls back to Brent if it does not converge. */
+    JPMCDS_BOOTSTRAP_NEWTON                /* Newton */
+} TBootstrapSolver;
+
+/** Vanilla CDS whose coupon schedule is generated once so that it can be
+    priced repeatedly against different curves. The risky timelines of both
+    legs are kept for as long as the curves have the same dates. */
+typedef struct _TCdsTrade
+{
+    /** Risk starts at the end of today */
+    TDate           today;
+    /** Date for which the PV is calculated and cash settled */
+    TDate           valueDate;
+    /** Date when step-in becomes effective */
+    TDate           stepinDate;
+    /** Fee leg with unit notional */
+    TFeeLeg        *fl;
+    /** Contingent leg with unit notional. NULL if protection has ended */
+    TContingentLeg *cl;
+    /** Timeline of the fee leg */
+    TLegPVCache     flCache;
+    /** Timeline of the contingent leg */
+    TLegPVCache     clCache;
+    /** Number of discount curve dates the timelines were built for */
+    int             nbDiscDates;
+    /** Number of spread curve dates the timelines were built for */
+    int             nbSpreadDates;
+    /** Discount curve dates followed by spread curve dates */
+    TDate          *curveDates;
+} TCdsTrade;
+
+/** Conventions of the standard contract, parsed once and then only read so
+    that repeated pricings do not parse the same strings again. */
+typedef struct _TCdsConventions
+{
+    /** Step-in date after the trade date, 1D */
+    TDateInterval   stepinInterval;
+    /** Cash settlement date after the trade date, 3D */
+    TDateInterval   cashSettleInterval;
+    /** Interval between fee payments, Q */
+    TDateInterval   couponInterval;
+    /** Day count of fee payments and accrual, Act/360 */
+    long            paymentDcc;
+    /** Front short stub */
+    TStubMethod     stubMethod;
+    /** Bad day convention of the fee payments, following */
+    long            badDayConv;
+    /** Holiday calendar of the fee payments */
+    char           *calendar;
+    /** Pay accrued on default */
+    TBoolean        payAccOnDefault;
+    /** Root finder of the spread curve bootstraps, Brent */
+    TBootstrapSolver bootstrapSolver;
+} TCdsConventions;
+
 /*f
 ***************************************************************************
 ** Makes a contingent leg for a vanilla CDS.
@@ -229,6 +290,131 @@ EXPORT int JpmcdsCdsPrice(
     double         *price);
 
   
+/*f
+***************************************************************************
+** Makes a vanilla CDS for repeated pricing with JpmcdsCdsTradePrice.
+**
+** The fee and contingent legs are the ones JpmcdsCdsPrice builds on every
+** call, so that pricing the trade gives the same result as JpmcdsCdsPrice
+** with the same inputs.
+***************************************************************************
+*/
+EXPORT TCdsTrade* JpmcdsCdsTradeMake(
+    /** Risk starts at the end of today */
+    TDate           today,
+    /** Date for which the PV is calculated and cash settled */
+    TDate           valueDate,
+    /** Date when step-in becomes effective */
+    TDate           stepinDate,
+    /** Date when protection begins. Either at start or end of day (depends
+        on protectStart) */
+    TDate           startDate,
+    /** Date when protection ends (end of day) */
+    TDate           endDate,
+    /** Fixed coupon rate (a.k.a. spread) for the fee leg */
+    double          couponRate,
+    /** Should accrued interest be paid on default. Usually set to TRUE */
+    TBoolean        payAccOnDefault,
+    /** Interval between coupon payments. Can be NULL when 3M is assumed */
+    TDateInterval  *couponInterval,
+    /** If the startDate and endDate are not on cycle, then this parameter
+        determines location of coupon dates. */
+    TStubMethod    *stubType,
+    /** Day count convention for coupon payment. Normal is ACT_360 */
+    long            paymentDcc,
+    /** Bad day convention for adjusting coupon payment dates. */
+    long            badDayConv,
+    /** Calendar used when adjusting coupon dates. Can be NULL which equals
+        a calendar with no holidays and including weekends. */
+    char           *calendar);
+
+
+/*f
+***************************************************************************
+** Computes the price for a vanilla CDS made by JpmcdsCdsTradeMake.
+***************************************************************************
+*/
+EXPORT int JpmcdsCdsTradePrice(
+    /** Trade made by JpmcdsCdsTradeMake */
+    TCdsTrade      *trade,
+    /** Interest rate discount curve - assumes flat forward interpolation */
+    TCurve         *discCurve,
+    /** Credit clean spread curve */
+    TCurve         *spreadCurve,
+    /** Assumed recovery rate in case of default */
+    double          recoveryRate,
+    /** Is the price expressed as a clean price (removing accrued interest) */
+    TBoolean        isPriceClean,
+    /** Output - price (a.k.a. upfront charge) for the CDS is returned 
+        (see also isPriceClean) */
+    double         *price);
+
+
+/*f
+***************************************************************************
+** Computes the dirty and clean prices, accrued interest and leg values for
+** a vanilla CDS made by JpmcdsCdsTradeMake from a single valuation of each
+** leg. The prices are the ones JpmcdsCdsTradePrice returns.
+***************************************************************************
+*/
+EXPORT int JpmcdsCdsTradePriceAll(
+    /** Trade made by JpmcdsCdsTradeMake */
+    TCdsTrade      *trade,
+    /** Interest rate discount curve - assumes flat forward interpolation */
+    TCurve         *discCurve,
+    /** Credit clean spread curve */
+    TCurve         *spreadCurve,
+    /** Assumed recovery rate in case of default */
+    double          recoveryRate,
+    /** Output - PV of the fee leg including accrued interest. Can be NULL */
+    double         *feeLegPV,
+    /** Output - PV of the contingent leg. Can be NULL */
+    double         *contingentLegPV,
+    /** Output - accrued interest at the step-in date. Can be NULL */
+    double         *accrued,
+    /** Output - dirty price (a.k.a. upfront charge). Can be NULL */
+    double         *dirtyPrice,
+    /** Output - clean price. Can be NULL */
+    double         *cleanPrice);
+
+
+/*f
+***************************************************************************
+** Computes the price for a vanilla CDS made by JpmcdsCdsTradeMake and adds
+** its derivatives with respect to the continuously compounded ACT/365F
+** rates of both curves to discGrad and spreadGrad. All the derivatives
+** come from one reverse sweep over each leg.
+***************************************************************************
+*/
+EXPORT int JpmcdsCdsTradePriceRateGrad(
+    /** Trade made by JpmcdsCdsTradeMake */
+    TCdsTrade      *trade,
+    /** Interest rate discount curve - assumes flat forward interpolation */
+    TCurve         *discCurve,
+    /** Credit clean spread curve */
+    TCurve         *spreadCurve,
+    /** Assumed recovery rate in case of default */
+    double          recoveryRate,
+    /** Is the price expressed as a clean price (removing accrued interest) */
+    TBoolean        isPriceClean,
+    /** Output - price (a.k.a. upfront charge) for the CDS */
+    double         *price,
+    /** Input/Output - derivatives are added for each discount curve point.
+        Can be NULL */
+    double         *discGrad,
+    /** Input/Output - derivatives are added for each spread curve point.
+        Can be NULL */
+    double         *spreadGrad);
+
+
+/*f
+***************************************************************************
+** Destructor for TCdsTrade
+***************************************************************************
+*/
+EXPORT void JpmcdsCdsTradeFree(TCdsTrade *trade);
+
+
 /*f
 ***************************************************************************
 ** Computes the benchmark par spreads 
@@ -281,6 +467,55 @@ EXPORT int JpmcdsCdsParSpreads(
     double         *parSpread);
 
 
+/*f
+***************************************************************************
+** Computes the risky annuity, the fee leg PV at unit coupon, of the CDS
+** for each of a ladder of end dates.
+**
+** The fee legs share all but their last payments, so the shared payments
+** are priced once along a single timeline rather than once per end date.
+** The price of the CDS changes by minus the annuity times the change in
+** coupon, so one basis point of the annuity is the PVBP.
+***************************************************************************
+*/
+EXPORT int JpmcdsCdsRiskyAnnuities(
+    /** Risk starts at the end of today */
+    TDate           today,
+    /** Date for which the PV is calculated and cash settled */
+    TDate           valueDate,
+    /** Date when step-in becomes effective  */
+    TDate           stepinDate,
+    /** Date when protection begins. Either at start or end of day (depends
+        on protectStart) */
+    TDate           startDate,
+    /** Number of end dates */
+    long            nbEndDates,
+    /** Date when protection ends (end of day), no bad day adjustment */
+    TDate          *endDates,
+    /** Should accrued interest be paid on default. Usually set to TRUE */
+    TBoolean        payAccOnDefault,
+    /** Interval between coupon payments. Can be NULL when 3M is assumed */
+    TDateInterval  *couponInterval,
+    /** If the startDate and endDate are not on cycle, then this parameter
+        determines location of coupon dates. */
+    TStubMethod    *stubType,
+    /** Day count convention for coupon payment. Normal is ACT_360 */
+    long            paymentDcc,
+    /** Bad day convention for adjusting coupon payment dates. */
+    long            badDayConv,
+    /** Calendar used when adjusting coupon dates. Can be NULL which equals
+        a calendar with no holidays and including weekends. */
+    char           *calendar,
+    /** Interest rate discount curve - assumes flat forward interpolation */
+    TCurve         *discCurve,
+    /** Credit clean spread curve */
+    TCurve         *spreadCurve,
+    /** Is the annuity clean of accrued interest */
+    TBoolean        isPriceClean,
+    /** Output - one annuity per end date */
+    double         *annuity);
+
+
 /*f
 ***************************************************************************
 ** Computes the non-contingent cash flows for a fee leg. These are the
@@ -374,6 +609,169 @@ EXPORT TCurve* JpmcdsCleanSpreadCurve(
     char           *calendar
 );
 
+
+/*f
+***************************************************************************
+** As JpmcdsCleanSpreadCurve with a choice of root finder for each
+** benchmark.
+***************************************************************************
+*/
+EXPORT TCurve* JpmcdsCleanSpreadCurveSolver(
+    /** Risk starts at the end of today */
+    TDate           today,
+    /** Interest rate discount curve - assumes flat forward interpolation */
+    TCurve         *discCurve,
+    /** Effective date of the benchmark CDS */
+    TDate           startDate,
+    /** Step in date of the benchmark CDS */
+    TDate           stepinDate,
+    /** Date when payment should be make */
+    TDate           cashSettleDate,
+    /** Number of benchmark dates */
+    long            nbDate,
+    /** Dates when protection ends for each benchmark (end of day).
+        Array of size nbDate */
+    TDate          *endDates,
+    /** Coupon rates for each benchmark instrument. Array of size nbDate */
+    double         *couponRates,
+    /** Flags to denote that we include particular benchmarks. This makes it
+        easy for the user to include or exclude benchmarks on a one-by-one
+        basis. Can be NULL if all are included. Otherwise an array of size
+        nbDate. */
+    TBoolean       *includes,
+    /** Recovery rate in case of default */
+    double          recoveryRate,
+    /** Should accrued interest be paid on default. Usually set to TRUE */
+    TBoolean        payAccOnDefault,
+    /** Interval between coupon payments. Can be NULL when 3M is assumed */
+    TDateInterval  *couponInterval,
+    /** Day count convention for coupon payment. Normal is ACT_360 */
+    long            paymentDcc,
+    /** If the startDate and endDate are not on cycle, then this parameter
+        determines location of coupon dates. */
+    TStubMethod    *stubType,
+    /** Bad day convention for adjusting coupon payment dates. */
+    long            badDayConv,
+    /** Calendar used when adjusting coupon dates. Can be NULL which equals
+        a calendar with no holidays and including weekends. */
+    char           *calendar,
+    /** Root finder used for each benchmark */
+    TBootstrapSolver solver
+);
+
+
+/*f
+***************************************************************************
+** Bootstraps the clean spread curve and, for each benchmark, the curve with
+** only that benchmark's coupon rate bumped. Used for bucketed spread risk.
+**
+** Each bumped curve restarts from the base curve at its bumped benchmark:
+** earlier benchmarks are not solved again and later ones start from the
+** base rates, which is much cheaper than nbDate separate bootstraps.
+***************************************************************************
+*/
+EXPORT TCurve* JpmcdsCleanSpreadCurveBuckets(
+    /** Risk starts at the end of today */
+    TDate           today,
+    /** Interest rate discount curve - assumes flat forward interpolation */
+    TCurve         *discCurve,
+    /** Effective date of the benchmark CDS */
+    TDate           startDate,
+    /** Step in date of the benchmark CDS */
+    TDate           stepinDate,
+    /** Date when payment should be make */
+    TDate           cashSettleDate,
+    /** Number of benchmark dates */
+    long            nbDate,
+    /** Dates when protection ends for each benchmark (end of day).
+        Array of size nbDate */
+    TDate          *endDates,
+    /** Coupon rates for each benchmark instrument. Array of size nbDate */
+    double         *couponRates,
+    /** Recovery rate in case of default */
+    double          recoveryRate,
+    /** Should accrued interest be paid on default. Usually set to TRUE */
+    TBoolean        payAccOnDefault,
+    /** Interval between coupon payments. Can be NULL when 3M is assumed */
+    TDateInterval  *couponInterval,
+    /** Day count convention for coupon payment. Normal is ACT_360 */
+    long            paymentDcc,
+    /** If the startDate and endDate are not on cycle, then this parameter
+        determines location of coupon dates. */
+    TStubMethod    *stubType,
+    /** Bad day convention for adjusting coupon payment dates. */
+    long            badDayConv,
+    /** Calendar used when adjusting coupon dates. Can be NULL which equals
+        a calendar with no holidays and including weekends. */
+    char           *calendar,
+    /** Root finder used for each benchmark */
+    TBootstrapSolver solver,
+    /** Added to the coupon rate of one benchmark per bumped curve */
+    double          bump,
+    /** Output array of size nbDate. Entry k is the curve bootstrapped with
+        benchmark k bumped, to be freed by the caller */
+    TCurve        **bumpedCurves
+);
+
+
+/*f
+***************************************************************************
+** Computes the sensitivities of the rates of a clean spread curve
+** bootstrapped from a set of benchmarks to the benchmark coupon rates and
+** to the rates of the discount curve, without bootstrapping again.
+**
+** Together with JpmcdsCdsTradePriceRateGrad this gives the sensitivities
+** of a price to every benchmark coupon rate for about the cost of two more
+** pricings of the trade, once the curve has been done.
+***************************************************************************
+*/
+EXPORT int JpmcdsCleanSpreadCurveJacobian(
+    /** Risk starts at the end of today */
+    TDate           today,
+    /** Interest rate discount curve - assumes flat forward interpolation */
+    TCurve         *discCurve,
+    /** Effective date of the benchmark CDS */
+    TDate           startDate,
+    /** Step in date of the benchmark CDS */
+    TDate           stepinDate,
+    /** Date when payment should be make */
+    TDate           cashSettleDate,
+    /** Number of benchmark dates */
+    long            nbDate,
+    /** Dates when protection ends for each benchmark (end of day).
+        Array of size nbDate */
+    TDate          *endDates,
+    /** Coupon rates for each benchmark instrument. Array of size nbDate */
+    double         *couponRates,
+    /** Recovery rate in case of default */
+    double          recoveryRate,
+    /** Should accrued interest be paid on default. Usually set to TRUE */
+    TBoolean        payAccOnDefault,
+    /** Interval between coupon payments. Can be NULL when 3M is assumed */
+    TDateInterval  *couponInterval,
+    /** Day count convention for coupon payment. Normal is ACT_360 */
+    long            paymentDcc,
+    /** If the startDate and endDate are not on cycle, then this parameter
+        determines location of coupon dates. */
+    TStubMethod    *stubType,
+    /** Bad day convention for adjusting coupon payment dates. */
+    long            badDayConv,
+    /** Calendar used when adjusting coupon dates. Can be NULL which equals
+        a calendar with no holidays and including weekends. */
+    char           *calendar,
+    /** Clean spread curve bootstrapped from the benchmarks above */
+    TCurve         *spreadCurve,
+    /** Output array of size nbDate x nbDate. Entry i * nbDate + k is the
+        derivative of the continuous rate of curve point i with respect to
+        the coupon rate of benchmark k */
+    double         *rateByQuote,
+    /** Output array of size nbDate x discCurve->fNumItems. Entry i * n + k
+        is the derivative of the continuous rate of curve point i with
+        respect to the continuous rate of discount curve point k. Can be
+        NULL */
+    double         *rateByDiscount
+);
+
 #ifdef __cplusplus
 }
 #endif
@@ -10,9 +10,13 @@
 
 #include "cdsone.h"
 #include "cds.h"
+#include "contingentleg.h"
+#include "feeleg.h"
 #include "cerror.h"
+#include "macros.h"
 #include "rtbrent.h"
 #include "tcurve.h"
+#include "ldate.h"
 
 
 typedef struct
@@ -38,6 +42,24 @@ typedef struct
 } CDSONE_SPREAD_CONTEXT;
 
 
+typedef struct
+{
+    TDate           today;
+    TDate           valueDate;
+    TDate           stepinDate;
+    TCurve         *discCurve;
+    TCurve         *flatCurve;      /* one continuously compounded ACT/365F
+                                    ** hazard rate at the end date */
+    double          recoveryRate;
+    TBoolean        payAccruedAtStart;
+    TFeeLeg        *fl;
+    TContingentLeg *cl;             /* NULL if protection has ended */
+    TLegPVCache     flCache;
+    TLegPVCache     clCache;
+    double          upfrontCharge;
+} CDSONE_FLAT_HAZARD_CONTEXT;
+
+
 /* static function declarations */
 static int cdsoneSpreadSolverFunction
 (double               bbgSpread,
@@ -45,6 +67,30 @@ static int cdsoneSpreadSolverFunction
  double              *diff);
 
 
+static int cdsoneFlatHazardFunctionDeriv
+(double                      hazardRate,
+ CDSONE_FLAT_HAZARD_CONTEXT *context,
+ double                     *diff,
+ double                     *ddiff);
+
+
+static int cdsoneFlatHazardFunction
+(double                      hazardRate,
+ CDSONE_FLAT_HAZARD_CONTEXT *context,
+ double                     *diff);
+
+
+static int cdsoneFlatHazardNewton
+(CDSONE_FLAT_HAZARD_CONTEXT *context,
+ double                      boundLo,
+ double                      boundHi,
+ int                         numIterations,
+ double                      guess,
+ double                      xacc,
+ double                      facc,
+ double                     *solution);
+
+
 /*
 ***************************************************************************
 ** Computes the upfront charge for a flat spread par curve.
@@ -201,6 +247,186 @@ EXPORT int JpmcdsCdsoneSpread
 }
 
 
+/*
+***************************************************************************
+** Computes the flat spread required to match the upfront charge with a
+** single root-find.
+**
+** JpmcdsCdsoneSpread solves for the spread, and every trial spread is
+** bootstrapped into a flat hazard rate by its own root-find. Here the
+** solver works on the flat hazard rate directly: the upfront charge of a
+** flat curve and its derivative come from one pricing of the legs, so
+** Newton usually converges in three or four pricings. The quoted spread is
+** then the par spread of the benchmark CDS on that flat curve, which is
+** the spread JpmcdsCleanSpreadCurve would bootstrap back to the same rate.
+**
+** guess is the starting spread; if it is not positive the coupon is used.
+** Brent is used if Newton does not converge.
+***************************************************************************
+*/
+EXPORT int JpmcdsCdsoneSpreadFlatHazard
+(TDate           today,
+ TDate           valueDate,
+ TDate           benchmarkStartDate,  /* start date of benchmark CDS for
+                                      ** internal clean spread bootstrapping */
+ TDate           stepinDate,
+ TDate           startDate,
+ TDate           endDate,
+ double          couponRate,
+ TBoolean        payAccruedOnDefault,
+ TDateInterval  *dateInterval,
+ TStubMethod    *stubType,
+ long            accrueDCC,
+ long            badDayConv,
+ char           *calendar,
+ TCurve         *discCurve,
+ double          upfrontCharge,
+ double          recoveryRate,
+ TBoolean        payAccruedAtStart,
+ double          guess,
+ double         *onespread)
+{
+    static char routine[] = "JpmcdsCdsoneSpreadFlatHazard";
+    int         status    = FAILURE;
+
+    CDSONE_FLAT_HAZARD_CONTEXT context;
+    TFeeLeg        *benchmarkFl = NULL;
+    TContingentLeg *benchmarkCl = NULL;
+    TBoolean        protectStart = TRUE;
+    double          hazardRate;
+    double          hazardGuess;
+    double          pvC;
+    double          pvF;
+
+    context.fl        = NULL;
+    context.cl        = NULL;
+    context.flatCurve = NULL;
+    JpmcdsLegPVCacheInit (&context.flCache, 0);
+    JpmcdsLegPVCacheInit (&context.clCache, 0);
+
+    REQUIRE (onespread != NULL);
+    REQUIRE (discCurve != NULL);
+    REQUIRE (stepinDate >= today);
+    REQUIRE (recoveryRate < 1.0);
+
+    if (guess <= 0.0)
+        guess = couponRate;
+    hazardGuess = MAX(guess, 0.0) / (1.0 - recoveryRate);
+
+    context.today             = today;
+    context.valueDate         = valueDate;
+    context.stepinDate        = stepinDate;
+    context.discCurve         = discCurve;
+    context.recoveryRate      = recoveryRate;
+    context.payAccruedAtStart = payAccruedAtStart;
+    context.upfrontCharge     = upfrontCharge;
+
+    context.flatCurve = JpmcdsMakeTCurve (today,
+                                          &endDate,
+                                          &hazardGuess,
+                                          1,
+                                          JPMCDS_CONTINUOUS_BASIS,
+                                          JPMCDS_ACT_365F);
+    if (context.flatCurve == NULL)
+        goto done;
+
+    /* the legs of the trade as priced by JpmcdsCdsPrice */
+    context.fl = JpmcdsCdsFeeLegMake (startDate, endDate, payAccruedOnDefault,
+                                      dateInterval, stubType, 1.0, /* notional */
+                                      couponRate, accrueDCC, badDayConv,
+                                      calendar, protectStart);
+    if (context.fl == NULL)
+        goto done;
+
+    if (MAX(stepinDate, startDate) <= endDate)
+    {
+        context.cl = JpmcdsCdsContingentLegMake (MAX(stepinDate, startDate),
+                                                 endDate,
+                                                 1.0, /* notional */
+                                                 protectStart);
+        if (context.cl == NULL)
+            goto done;
+    }
+
+    if (cdsoneFlatHazardNewton (&context,
+                                0.0,    /* boundLo */
+                                1e10,   /* boundHi */
+                                20,     /* numIterations */
+                                hazardGuess,
+                                1e-10,  /* xacc */
+                                1e-10,  /* facc */
+                                &hazardRate) == SUCCESS)
+    {
+        /* converged without Brent */
+    }
+    else if (JpmcdsRootFindBrent ((TObjectFunc)cdsoneFlatHazardFunction,
+                                  &context,
+                                  0.0,    /* boundLo */
+                                  1e10,   /* boundHi */
+                                  100,    /* numIterations */
+                                  hazardGuess,
+                                  0.0005, /* initialXStep */
+                                  0.0,    /* initialFDeriv */
+                                  1e-10,  /* xacc */
+                                  1e-10,  /* facc */
+                                  &hazardRate) != SUCCESS)
+        goto done;
+
+    context.flatCurve->fArray[0].fRate = hazardRate;
+
+    /* par spread of the benchmark CDS as bootstrapped by
+       JpmcdsCleanSpreadCurve - the fee leg is linear in the coupon */
+    benchmarkCl = JpmcdsCdsContingentLegMake (MAX(today, benchmarkStartDate),
+                                              endDate,
+                                              1.0, /* notional */
+                                              protectStart);
+    if (benchmarkCl == NULL)
+        goto done;
+
+    benchmarkFl = JpmcdsCdsFeeLegMake (benchmarkStartDate, endDate,
+                                       payAccruedOnDefault, dateInterval,
+                                       stubType, 1.0, /* notional */
+                                       1.0, /* couponRate */
+                                       accrueDCC, badDayConv, calendar,
+                                       protectStart);
+    if (benchmarkFl == NULL)
+        goto done;
+
+    if (JpmcdsContingentLegPV (benchmarkCl, today, valueDate, stepinDate,
+                               discCurve, context.flatCurve, recoveryRate,
+                               &pvC) != SUCCESS)
+        goto done;
+
+    if (JpmcdsFeeLegPV (benchmarkFl, today, stepinDate, valueDate, discCurve,
+                        context.flatCurve, TRUE, &pvF) != SUCCESS)
+        goto done;
+
+    if (pvF <= 0.0)
+    {
+        JpmcdsErrMsg ("%s: Benchmark risky annuity %f is not positive.\n",
+                      routine, pvF);
+        goto done;
+    }
+
+    *onespread = pvC / pvF;
+    status = SUCCESS;
+
+ done:
+
+    JpmcdsFreeTCurve (context.flatCurve);
+    JpmcdsFeeLegFree (context.fl);
+    FREE (context.cl);
+    JpmcdsLegPVCacheClear (&context.flCache);
+    JpmcdsLegPVCacheClear (&context.clCache);
+    JpmcdsFeeLegFree (benchmarkFl);
+    FREE (benchmarkCl);
+
+    if (status != SUCCESS)
+        JpmcdsErrMsgFailure (routine);
+    return status;
+}
+
+
 /* static function declarations */
 static int cdsoneSpreadSolverFunction
 (double               onespread,
@@ -232,3 +458,137 @@ static int cdsoneSpreadSolverFunction
     *diff = upfrontCharge - context->upfrontCharge;
     return SUCCESS;
 }
+
+
+/*
+***************************************************************************
+** Difference between the upfront charge of a flat hazard rate curve and the
+** target, together with its derivative with respect to the hazard rate.
+***************************************************************************
+*/
+static int cdsoneFlatHazardFunctionDeriv
+(double                      hazardRate,
+ CDSONE_FLAT_HAZARD_CONTEXT *context,
+ double                     *diff,
+ double                     *ddiff)
+{
+    static char routine[] = "cdsoneFlatHazardFunctionDeriv";
+    int         status    = FAILURE;
+
+    double pvC  = 0.0;
+    double dpvC = 0.0;
+    double pvF;
+    double dpvF;
+
+    context->flatCurve->fArray[0].fRate = hazardRate;
+
+    if (JpmcdsFeeLegPVCached (context->fl,
+                              context->today,
+                              context->stepinDate,
+                              context->valueDate,
+                              context->discCurve,
+                              context->flatCurve,
+                              context->payAccruedAtStart,
+                              &context->flCache,
+                              0,
+                              &pvF,
+                              ddiff != NULL ? &dpvF : NULL) != SUCCESS)
+        goto done;
+
+    if (context->cl != NULL)
+    {
+        if (JpmcdsContingentLegPVCached (context->cl,
+                                         context->today,
+                                         context->valueDate,
+                                         context->cl->startDate,
+                                         context->discCurve,
+                                         context->flatCurve,
+                                         context->recoveryRate,
+                                         &context->clCache,
+                                         0,
+                                         &pvC,
+                                         ddiff != NULL ? &dpvC : NULL) != SUCCESS)
+            goto done;
+    }
+
+    *diff = pvC - pvF - context->upfrontCharge;
+    if (ddiff != NULL)
+        *ddiff = dpvC - dpvF;
+    status = SUCCESS;
+
+ done:
+
+    if (status != SUCCESS)
+        JpmcdsErrMsgFailure (routine);
+
+    return status;
+}
+
+
+/*
+***************************************************************************
+** Objective function for the Brent fallback of the flat hazard solver.
+***************************************************************************
+*/
+static int cdsoneFlatHazardFunction
+(double                      hazardRate,
+ CDSONE_FLAT_HAZARD_CONTEXT *context,
+ double                     *diff)
+{
+    return cdsoneFlatHazardFunctionDeriv (hazardRate, context, diff, NULL);
+}
+
+
+/*
+***************************************************************************
+** Newton root-finder for the flat hazard rate.
+**
+** Returns FAILURE without an error message if the iteration leaves the
+** bounds or does not converge, so that the caller can fall back to Brent.
+***************************************************************************
+*/
+static int cdsoneFlatHazardNewton
+(CDSONE_FLAT_HAZARD_CONTEXT *context,
+ double                      boundLo,
+ double                      boundHi,
+ int                         numIterations,
+ double                      guess,
+ double                      xacc,
+ double                      facc,
+ double                     *solution)
+{
+    double x = guess;
+    int    iter;
+
+    for (iter = 0; iter < numIterations; ++iter)
+    {
+        double f;
+        double dfdx;
+        double dx;
+
+        if (cdsoneFlatHazardFunctionDeriv (x, context, &f, &dfdx) != SUCCESS)
+            return FAILURE;
+
+        if (f == 0.0)
+        {
+            *solution = x;
+            return SUCCESS;
+        }
+
+        if (!(dfdx > 0.0 || dfdx < 0.0))
+            return FAILURE;
+
+        dx = -f / dfdx;
+        x += dx;
+        if (!(x >= boundLo && x <= boundHi))
+            return FAILURE;
+
+        if (ABS(f) <= facc && ABS(dx) <= xacc)
+        {
+            *solution = x;
+            return SUCCESS;
+        }
+    }
+
+    return FAILURE;
+}
@@ -72,6 +72,39 @@ EXPORT int JpmcdsCdsoneSpread
  TBoolean        payAccruedAtStart,
  double         *oneSpread);
 
+
+/*f
+***************************************************************************
+** Computes the flat spread required to match the upfront charge by solving
+** for the flat hazard rate directly, starting from the spread guess (the
+** coupon if guess is not positive).
+**
+** Agrees with JpmcdsCdsoneSpread within its tolerance but avoids the
+** bootstrap of a flat curve for every trial spread.
+***************************************************************************
+*/
+EXPORT int JpmcdsCdsoneSpreadFlatHazard
+(TDate           today,
+ TDate           valueDate,
+ TDate           benchmarkStartDate,  /* start date of benchmark CDS for
+                                      ** internal clean spread bootstrapping */
+ TDate           stepinDate,
+ TDate           startDate,           /* CDS start date, can be in the past */
+ TDate           endDate,
+ double          couponRate,
+ TBoolean        payAccruedOnDefault,
+ TDateInterval  *dateInterval,
+ TStubMethod    *stubType,
+ long            accrueDCC,
+ long            badDayConv,
+ char           *calendar,
+ TCurve         *discCurve,
+ double          upfrontCharge,
+ double          recoveryRate,
+ TBoolean        payAccruedAtStart,
+ double          guess,
+ double         *oneSpread);
+
 #ifdef __cplusplus
 }
 #endif
@@ -16,6 +16,12 @@
 #include <time.h>
 #include <ctype.h>
 
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
 #include "cgeneral.h"
 #include "cerror.h"
 #include "cmemory.h"
@@ -37,7 +43,11 @@
 
 #define TS_SENSITIVITY 2.0      /* min. interval in sec for time stamps */
 
-static TFile *pFp = NULL;
+/* The log file, the message record and the recursion guard belong to the
+ * calling thread so that analytics can run on several threads at once.
+ * The remaining settings are process wide.
+ */
+static JPMCDS_THREAD_LOCAL TFile *pFp = NULL;
 
 /* pAppendOnOpen indicates whether the error log should be opened in
  * append mode. If a new empty file is to be opened, this should be
@@ -61,6 +71,10 @@ static char pLogFilePath[MAX_LOG_PATH_LEN];
  */
 static TBoolean pWriteMessage = FALSE;  /* Default is OFF */
 
+/* pInErrMsg is set while this thread is inside JpmcdsErrMsg.
+ */
+static JPMCDS_THREAD_LOCAL TBoolean pInErrMsg = FALSE;
+
 static JpmcdsErrCallBackFunc *errorUserFunc = NULL;
 static TBoolean          errorSendTimeStamp = TRUE;
 static void             *errorCallBackData;
@@ -115,7 +129,23 @@ typedef struct record_s
    char       **buf;
 } Record;
 
-static Record record = {FALSE, 0, 0, 0, NULL, NULL};
+static JPMCDS_THREAD_LOCAL Record record = {FALSE, 0, 0, 0, NULL, NULL};
+
+/* The record and the log file of a thread are released when it exits, so
+ * threads which never disable the record, such as the threads of a Python
+ * pool calling the wrappers, do not leak them.
+ */
+#if defined(_WIN32)
+static INIT_ONCE      threadExitOnce = INIT_ONCE_STATIC_INIT;
+static DWORD          threadExitIndex = FLS_OUT_OF_INDEXES;
+#else
+static pthread_once_t threadExitOnce = PTHREAD_ONCE_INIT;
+static pthread_key_t  threadExitKey;
+static TBoolean       threadExitKeyMade = FALSE;
+#endif
+static JPMCDS_THREAD_LOCAL TBoolean threadExitWatched = FALSE;
+
+static void WatchThreadExit(void);
 
 
 /*
@@ -244,23 +274,21 @@ void JpmcdsErrMsg(char *format,  ...)
 */
 void JpmcdsErrMsgV(char *format,  va_list parminfo)
 {
-    TBoolean localpWriteMessage;     /* Local copy of pWriteMessage */
+    if (!pWriteMessage)
+    {
+        return;                         /* Message writing not turned on */
+    }
 
     /*
      * We MUST turn off error logging while JpmcdsErrMsg is executing.
      * If we don't, we could potentially land in an infinite loop.
      */
-    localpWriteMessage = pWriteMessage;
-
-    if (!localpWriteMessage)
+    if (pInErrMsg)
     {
-        return;                         /* Message writing not turned on */
+        return;
     }
 
-    pWriteMessage = FALSE; /* Turn off message writing when executing
-                              JpmcdsErrMsg because we don't want an
-                              infinite loop of calls to JpmcdsErrMsg
-                           */
+    pInErrMsg = TRUE;
 
     if (pFp == NULL)
     {
@@ -284,7 +312,7 @@ void JpmcdsErrMsgV(char *format,  va_list parminfo)
 
     if (JpmcdsWriteToLog(TRUE, format, parminfo) != SUCCESS)
     {
-        pWriteMessage = localpWriteMessage; /* Restore the variable */
+        pInErrMsg = FALSE;
         return; /* failed */
     }
 
@@ -294,7 +322,7 @@ void JpmcdsErrMsgV(char *format,  va_list parminfo)
  done:
     JpmcdsFclose(pFp);
     pFp = NULL;
-    pWriteMessage = localpWriteMessage; /* Restore the variable */
+    pInErrMsg = FALSE;
     return;
 }
 
@@ -426,6 +454,7 @@ static int FileCreate
     /* Here we have successfully opened the file.
      */
     pFp = tfp;
+    WatchThreadExit();
 
     return SUCCESS;
 }
@@ -441,7 +470,7 @@ static int FileCreate
 */
 static int TimeStampRequired (void)
 {
-    static time_t lastStamp_t =0;
+    static JPMCDS_THREAD_LOCAL time_t lastStamp_t =0;
     time_t currStamp_t;
 
     time(&currStamp_t);
@@ -592,6 +621,7 @@ EXPORT int JpmcdsErrMsgEnableRecord(
        return SUCCESS;
 
     record.on = TRUE;
+    WatchThreadExit();
     record.number = numberOfMessages;
     record.size = messageSize;
     record.lastLine = -1;
@@ -845,3 +875,57 @@ EXPORT void JpmcdsErrMsgGetCallback
     *sendTimeStamp = errorSendTimeStamp;
     *callBackData = errorCallBackData;
 }
+
+
+/*
+***************************************************************************
+** Releases the record and the log file of a thread when it exits.
+***************************************************************************
+*/
+#if defined(_WIN32)
+static VOID NTAPI ThreadExit(PVOID data)
+#else
+static void ThreadExit(void *data)
+#endif
+{
+    JpmcdsErrMsgDisableRecord();
+    JpmcdsFclose(pFp);
+    pFp = NULL;
+}
+
+
+#if defined(_WIN32)
+static BOOL CALLBACK MakeThreadExitKey(PINIT_ONCE once, PVOID param, PVOID *context)
+{
+    threadExitIndex = FlsAlloc(ThreadExit);
+    return TRUE;
+}
+#else
+static void MakeThreadExitKey(void)
+{
+    threadExitKeyMade = pthread_key_create(&threadExitKey, ThreadExit) == 0;
+}
+#endif
+
+
+/*
+***************************************************************************
+** Arranges for ThreadExit to run when the calling thread exits. The key
+** only needs a value which is not NULL.
+***************************************************************************
+*/
+static void WatchThreadExit(void)
+{
+    if (threadExitWatched)
+        return;
+
+#if defined(_WIN32)
+    InitOnceExecuteOnce(&threadExitOnce, MakeThreadExitKey, NULL, NULL);
+    threadExitWatched = threadExitIndex != FLS_OUT_OF_INDEXES &&
+        FlsSetValue(threadExitIndex, &record);
+#else
+    pthread_once(&threadExitOnce, MakeThreadExitKey);
+    threadExitWatched = threadExitKeyMade &&
+        pthread_setspecific(threadExitKey, &record) == 0;
+#endif
+}
@@ -38,6 +38,15 @@ extern "C"
 
 #endif                                  /* if (WIN32, etc) */
 
+/* Storage class for state that each thread keeps for itself. */
+#ifndef JPMCDS_THREAD_LOCAL
+#if defined(_MSC_VER)
+#define JPMCDS_THREAD_LOCAL __declspec(thread)
+#else
+#define JPMCDS_THREAD_LOCAL __thread
+#endif
+#endif
+
 typedef int TBoolean;
 
 #ifndef TRUE
@@ -14,6 +14,33 @@
 #include "cerror.h"
 
 
+/*
+** Every block starts with a header giving its size class, so that a block
+** released while the arena is on can be handed out again for any request
+** of that class. The header keeps the memory returned 16 byte aligned.
+*/
+typedef union _TMemHeader
+{
+    size_t               sizeClass;  /* ARENA_NO_CLASS if never recycled */
+    union _TMemHeader   *next;       /* next free block of the class */
+    double               align[2];
+} TMemHeader;
+
+#define ARENA_MIN_SHIFT   5          /* smallest class holds 32 bytes */
+#define ARENA_NB_CLASSES  12         /* largest class holds 64KB */
+#define ARENA_NO_CLASS    ((size_t)-1)
+#define ARENA_CLASS_SIZE(c) ((size_t)1 << ((c) + ARENA_MIN_SHIFT))
+
+/*
+** Blocks released while the arena is on for the thread, by size class.
+** The first word after the header of a free block links to the next one.
+*/
+static JPMCDS_THREAD_LOCAL TMemHeader *arenaFree[ARENA_NB_CLASSES];
+static JPMCDS_THREAD_LOCAL size_t      arenaBytes = 0;
+static JPMCDS_THREAD_LOCAL size_t      arenaLimit = 0;
+static JPMCDS_THREAD_LOCAL int         arenaDepth = 0;
+
+
 /*
 ***************************************************************************
 ** Memory allocator.
@@ -24,24 +51,46 @@
 void* JpmcdsMallocSafe(size_t theSize)
 {
     static char routine[]="JpmcdsMallocSafe";
-    void *ptr;
+    TMemHeader *header = NULL;
+    size_t      sizeClass = ARENA_NO_CLASS;
+    size_t      blockSize = theSize;
 
     if (theSize <= 0)
     {
         JpmcdsErrMsg("%s: Number of bytes (%lu) must be at least 1.\n", routine, (unsigned long) theSize);
         return NULL;
     }
-    ptr = malloc(theSize);              /* Don't use calloc due to RS6000. */
-    if (ptr == NULL)
+
+    if (arenaDepth > 0 && theSize <= ARENA_CLASS_SIZE(ARENA_NB_CLASSES - 1))
     {
-        JpmcdsErrMsg("%s: Insufficient memory to allocate %lu bytes.\n",  routine, (unsigned long) theSize);
+        sizeClass = 0;
+        while (ARENA_CLASS_SIZE(sizeClass) < theSize)
+            ++sizeClass;
+        blockSize = ARENA_CLASS_SIZE(sizeClass);
+
+        header = arenaFree[sizeClass];
+        if (header != NULL)
+        {
+            arenaFree[sizeClass] = (header + 1)->next;
+            arenaBytes -= blockSize;
+        }
     }
-    else
+
+    if (header == NULL)
     {
-        /* Clear out the memory for safety. */
-        (void)memset((char *)ptr, (size_t)0, theSize);
+        header = (TMemHeader*) malloc(sizeof(TMemHeader) + blockSize); /* Don't use calloc due to RS6000. */
+        if (header == NULL)
+        {
+            JpmcdsErrMsg("%s: Insufficient memory to allocate %lu bytes.\n",  routine, (unsigned long) theSize);
+            return NULL;
+        }
     }
-    return ptr;
+
+    header->sizeClass = sizeClass;
+
+    /* Clear out the memory for safety. */
+    (void)memset((char *)(header + 1), (size_t)0, theSize);
+    return header + 1;
 }
 
 
@@ -52,7 +101,61 @@ void* JpmcdsMallocSafe(size_t theSize)
 */
 void JpmcdsFreeSafe(void *ptr)
 {
-   if (ptr != NULL)
-       free(ptr);
+    TMemHeader *header;
+
+    if (ptr == NULL)
+        return;
+
+    header = (TMemHeader*)ptr - 1;
+    if (arenaDepth > 0 && header->sizeClass != ARENA_NO_CLASS &&
+        arenaBytes + ARENA_CLASS_SIZE(header->sizeClass) <= arenaLimit)
+    {
+        (header + 1)->next = arenaFree[header->sizeClass];
+        arenaFree[header->sizeClass] = header;
+        arenaBytes += ARENA_CLASS_SIZE(header->sizeClass);
+        return;
+    }
+
+    free(header);
+}
+
+
+/*
+***************************************************************************
+** Starts the allocation arena on the calling thread.
+***************************************************************************
+*/
+void JpmcdsArenaStart(size_t maxBytes)
+{
+    if (arenaDepth++ == 0)
+    {
+        arenaBytes = 0;
+        arenaLimit = maxBytes;
+    }
 }
 
+
+/*
+***************************************************************************
+** Stops the allocation arena on the calling thread.
+***************************************************************************
+*/
+void JpmcdsArenaStop(void)
+{
+    int i;
+
+    if (arenaDepth == 0 || --arenaDepth > 0)
+        return;
+
+    for (i = 0; i < ARENA_NB_CLASSES; ++i)
+    {
+        while (arenaFree[i] != NULL)
+        {
+            TMemHeader *header = arenaFree[i];
+            arenaFree[i] = (header + 1)->next;
+            free(header);
+        }
+    }
+    arenaBytes = 0;
+    arenaLimit = 0;
+}
@@ -38,6 +38,37 @@ void* JpmcdsMallocSafe(size_t theSize);
 void JpmcdsFreeSafe(void *x);     /* (I) */
 
 
+/*
+** Bytes of released blocks an arena keeps for the pricing and bootstrap
+** routines which start one.
+*/
+#define JPMCDS_ARENA_SIZE (4*1024*1024)
+
+/*f
+***************************************************************************
+** Starts the allocation arena on the calling thread.
+**
+** Until the matching JpmcdsArenaStop, blocks of up to 64KB released by
+** JpmcdsFreeSafe on this thread are kept, up to maxBytes in all, and
+** handed out again by JpmcdsMallocSafe, so repeated pricings stop calling
+** malloc once warmed up. Blocks are ordinary heap memory, so anything
+** allocated under the arena can outlive it or be released on another
+** thread. Calls can be nested, in which case the outermost call sets
+** maxBytes.
+***************************************************************************
+*/
+void JpmcdsArenaStart(size_t maxBytes);  /* (I) Bytes of blocks kept */
+
+
+/*f
+***************************************************************************
+** Stops the allocation arena on the calling thread. The blocks it kept
+** are freed when the outermost arena stops.
+***************************************************************************
+*/
+void JpmcdsArenaStop(void);
+
+
 #ifdef __cplusplus
 }
 #endif
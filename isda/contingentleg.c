@@ -31,10 +31,13 @@ static int onePeriodIntegral
 (TDate             today,
  TDate             startDate,
  TDate             endDate,
- TCurve           *discountCurve,
- TCurve           *spreadCurve,
+ TCompiledCurve   *discountCurve,
+ TCompiledCurve   *spreadCurve,
  double            recoveryRate,
- double           *pv);
+ TLegPVCache      *cache,
+ int               rateIdx,
+ double           *pv,
+ double           *dpv);
 
 
 /*
@@ -47,10 +50,96 @@ static int onePeriodIntegralAtPayDate
  TDate             startDate,
  TDate             endDate,
  TDate             payDate, 
- TCurve           *discountCurve,
- TCurve           *spreadCurve,
+ TCompiledCurve   *discountCurve,
+ TCompiledCurve   *spreadCurve,
  double            recoveryRate,
- double           *pv);
+ int               rateIdx,
+ double           *pv,
+ double           *dpv);
+
+
+/*
+***************************************************************************
+** Computes the PV of a contingent leg and optionally its derivative.
+***************************************************************************
+*/
+static int contingentLegPV
+(TContingentLeg *cl,
+ TDate           today,
+ TDate           valueDate,
+ TDate           stepinDate,
+ TCurve         *discountCurve,
+ TCurve         *spreadCurve,
+ double          recoveryRate,
+ TLegPVCache    *cache,
+ int             rateIdx,
+ double         *pv,
+ double         *dpv);
+
+
+/*
+***************************************************************************
+** Derivative of log(S(date)/S(today)) with respect to the spread curve
+** rate at rateIdx.
+***************************************************************************
+*/
+static double logSurvivalDeriv
+(TCurve           *spreadCurve,
+ TDate             today,
+ TDate             date,
+ int               rateIdx);
+
+
+/*
+***************************************************************************
+** Adds weight times the derivatives of a one period integral with respect
+** to the discount and spread curve rates.
+***************************************************************************
+*/
+static int onePeriodIntegralGrad
+(TDate             today,
+ TDate             startDate,
+ TDate             endDate,
+ TCompiledCurve   *discountCurve,
+ TCompiledCurve   *spreadCurve,
+ double            recoveryRate,
+ TDateList        *criticalDates,
+ double            weight,
+ double           *discGrad,
+ double           *spreadGrad);
+
+
+/*
+***************************************************************************
+** Adds weight times the derivatives of a one period integral with payment
+** at a specific payment date with respect to the curve rates.
+***************************************************************************
+*/
+static int onePeriodIntegralAtPayDateGrad
+(TDate             today,
+ TDate             startDate,
+ TDate             endDate,
+ TDate             payDate,
+ TCompiledCurve   *discountCurve,
+ TCompiledCurve   *spreadCurve,
+ double            recoveryRate,
+ double            weight,
+ double           *discGrad,
+ double           *spreadGrad);
+
+
+/*
+***************************************************************************
+** Adds weight times the derivative of log(Z(date)/Z(today)) with respect
+** to the rates of a curve to grad. Does nothing if grad is NULL.
+***************************************************************************
+*/
+static int addLogPriceGrad
+(TCompiledCurve   *curve,
+ TDate             today,
+ TDate             date,
+ double            weight,
+ double           *grad);
 
 
 /*
@@ -72,13 +161,257 @@ int JpmcdsContingentLegPV
  TCurve         *spreadCurve,      /* (I) Spread curve                    */
  double          recoveryRate,     /* (I) Recovery rate                   */
  double         *pv)               /* (O) Present value of contingent leg */
+{
+    return contingentLegPV (cl,
+                            today,
+                            valueDate,
+                            stepinDate,
+                            discountCurve,
+                            spreadCurve,
+                            recoveryRate,
+                            NULL,
+                            -1,
+                            pv,
+                            NULL);
+}
+
+
+/*
+***************************************************************************
+** Computes the PV of a contingent leg together with its derivative with
+** respect to the rate at index rateIdx of the spread curve.
+**
+** The spread curve must hold continuously compounded ACT/365F rates.
+***************************************************************************
+*/
+int JpmcdsContingentLegPVRateDeriv
+(TContingentLeg *cl,               /* (I) Contingent leg                  */
+ TDate           today,            /* (I) No observations before today    */
+ TDate           valueDate,        /* (I) Value date for discounting      */
+ TDate           stepinDate,       /* (I) Step-in date                    */
+ TCurve         *discountCurve,    /* (I) Risk-free curve                 */
+ TCurve         *spreadCurve,      /* (I) Spread curve                    */
+ double          recoveryRate,     /* (I) Recovery rate                   */
+ int             rateIdx,          /* (I) Index of spread curve rate      */
+ double         *pv,               /* (O) Present value of contingent leg */
+ double         *dpv)              /* (O) Derivative of pv                */
+{
+    static char routine[] = "JpmcdsContingentLegPVRateDeriv";
+
+    if (dpv == NULL || rateIdx < 0 || spreadCurve == NULL ||
+        rateIdx >= spreadCurve->fNumItems)
+    {
+        JpmcdsErrMsg ("%s: Invalid rate index %d\n", routine, rateIdx);
+        return FAILURE;
+    }
+
+    return contingentLegPV (cl,
+                            today,
+                            valueDate,
+                            stepinDate,
+                            discountCurve,
+                            spreadCurve,
+                            recoveryRate,
+                            NULL,
+                            rateIdx,
+                            pv,
+                            dpv);
+}
+
+
+/*
+***************************************************************************
+** Computes the PV of a contingent leg reusing the part of the integral
+** observed on or before cache->fixedDate from earlier calls.
+**
+** The first call fills the cache. Later calls must use the same leg, dates
+** and curve dates, and spread curve rates may only have changed after
+** cache->fixedDate. If dpv is not NULL it returns the derivative with
+** respect to the rate at index rateIdx of the spread curve, which must not
+** affect the cached part.
+***************************************************************************
+*/
+int JpmcdsContingentLegPVCached
+(TContingentLeg *cl,               /* (I) Contingent leg                  */
+ TDate           today,            /* (I) No observations before today    */
+ TDate           valueDate,        /* (I) Value date for discounting      */
+ TDate           stepinDate,       /* (I) Step-in date                    */
+ TCurve         *discountCurve,    /* (I) Risk-free curve                 */
+ TCurve         *spreadCurve,      /* (I) Spread curve                    */
+ double          recoveryRate,     /* (I) Recovery rate                   */
+ TLegPVCache    *cache,            /* (I/O) Fixed part of the integral    */
+ int             rateIdx,          /* (I) Index of spread curve rate      */
+ double         *pv,               /* (O) Present value of contingent leg */
+ double         *dpv)              /* (O) Derivative of pv. Can be NULL   */
+{
+    static char routine[] = "JpmcdsContingentLegPVCached";
+
+    if (cache == NULL)
+    {
+        JpmcdsErrMsg ("%s: NULL cache\n", routine);
+        return FAILURE;
+    }
+
+    if (dpv != NULL && (rateIdx < 0 || spreadCurve == NULL ||
+        rateIdx >= spreadCurve->fNumItems))
+    {
+        JpmcdsErrMsg ("%s: Invalid rate index %d\n", routine, rateIdx);
+        return FAILURE;
+    }
+
+    return contingentLegPV (cl,
+                            today,
+                            valueDate,
+                            stepinDate,
+                            discountCurve,
+                            spreadCurve,
+                            recoveryRate,
+                            cache,
+                            rateIdx,
+                            pv,
+                            dpv);
+}
+
+
+/*
+***************************************************************************
+** Computes the PV of a contingent leg and adds weight times its derivatives
+** with respect to the continuously compounded ACT/365F rates of both curves
+** to discGrad and spreadGrad.
+**
+** This is a reverse sweep over the integral: each timeline segment hands
+** its sensitivities to the at most two curve points either side of its end
+** dates, so the cost is about that of one more pricing whatever the number
+** of curve points.
+***************************************************************************
+*/
+int JpmcdsContingentLegPVRateGrad
+(TContingentLeg *cl,               /* (I) Contingent leg                  */
+ TDate           today,            /* (I) No observations before today    */
+ TDate           valueDate,        /* (I) Value date for discounting      */
+ TDate           stepinDate,       /* (I) Step-in date                    */
+ TCurve         *discountCurve,    /* (I) Risk-free curve                 */
+ TCurve         *spreadCurve,      /* (I) Spread curve                    */
+ double          recoveryRate,     /* (I) Recovery rate                   */
+ TDateList      *criticalDates,    /* (I) Timeline of the leg. Can be NULL*/
+ double          weight,           /* (I) Multiplies the derivatives      */
+ double         *pv,               /* (O) Present value of contingent leg */
+ double         *discGrad,         /* (I/O) Discount rates. Can be NULL   */
+ double         *spreadGrad)       /* (I/O) Spread rates. Can be NULL     */
+{
+    static char routine[] = "JpmcdsContingentLegPVRateGrad";
+    int         status    = FAILURE;
+
+    double valueDatePv;
+    double scale;
+    TDate startDate;
+    TCompiledCurve discCC = {NULL};
+    TCompiledCurve spreadCC = {NULL};
+
+    int   offset;
+
+    if (contingentLegPV (cl,
+                         today,
+                         valueDate,
+                         stepinDate,
+                         discountCurve,
+                         spreadCurve,
+                         recoveryRate,
+                         NULL,
+                         -1,
+                         pv,
+                         NULL) != SUCCESS)
+        goto done;
+
+    if (JpmcdsCompiledCurveInit(&discCC, discountCurve) != SUCCESS ||
+        JpmcdsCompiledCurveInit(&spreadCC, spreadCurve) != SUCCESS)
+        goto done;
+
+    offset = (cl->protectStart ? 1 : 0);
+    startDate = MAX(cl->startDate, stepinDate - offset);
+    startDate = MAX(startDate, today - offset);
+
+    /* the pv is the integral as at today divided by the discount factor to
+       valueDate, so every part of the integral is scaled by the same */
+    valueDatePv = JpmcdsCompiledForwardZeroPrice (&discCC, today, valueDate);
+    scale = weight * cl->notional / valueDatePv;
+
+    switch (cl->payType)
+    {
+    case PROT_PAY_MAT:
+        if (onePeriodIntegralAtPayDateGrad (today,
+                                            startDate,
+                                            cl->endDate,
+                                            cl->endDate,
+                                            &discCC,
+                                            &spreadCC,
+                                            recoveryRate,
+                                            scale,
+                                            discGrad,
+                                            spreadGrad) != SUCCESS)
+            goto done;
+        break;
+    case PROT_PAY_DEF:
+        if (onePeriodIntegralGrad (today,
+                                   startDate,
+                                   cl->endDate,
+                                   &discCC,
+                                   &spreadCC,
+                                   recoveryRate,
+                                   criticalDates,
+                                   scale,
+                                   discGrad,
+                                   spreadGrad) != SUCCESS)
+            goto done;
+        break;
+    default:
+        JpmcdsErrMsg ("%s: Invalid payment type %d\n", routine, (int)cl->payType);
+        goto done;
+    }
+
+    if (addLogPriceGrad (&discCC, today, valueDate, -weight * *pv, discGrad) != SUCCESS)
+        goto done;
+
+    status = SUCCESS;
+
+ done:
+
+    if (status != SUCCESS)
+        JpmcdsErrMsgFailure (routine);
+
+    JpmcdsCompiledCurveClear(&discCC);
+    JpmcdsCompiledCurveClear(&spreadCC);
+    return status;
+}
+
+
+/*
+***************************************************************************
+** Computes the PV of a contingent leg and optionally its derivative.
+***************************************************************************
+*/
+static int contingentLegPV
+(TContingentLeg *cl,
+ TDate           today,
+ TDate           valueDate,
+ TDate           stepinDate,
+ TCurve         *discountCurve,
+ TCurve         *spreadCurve,
+ double          recoveryRate,
+ TLegPVCache    *cache,
+ int             rateIdx,
+ double         *pv,
+ double         *dpv)
 {
     static char routine[] = "JpmcdsContingentLegPV";
     int         status    = FAILURE;
 
     double myPv = 0.0;
+    double myDpv = 0.0;
     double valueDatePv;
     TDate startDate;
+    TCompiledCurve discCC = {NULL};
+    TCompiledCurve spreadCC = {NULL};
 
     int   offset;
 
@@ -101,6 +434,10 @@ int JpmcdsContingentLegPV
         goto done;
     }
 
+    if (JpmcdsCompiledCurveInit(&discCC, discountCurve) != SUCCESS ||
+        JpmcdsCompiledCurveInit(&spreadCC, spreadCurve) != SUCCESS)
+        goto done;
+
     offset = (cl->protectStart ? 1 : 0);
     startDate = MAX(cl->startDate, stepinDate - offset);
     startDate = MAX(startDate, today - offset);
@@ -110,32 +447,43 @@ int JpmcdsContingentLegPV
     case PROT_PAY_MAT:
         {
             double tmp;
+            double dtmp;
             if (onePeriodIntegralAtPayDate (today,
                                             startDate,
                                             cl->endDate,
                                             cl->endDate,
-                                            discountCurve,
-                                            spreadCurve,
+                                            &discCC,
+                                            &spreadCC,
                                             recoveryRate,
-                                            &tmp) != SUCCESS)
+                                            rateIdx,
+                                            &tmp,
+                                            dpv == NULL ? NULL : &dtmp) != SUCCESS)
                 goto done;
             
             myPv += tmp * cl->notional;
+            if (dpv != NULL)
+                myDpv += dtmp * cl->notional;
         }
         break;
     case PROT_PAY_DEF:
         {
             double tmp;
+            double dtmp;
             if (onePeriodIntegral (today,
                                    startDate,
                                    cl->endDate,
-                                   discountCurve,
-                                   spreadCurve,
+                                   &discCC,
+                                   &spreadCC,
                                    recoveryRate,
-                                   &tmp) != SUCCESS)
+                                   cache,
+                                   rateIdx,
+                                   &tmp,
+                                   dpv == NULL ? NULL : &dtmp) != SUCCESS)
             goto done;
             
             myPv += tmp * cl->notional;
+            if (dpv != NULL)
+                myDpv += dtmp * cl->notional;
         }
         break;
     default:
@@ -144,16 +492,20 @@ int JpmcdsContingentLegPV
     }
 
     /* myPv has been calculated as at today - need it at valueDate */
-    valueDatePv = JpmcdsForwardZeroPrice (discountCurve, today, valueDate);
+    valueDatePv = JpmcdsCompiledForwardZeroPrice (&discCC, today, valueDate);
 
     status = SUCCESS;
     *pv    = myPv / valueDatePv;
+    if (dpv != NULL)
+        *dpv = myDpv / valueDatePv;
 
  done:
 
     if (status != SUCCESS)
         JpmcdsErrMsgFailure (routine);
 
+    JpmcdsCompiledCurveClear(&discCC);
+    JpmcdsCompiledCurveClear(&spreadCC);
     return status;
 }
 
@@ -167,16 +519,21 @@ static int onePeriodIntegral
 (TDate             today,
  TDate             startDate,
  TDate             endDate,
- TCurve           *discCurve,
- TCurve           *spreadCurve,
+ TCompiledCurve   *discCurve,
+ TCompiledCurve   *spreadCurve,
  double            recoveryRate,
- double           *pv)
+ TLegPVCache      *cache,
+ int               rateIdx,
+ double           *pv,
+ double           *dpv)
 {
     static char routine[] = "onePeriodIntegral";
     int         status    = FAILURE;
 
     double  myPv = 0.0;
+    double  myDpv = 0.0;
     int     i;
+    int     first = 1; /* first timeline segment to integrate */
 
     double t;
     double s0;
@@ -184,6 +541,8 @@ static int onePeriodIntegral
     double df0;
     double df1;
     double loss;
+    double a0 = 0.0; /* derivatives of log(s0) and log(s1) */
+    double a1 = 0.0;
 
     TDateList *tl = NULL;
 
@@ -198,7 +557,10 @@ static int onePeriodIntegral
         goto success;
     }
 
-    tl = JpmcdsRiskyTimeLine (startDate, endDate, discCurve, spreadCurve);
+    if (cache != NULL)
+        tl = JpmcdsLegPVCacheTimeLine (cache, startDate, endDate, discCurve->curve, spreadCurve->curve);
+    else
+        tl = JpmcdsRiskyTimeLine (startDate, endDate, discCurve->curve, spreadCurve->curve);
     if (tl == NULL)
         goto done;
 
@@ -212,21 +574,37 @@ static int onePeriodIntegral
        exact integral
     */
 
-    s1  = JpmcdsForwardZeroPrice(spreadCurve, today, startDate);
-    df1 = JpmcdsForwardZeroPrice(discCurve, today, MAX(today, startDate));
     loss = 1.0 - recoveryRate;
+    if (cache != NULL && cache->valid && cache->nbFixed > 0)
+    {
+        /* segments up to the fixed date have been integrated before */
+        first = cache->nbFixed + 1;
+        myPv  = cache->pv;
+        s1    = cache->survival;
+        df1   = cache->discount;
+    }
+    else
+    {
+        s1  = JpmcdsCompiledForwardZeroPrice(spreadCurve, today, startDate);
+        df1 = JpmcdsCompiledForwardZeroPrice(discCurve, today, MAX(today, startDate));
+    }
+    if (dpv != NULL)
+        a1 = logSurvivalDeriv(spreadCurve->curve, today, tl->fArray[first-1], rateIdx);
 
-    for (i = 1; i < tl->fNumItems; ++i)
+    for (i = first; i < tl->fNumItems; ++i)
     {
         double lambda;
         double fwdRate;
         double thisPv = 0.;
 		double lambdafwdRate;
+        double g;  /* (1 - exp(-x)) / x with x = lambdafwdRate */
+        double dg; /* derivative of g with respect to x */
 
         s0  = s1;
         df0 = df1;
-        s1  = JpmcdsForwardZeroPrice(spreadCurve, today, tl->fArray[i]);
-        df1 = JpmcdsForwardZeroPrice(discCurve, today, tl->fArray[i]);
+        a0  = a1;
+        s1  = JpmcdsCompiledForwardZeroPrice(spreadCurve, today, tl->fArray[i]);
+        df1 = JpmcdsCompiledForwardZeroPrice(discCurve, today, tl->fArray[i]);
         t   = (double)(tl->fArray[i] - tl->fArray[i-1])/365.0;
         
 		/*************************Markit Proposed Fix***************************************************
@@ -266,19 +644,59 @@ static int onePeriodIntegral
 		}
         
         myPv += thisPv;
+
+        if (cache != NULL && !cache->valid && tl->fArray[i] <= cache->fixedDate)
+        {
+            cache->nbFixed  = i;
+            cache->pv       = myPv;
+            cache->survival = s1;
+            cache->discount = df1;
+        }
+
+        if (dpv != NULL)
+        {
+            /* thisPv = loss . lambda . g(x) . s0 . df0 where both lambda and
+               x move by a0 - a1 and s0 moves by s0 . a0 */
+            double x = lambdafwdRate;
+            double dlambda;
+
+            a1 = logSurvivalDeriv(spreadCurve->curve, today, tl->fArray[i], rateIdx);
+            dlambda = a0 - a1;
+
+            if (fabs(x) > 1.e-4)
+            {
+                double ex = exp(-x);
+                g  = (1.0 - ex) / x;
+                dg = (ex * (1.0 + x) - 1.0) / (x * x);
+            }
+            else
+            {
+                g  = 1.0 - x * (0.5 - x * (1./6. - x * (1./24. - x / 120.)));
+                dg = -0.5 + x * (1./3. - x * (0.125 - x / 30.));
+            }
+
+            myDpv += loss * s0 * df0 *
+                (dlambda * (g + lambda * dg) + lambda * g * a0);
+        }
     }
 
+    if (cache != NULL)
+        cache->valid = TRUE;
+
  success:
 
     status = SUCCESS;
     *pv = myPv;
+    if (dpv != NULL)
+        *dpv = myDpv;
         
  done:
 
     if (status != SUCCESS)
         JpmcdsErrMsgFailure (routine);
 
-    JpmcdsFreeDateList (tl);
+    if (cache == NULL)
+        JpmcdsFreeDateList (tl);
     return status;
 }
 
@@ -294,10 +712,12 @@ static int onePeriodIntegralAtPayDate
  TDate             startDate,
  TDate             endDate,
  TDate             payDate, 
- TCurve           *discCurve,
- TCurve           *spreadCurve,
+ TCompiledCurve   *discCurve,
+ TCompiledCurve   *spreadCurve,
  double            recoveryRate,
- double           *pv)
+ int               rateIdx,
+ double           *pv,
+ double           *dpv)
 {
     static char routine[] = "onePeriodIntegralAtPayDate";
     int         status    = FAILURE;
@@ -315,14 +735,21 @@ static int onePeriodIntegralAtPayDate
     if (today > endDate)
     {
         *pv = 0.0;
+        if (dpv != NULL)
+            *dpv = 0.0;
     }
     else
     {
-        s0  = JpmcdsForwardZeroPrice(spreadCurve, today, startDate);
-        s1  = JpmcdsForwardZeroPrice(spreadCurve, today, endDate);
-        df  = JpmcdsForwardZeroPrice(discCurve, today, payDate);
+        s0  = JpmcdsCompiledForwardZeroPrice(spreadCurve, today, startDate);
+        s1  = JpmcdsCompiledForwardZeroPrice(spreadCurve, today, endDate);
+        df  = JpmcdsCompiledForwardZeroPrice(discCurve, today, payDate);
         loss = 1.0 - recoveryRate;
         *pv = (s0 - s1) * df * loss;
+        if (dpv != NULL)
+        {
+            *dpv = (s0 * logSurvivalDeriv(spreadCurve->curve, today, startDate, rateIdx) -
+                    s1 * logSurvivalDeriv(spreadCurve->curve, today, endDate, rateIdx)) * df * loss;
+        }
     }
 
     status = SUCCESS;
@@ -334,3 +761,218 @@ static int onePeriodIntegralAtPayDate
     
     return status;
 }
+
+
+/*
+***************************************************************************
+** Derivative of log(S(date)/S(today)) with respect to the spread curve
+** rate at rateIdx.
+***************************************************************************
+*/
+static double logSurvivalDeriv
+(TCurve           *spreadCurve,
+ TDate             today,
+ TDate             date,
+ int               rateIdx)
+{
+    return JpmcdsZeroPriceRateDeriv(spreadCurve, date, rateIdx) -
+        JpmcdsZeroPriceRateDeriv(spreadCurve, today, rateIdx);
+}
+
+
+/*
+***************************************************************************
+** Adds weight times the derivatives of a one period integral with respect
+** to the discount and spread curve rates.
+**
+** Each segment of the timeline integrates loss . lambda . g(x) . s0 . df0
+** with lambda = L0 - L1, x = lambda + D0 - D1 and L, D the logs of the
+** survival probability and discount factor at the ends of the segment.
+** The sensitivities to L and D at each timeline date are accumulated over
+** the two segments sharing it and then handed to the curve points.
+***************************************************************************
+*/
+static int onePeriodIntegralGrad
+(TDate             today,
+ TDate             startDate,
+ TDate             endDate,
+ TCompiledCurve   *discCurve,
+ TCompiledCurve   *spreadCurve,
+ double            recoveryRate,
+ TDateList        *criticalDates,
+ double            weight,
+ double           *discGrad,
+ double           *spreadGrad)
+{
+    static char routine[] = "onePeriodIntegralGrad";
+    int         status    = FAILURE;
+
+    int     i;
+
+    double s0;
+    double s1;
+    double df0;
+    double df1;
+    double loss;
+    double bL1 = 0.0; /* sensitivities to L and D at the current date */
+    double bD1 = 0.0;
+    TDate  sDate1;    /* dates at which L and D are observed */
+    TDate  dDate1;
+
+    TDateList *tl = NULL;
+
+    REQUIRE (endDate > startDate);
+    REQUIRE (discCurve != NULL);
+    REQUIRE (spreadCurve != NULL);
+
+    if (today > endDate)
+        goto success;
+
+    if (criticalDates != NULL)
+        tl = criticalDates;
+    else
+    {
+        tl = JpmcdsRiskyTimeLine (startDate, endDate, discCurve->curve, spreadCurve->curve);
+        if (tl == NULL)
+            goto done;
+    }
+
+    loss   = 1.0 - recoveryRate;
+    sDate1 = startDate;
+    dDate1 = MAX(today, startDate);
+    s1     = JpmcdsCompiledForwardZeroPrice(spreadCurve, today, sDate1);
+    df1    = JpmcdsCompiledForwardZeroPrice(discCurve, today, dDate1);
+
+    for (i = 1; i < tl->fNumItems; ++i)
+    {
+        double lambda;
+        double x;
+        double g;  /* (1 - exp(-x)) / x */
+        double dg; /* derivative of g with respect to x */
+        double p;
+
+        s0  = s1;
+        df0 = df1;
+        s1  = JpmcdsCompiledForwardZeroPrice(spreadCurve, today, tl->fArray[i]);
+        df1 = JpmcdsCompiledForwardZeroPrice(discCurve, today, tl->fArray[i]);
+
+        lambda = log(s0) - log(s1);
+        x      = lambda + log(df0) - log(df1) + 1.0e-50;
+
+        if (fabs(x) > 1.e-4)
+        {
+            double ex = exp(-x);
+            g  = (1.0 - ex) / x;
+            dg = (ex * (1.0 + x) - 1.0) / (x * x);
+        }
+        else
+        {
+            g  = 1.0 - x * (0.5 - x * (1./6. - x * (1./24. - x / 120.)));
+            dg = -0.5 + x * (1./3. - x * (0.125 - x / 30.));
+        }
+
+        p = weight * loss * s0 * df0;
+
+        /* the start of this segment is complete */
+        bL1 += p * (g + lambda * dg + lambda * g);
+        bD1 += p * lambda * (dg + g);
+        if (addLogPriceGrad (spreadCurve, today, sDate1, bL1, spreadGrad) != SUCCESS ||
+            addLogPriceGrad (discCurve, today, dDate1, bD1, discGrad) != SUCCESS)
+            goto done;
+
+        bL1    = -p * (g + lambda * dg);
+        bD1    = -p * lambda * dg;
+        sDate1 = tl->fArray[i];
+        dDate1 = tl->fArray[i];
+    }
+
+    if (addLogPriceGrad (spreadCurve, today, sDate1, bL1, spreadGrad) != SUCCESS ||
+        addLogPriceGrad (discCurve, today, dDate1, bD1, discGrad) != SUCCESS)
+        goto done;
+
+ success:
+
+    status = SUCCESS;
+
+ done:
+
+    if (status != SUCCESS)
+        JpmcdsErrMsgFailure (routine);
+
+    if (tl != criticalDates)
+        JpmcdsFreeDateList (tl);
+    return status;
+}
+
+
+/*
+***************************************************************************
+** Adds weight times the derivatives of a one period integral with payment
+** at a specific payment date with respect to the curve rates.
+***************************************************************************
+*/
+static int onePeriodIntegralAtPayDateGrad
+(TDate             today,
+ TDate             startDate,
+ TDate             endDate,
+ TDate             payDate,
+ TCompiledCurve   *discCurve,
+ TCompiledCurve   *spreadCurve,
+ double            recoveryRate,
+ double            weight,
+ double           *discGrad,
+ double           *spreadGrad)
+{
+    static char routine[] = "onePeriodIntegralAtPayDateGrad";
+    int         status    = FAILURE;
+
+    double df;
+    double s0;
+    double s1;
+    double loss;
+
+    REQUIRE (endDate > startDate);
+    REQUIRE (discCurve != NULL);
+    REQUIRE (spreadCurve != NULL);
+
+    if (today <= endDate)
+    {
+        s0  = JpmcdsCompiledForwardZeroPrice(spreadCurve, today, startDate);
+        s1  = JpmcdsCompiledForwardZeroPrice(spreadCurve, today, endDate);
+        df  = JpmcdsCompiledForwardZeroPrice(discCurve, today, payDate);
+        loss = weight * (1.0 - recoveryRate);
+
+        if (addLogPriceGrad (spreadCurve, today, startDate, s0 * df * loss, spreadGrad) != SUCCESS ||
+            addLogPriceGrad (spreadCurve, today, endDate, -s1 * df * loss, spreadGrad) != SUCCESS ||
+            addLogPriceGrad (discCurve, today, payDate, (s0 - s1) * df * loss, discGrad) != SUCCESS)
+            goto done;
+    }
+
+    status = SUCCESS;
+
+ done:
+
+    if (status != SUCCESS)
+        JpmcdsErrMsgFailure (routine);
+
+    return status;
+}
+
+
+/*
+***************************************************************************
+** Adds weight times the derivative of log(Z(date)/Z(today)) with respect
+** to the rates of a curve to grad. Does nothing if grad is NULL.
+***************************************************************************
+*/
+static int addLogPriceGrad
+(TCompiledCurve   *curve,
+ TDate             today,
+ TDate             date,
+ double            weight,
+ double           *grad)
+{
+    if (grad == NULL)
+        return SUCCESS;
+    return JpmcdsForwardZeroPriceRateGrad(curve->curve, today, date, weight, grad);
+}
@@ -38,6 +38,78 @@ int JpmcdsContingentLegPV
  double          recoveryRate,     /* (I) Recovery rate                   */
  double         *pv);              /* (O) Present value of contingent leg */
 
+
+/*f
+***************************************************************************
+** Computes the PV of a contingent leg together with its derivative with
+** respect to the rate at index rateIdx of the spread curve.
+**
+** The spread curve must hold continuously compounded ACT/365F rates.
+***************************************************************************
+*/
+int JpmcdsContingentLegPVRateDeriv
+(TContingentLeg *cl,               /* (I) Contingent leg                  */
+ TDate           today,            /* (I) No observations before today    */
+ TDate           valueDate,        /* (I) Value date for discounting      */
+ TDate           stepinDate,       /* (I) Step-in date                    */
+ TCurve         *discountCurve,    /* (I) Risk-free curve                 */
+ TCurve         *spreadCurve,      /* (I) Spread curve                    */
+ double          recoveryRate,     /* (I) Recovery rate                   */
+ int             rateIdx,          /* (I) Index of spread curve rate      */
+ double         *pv,               /* (O) Present value of contingent leg */
+ double         *dpv);             /* (O) Derivative of pv                */
+
+
+/*f
+***************************************************************************
+** Computes the PV of a contingent leg reusing the part of the integral
+** observed on or before cache->fixedDate from earlier calls.
+**
+** The first call fills the cache. Later calls must use the same leg, dates
+** and curve dates, and spread curve rates may only have changed after
+** cache->fixedDate. If dpv is not NULL it returns the derivative with
+** respect to the rate at index rateIdx of the spread curve, which must not
+** affect the cached part.
+***************************************************************************
+*/
+int JpmcdsContingentLegPVCached
+(TContingentLeg *cl,               /* (I) Contingent leg                  */
+ TDate           today,            /* (I) No observations before today    */
+ TDate           valueDate,        /* (I) Value date for discounting      */
+ TDate           stepinDate,       /* (I) Step-in date                    */
+ TCurve         *discountCurve,    /* (I) Risk-free curve                 */
+ TCurve         *spreadCurve,      /* (I) Spread curve                    */
+ double          recoveryRate,     /* (I) Recovery rate                   */
+ TLegPVCache    *cache,            /* (I/O) Fixed part of the integral    */
+ int             rateIdx,          /* (I) Index of spread curve rate      */
+ double         *pv,               /* (O) Present value of contingent leg */
+ double         *dpv);             /* (O) Derivative of pv. Can be NULL   */
+
+
+/*f
+***************************************************************************
+** Computes the PV of a contingent leg and adds weight times its derivatives
+** with respect to the continuously compounded ACT/365F rates of the
+** discount and spread curves to discGrad and spreadGrad, arrays of the
+** size of each curve.
+**
+** All derivatives come from a single reverse sweep over the integral.
+***************************************************************************
+*/
+int JpmcdsContingentLegPVRateGrad
+(TContingentLeg *cl,               /* (I) Contingent leg                  */
+ TDate           today,            /* (I) No observations before today    */
+ TDate           valueDate,        /* (I) Value date for discounting      */
+ TDate           stepinDate,       /* (I) Step-in date                    */
+ TCurve         *discountCurve,    /* (I) Risk-free curve                 */
+ TCurve         *spreadCurve,      /* (I) Spread curve                    */
+ double          recoveryRate,     /* (I) Recovery rate                   */
+ TDateList      *criticalDates,    /* (I) Timeline of the leg. Can be NULL*/
+ double          weight,           /* (I) Multiplies the derivatives      */
+ double         *pv,               /* (O) Present value of contingent leg */
+ double         *discGrad,         /* (I/O) Discount rates. Can be NULL   */
+ double         *spreadGrad);      /* (I/O) Spread rates. Can be NULL     */
+
 #ifdef __cplusplus
 }
 #endif
@@ -148,14 +148,15 @@ done:
 ***************************************************************************
 ** Formats a TDate for printing. The print format is YYYYMMDD. 
 ** Can be called eight times from the same print statement, but not more.
+** Each thread has its own buffers.
 ***************************************************************************
 */
 char* JpmcdsFormatDate(TDate date) /* (I) */
 {
-    static int ibuf;
+    static JPMCDS_THREAD_LOCAL int ibuf;
 #define MAX_STR_LEN 16
 #define MAX_AT_ONCE 8                  /* Must be a power of 2 */
-    static char format[MAX_AT_ONCE][MAX_STR_LEN];
+    static JPMCDS_THREAD_LOCAL char format[MAX_AT_ONCE][MAX_STR_LEN];
     TMonthDayYear mdy;
     ibuf = (ibuf+1)&(MAX_AT_ONCE-1); /* Toggle buffers */
 
@@ -192,13 +193,14 @@ char* JpmcdsFormatDate(TDate date) /* (I) */
 ***************************************************************************
 ** Formats a TDateInterval.
 ** Can be called twice from the same print statement, but not more.
+** Each thread has its own buffers.
 ***************************************************************************
 */
 char* JpmcdsFormatDateInterval(TDateInterval *interval) /* (I) */
 {
-    static int ibuf;
+    static JPMCDS_THREAD_LOCAL int ibuf;
 #define MAX_STR_LEN 16
-    static char format[2][MAX_STR_LEN];
+    static JPMCDS_THREAD_LOCAL char format[2][MAX_STR_LEN];
     char periodType;
     int numPeriods;
 
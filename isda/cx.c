@@ -14,6 +14,7 @@
 #include "tcurve.h"
 #include "macros.h"
 #include "cerror.h"
+#include "dtlist.h"
 
 
 /*
@@ -228,3 +229,57 @@ void JpmcdsFeeLegFree(TFeeLeg *p)
         FREE(p);
     }
 }
+
+
+/*
+***************************************************************************
+** Initialises an empty TLegPVCache for observations up to fixedDate.
+***************************************************************************
+*/
+void JpmcdsLegPVCacheInit(TLegPVCache *p, TDate fixedDate)
+{
+    p->fixedDate = fixedDate;
+    p->valid     = FALSE;
+    p->tl        = NULL;
+    p->tlSize    = 0;
+    p->nbFixed   = 0;
+    p->pv        = 0.0;
+    p->survival  = 1.0;
+    p->discount  = 1.0;
+}
+
+
+/*
+***************************************************************************
+** Empties a TLegPVCache for the next leg, with observations up to
+** fixedDate, keeping the timeline allocation.
+***************************************************************************
+*/
+void JpmcdsLegPVCacheReset(TLegPVCache *p, TDate fixedDate)
+{
+    p->fixedDate = fixedDate;
+    p->valid     = FALSE;
+    p->nbFixed   = 0;
+    p->pv        = 0.0;
+    p->survival  = 1.0;
+    p->discount  = 1.0;
+    if (p->tl != NULL)
+        p->tl->fNumItems = 0; /* refilled by the next pricing */
+}
+
+
+/*
+***************************************************************************
+** Releases the contents of a TLegPVCache.
+***************************************************************************
+*/
+void JpmcdsLegPVCacheClear(TLegPVCache *p)
+{
+    if (p != NULL)
+    {
+        JpmcdsFreeDateList(p->tl);
+        p->tl     = NULL;
+        p->tlSize = 0;
+        p->valid  = FALSE;
+    }
+}
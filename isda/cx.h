@@ -83,6 +83,31 @@ typedef struct _TFeeLeg
     TBoolean        obsStartOfDay;
 } TFeeLeg;
 
+/** Part of the PV of a leg which is observed on or before a fixed date.
+    While a bootstrap solves for spread curve rates after that date this part
+    does not change, so it is computed by the first pricing of the leg and
+    reused by the following ones. */
+typedef struct _TLegPVCache
+{
+    /** Observations on or before this date are cached. */
+    TDate           fixedDate;
+    /** Set once a pricing has filled the cache. */
+    TBoolean        valid;
+    /** Timeline of the leg. Can be NULL. */
+    TDateList      *tl;
+    /** Number of dates allocated for tl. JpmcdsLegPVCacheReset keeps the
+        allocation and the next pricing refills it. */
+    int             tlSize;
+    /** Number of timeline segments or fee payments in the cached part. */
+    int             nbFixed;
+    /** PV of the cached part as at today. */
+    double          pv;
+    /** Survival probability at the end of the cached part. */
+    double          survival;
+    /** Discount factor at the end of the cached part. */
+    double          discount;
+} TLegPVCache;
+
 
 /*f
 ***************************************************************************
@@ -116,6 +141,31 @@ TBoolean        protectStart         /* (I) */
 void JpmcdsFeeLegFree(TFeeLeg *p);
 
 
+/*f
+***************************************************************************
+** Initialises an empty TLegPVCache for observations up to fixedDate.
+***************************************************************************
+*/
+void JpmcdsLegPVCacheInit(TLegPVCache *p, TDate fixedDate);
+
+
+/*f
+***************************************************************************
+** Empties a TLegPVCache for the next leg, with observations up to
+** fixedDate, keeping the timeline allocation.
+***************************************************************************
+*/
+void JpmcdsLegPVCacheReset(TLegPVCache *p, TDate fixedDate);
+
+
+/*f
+***************************************************************************
+** Releases the contents of a TLegPVCache.
+***************************************************************************
+*/
+void JpmcdsLegPVCacheClear(TLegPVCache *p);
+
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
@@ -159,6 +159,394 @@ double JpmcdsZeroRate
 }
 
 
+/*
+***************************************************************************
+** Calculates the derivative of the log of the zero price for a given date
+** with respect to the rate at index idx of the curve. The curve must hold
+** continuously compounded ACT/365F rates, so that the derivative follows
+** directly from the flat forward interpolation used by JpmcdsZeroRate.
+**
+** Returns NaN for errors.
+***************************************************************************
+*/
+double JpmcdsZeroPriceRateDeriv
+(TCurve* zeroCurve,
+ TDate   date,
+ int     idx)
+{
+    static char routine[] = "JpmcdsZeroPriceRateDeriv";
+    int         status    = FAILURE;
+
+    long        exact;
+    long        lo;
+    long        hi;
+    long        t;
+    double      deriv = 0.0;
+
+    REQUIRE (zeroCurve != NULL);
+    REQUIRE (zeroCurve->fNumItems > 0);
+    REQUIRE (zeroCurve->fArray != NULL);
+    REQUIRE (idx >= 0 && idx < zeroCurve->fNumItems);
+    REQUIRE (IS_EQUAL(zeroCurve->fBasis, JPMCDS_CONTINUOUS_BASIS));
+    REQUIRE (zeroCurve->fDayCountConv == JPMCDS_ACT_365F);
+
+    t = date - zeroCurve->fBaseDate;
+    if (t == 0)
+    {
+        /* the zero price on the base date is always one */
+        goto success;
+    }
+
+    if (JpmcdsBinarySearchLong (date,
+                            &zeroCurve->fArray[0].fDate,
+                            sizeof(TRatePt),
+                            zeroCurve->fNumItems,
+                            &exact,
+                            &lo,
+                            &hi) != SUCCESS) 
+        goto done;
+
+    if (exact >= 0)
+    {
+        /* date found in zeroDates */
+        if (exact == idx)
+            deriv = -t / 365.0;
+    }
+    else if (lo < 0 || zeroCurve->fNumItems == 1)
+    {
+        /* date before start of zeroDates or single point curve */
+        if (idx == 0)
+            deriv = -t / 365.0;
+    }
+    else
+    {
+        long   t1;
+        long   t2;
+        double w;
+
+        if (hi >= zeroCurve->fNumItems)
+        {
+            /* extrapolate using last flat segment of the curve */
+            lo = zeroCurve->fNumItems-2;
+            hi = zeroCurve->fNumItems-1;
+        }
+
+        /* (zt) is linear in t between the two points, see zcInterpRate */
+        t1 = zeroCurve->fArray[lo].fDate - zeroCurve->fBaseDate;
+        t2 = zeroCurve->fArray[hi].fDate - zeroCurve->fBaseDate;
+        w  = (double)(t - t1) / (double)(t2 - t1);
+
+        if (idx == hi)
+            deriv = -t2 * w / 365.0;
+        else if (idx == lo)
+            deriv = -t1 * (1.0 - w) / 365.0;
+    }
+
+success:
+    status = SUCCESS;
+
+ done:
+
+    if (status != SUCCESS)
+    {
+        JpmcdsErrMsgFailure (routine);
+        return NaN;
+    }
+
+    return deriv;
+}
+
+
+/*
+***************************************************************************
+** Adds weight times the derivative of the log of the zero price for a given
+** date with respect to the continuously compounded ACT/365F rate at every
+** point of the curve to grad, an array of size zeroCurve->fNumItems.
+**
+** This is the adjoint of JpmcdsZeroPrice. At most two points of the curve
+** move the price of any date, so the cost does not depend on the size of
+** the curve beyond the binary search. The rates of the curve may be held
+** on any basis since interpolation always uses the continuous rates.
+***************************************************************************
+*/
+int JpmcdsZeroPriceRateGrad
+(TCurve* zeroCurve,
+ TDate   date,
+ double  weight,
+ double *grad)
+{
+    static char routine[] = "JpmcdsZeroPriceRateGrad";
+    int         status    = FAILURE;
+
+    long        exact;
+    long        lo;
+    long        hi;
+    long        t;
+
+    REQUIRE (zeroCurve != NULL);
+    REQUIRE (zeroCurve->fNumItems > 0);
+    REQUIRE (zeroCurve->fArray != NULL);
+    REQUIRE (grad != NULL);
+
+    t = date - zeroCurve->fBaseDate;
+    if (t == 0 || weight == 0.0)
+    {
+        /* the zero price on the base date is always one */
+        goto success;
+    }
+
+    if (JpmcdsBinarySearchLong (date,
+                            &zeroCurve->fArray[0].fDate,
+                            sizeof(TRatePt),
+                            zeroCurve->fNumItems,
+                            &exact,
+                            &lo,
+                            &hi) != SUCCESS) 
+        goto done;
+
+    if (exact >= 0)
+    {
+        /* date found in zeroDates */
+        grad[exact] -= weight * t / 365.0;
+    }
+    else if (lo < 0 || zeroCurve->fNumItems == 1)
+    {
+        /* date before start of zeroDates or single point curve */
+        grad[0] -= weight * t / 365.0;
+    }
+    else
+    {
+        long   t1;
+        long   t2;
+        double w;
+
+        if (hi >= zeroCurve->fNumItems)
+        {
+            /* extrapolate using last flat segment of the curve */
+            lo = zeroCurve->fNumItems-2;
+            hi = zeroCurve->fNumItems-1;
+        }
+
+        /* (zt) is linear in t between the two points, see zcInterpRate */
+        t1 = zeroCurve->fArray[lo].fDate - zeroCurve->fBaseDate;
+        t2 = zeroCurve->fArray[hi].fDate - zeroCurve->fBaseDate;
+        w  = (double)(t - t1) / (double)(t2 - t1);
+
+        grad[hi] -= weight * t2 * w / 365.0;
+        grad[lo] -= weight * t1 * (1.0 - w) / 365.0;
+    }
+
+success:
+    status = SUCCESS;
+
+ done:
+
+    if (status != SUCCESS)
+        JpmcdsErrMsgFailure (routine);
+
+    return status;
+}
+
+
+/*
+***************************************************************************
+** Adds weight times the derivative of the log of the forward zero price
+** between two dates to grad. Adjoint of JpmcdsForwardZeroPrice.
+***************************************************************************
+*/
+int JpmcdsForwardZeroPriceRateGrad
+(TCurve* zeroCurve,
+ TDate   startDate,
+ TDate   maturityDate,
+ double  weight,
+ double *grad)
+{
+    if (JpmcdsZeroPriceRateGrad (zeroCurve, maturityDate, weight, grad) != SUCCESS ||
+        JpmcdsZeroPriceRateGrad (zeroCurve, startDate, -weight, grad) != SUCCESS)
+    {
+        JpmcdsErrMsgFailure ("JpmcdsForwardZeroPriceRateGrad");
+        return FAILURE;
+    }
+    return SUCCESS;
+}
+
+
+/*
+***************************************************************************
+** Compiles a zero curve for repeated lookups.
+**
+** Curves whose dates are not strictly increasing are not compiled, and
+** lookups then go through the curve itself.
+***************************************************************************
+*/
+int JpmcdsCompiledCurveInit
+(TCompiledCurve *cc,
+ TCurve         *zeroCurve)
+{
+    static char routine[] = "JpmcdsCompiledCurveInit";
+    int         status    = FAILURE;
+
+    int         n;
+    int         i;
+
+    REQUIRE (cc != NULL);
+    REQUIRE (zeroCurve != NULL);
+    REQUIRE (zeroCurve->fNumItems > 0);
+    REQUIRE (zeroCurve->fArray != NULL);
+
+    n = zeroCurve->fNumItems;
+
+    cc->curve      = zeroCurve;
+    cc->baseDate   = zeroCurve->fBaseDate;
+    cc->numItems   = 0;
+    cc->t          = NULL;
+    cc->z          = NULL;
+    cc->zt         = NULL;
+    cc->cursor     = 0;
+    cc->startDate  = zeroCurve->fBaseDate;
+    cc->startPrice = 0.0;
+
+    for (i = 1; i < n; ++i)
+    {
+        if (zeroCurve->fArray[i].fDate <= zeroCurve->fArray[i-1].fDate)
+            goto success;
+    }
+
+    cc->t  = NEW_ARRAY(long, n);
+    cc->z  = NEW_ARRAY(double, 2*n);
+    if (cc->t == NULL || cc->z == NULL)
+        goto done;
+    cc->zt = cc->z + n;
+
+    for (i = 0; i < n; ++i)
+    {
+        if (zcRateCC (zeroCurve, i, &cc->z[i]) != SUCCESS)
+            goto done;
+        cc->t[i]  = zeroCurve->fArray[i].fDate - cc->baseDate;
+        cc->zt[i] = cc->z[i] * cc->t[i];
+    }
+    cc->numItems = n;
+
+ success:
+
+    cc->startPrice = JpmcdsCompiledZeroPrice(cc, cc->startDate);
+    status = SUCCESS;
+
+ done:
+
+    if (status != SUCCESS)
+    {
+        JpmcdsCompiledCurveClear(cc);
+        JpmcdsErrMsgFailure (routine);
+    }
+
+    return status;
+}
+
+
+/*
+***************************************************************************
+** Releases the contents of a TCompiledCurve.
+***************************************************************************
+*/
+void JpmcdsCompiledCurveClear
+(TCompiledCurve *cc)
+{
+    if (cc != NULL)
+    {
+        FREE(cc->t);
+        FREE(cc->z);
+        cc->t        = NULL;
+        cc->z        = NULL;
+        cc->zt       = NULL;
+        cc->numItems = 0;
+    }
+}
+
+
+/*
+***************************************************************************
+** Calculates the zero price for a given date from a compiled curve.
+**
+** Repeats the arithmetic of JpmcdsZeroRate and zcInterpRate on the
+** precomputed rates, so the result is identical to JpmcdsZeroPrice. The
+** segment is found by moving the cursor from the previous lookup.
+***************************************************************************
+*/
+double JpmcdsCompiledZeroPrice
+(TCompiledCurve *cc,
+ TDate           date)
+{
+    long   *ts = cc->t;
+    long    t  = date - cc->baseDate;
+    int     n  = cc->numItems;
+    int     lo = cc->cursor;
+    int     hi;
+    double  rate;
+
+    if (n == 0)
+        return JpmcdsZeroPrice(cc->curve, date);
+
+    /* leave lo at the last point on or before t, or at the first point */
+    while (lo > 0 && ts[lo] > t)
+        --lo;
+    while (lo < n-1 && ts[lo+1] <= t)
+        ++lo;
+    cc->cursor = lo;
+
+    if (ts[lo] == t || ts[lo] > t || n == 1)
+    {
+        /* date found, before start of or after end of single point curve */
+        rate = cc->z[lo];
+    }
+    else
+    {
+        long   t1;
+        long   t2;
+        long   tt = t;
+
+        if (lo == n-1)
+        {
+            /* extrapolate using last flat segment of the curve */
+            --lo;
+        }
+        hi = lo + 1;
+
+        t1 = ts[lo];
+        t2 = ts[hi];
+        if (tt == 0)
+        {
+            /* see zcInterpRate */
+            tt = 1;
+        }
+        rate = (cc->zt[lo] + (cc->zt[hi] - cc->zt[lo]) *
+                (double)(tt - t1) / (double)(t2 - t1)) / tt;
+    }
+
+    return exp(-rate * (t / 365.0));
+}
+
+
+/*
+***************************************************************************
+** Calculates the zero price for a given start date and maturity date from
+** a compiled curve. The price at the start date is kept for the next call.
+***************************************************************************
+*/
+double JpmcdsCompiledForwardZeroPrice
+(TCompiledCurve *cc,
+ TDate           startDate,
+ TDate           maturityDate)
+{
+    if (startDate != cc->startDate)
+    {
+        cc->startPrice = JpmcdsCompiledZeroPrice(cc, startDate);
+        cc->startDate  = startDate;
+    }
+    return JpmcdsCompiledZeroPrice(cc, maturityDate) / cc->startPrice;
+}
+
+
 /*
 ***************************************************************************
 ** Interpolates a rate segment of a zero curve expressed with continuously
@@ -52,6 +52,112 @@ double JpmcdsZeroRate
  TDate   date);
 
 
+/*f
+***************************************************************************
+** Calculates the derivative of the log of the zero price for a given date
+** with respect to the rate at index idx of a curve of continuously
+** compounded ACT/365F rates. Returns NaN for errors.
+***************************************************************************
+*/
+double JpmcdsZeroPriceRateDeriv
+(TCurve* zeroCurve,
+ TDate   date,
+ int     idx);
+
+
+/*f
+***************************************************************************
+** Adds weight times the derivative of the log of the zero price for a given
+** date with respect to the continuously compounded ACT/365F rate at every
+** point of the curve to grad. Adjoint of JpmcdsZeroPrice.
+***************************************************************************
+*/
+int JpmcdsZeroPriceRateGrad
+(TCurve* zeroCurve,
+ TDate   date,
+ double  weight,
+ double *grad);
+
+
+/*f
+***************************************************************************
+** Adds weight times the derivative of the log of the forward zero price
+** between two dates to grad. Adjoint of JpmcdsForwardZeroPrice.
+***************************************************************************
+*/
+int JpmcdsForwardZeroPriceRateGrad
+(TCurve* zeroCurve,
+ TDate   startDate,
+ TDate   maturityDate,
+ double  weight,
+ double *grad);
+
+
+/*t
+ * Zero curve prepared for repeated lookups. Holds the continuously
+ * compounded ACT/365F rates of the curve together with rate times time,
+ * so that a lookup needs neither a rate conversion nor a binary search
+ * when dates are visited in increasing order.
+ *
+ * Only valid while the rates of the curve are unchanged.
+ */
+typedef struct _TCompiledCurve
+{
+    TCurve     *curve;      /* Curve compiled - not owned */
+    TDate       baseDate;   /* Base date of curve */
+    int         numItems;   /* Zero if lookups fall back to curve */
+    long       *t;          /* Days from base date of each point */
+    double     *z;          /* Continuously compounded ACT/365F rates */
+    double     *zt;         /* z * t of each point */
+    int         cursor;     /* Point at or before the last date looked up */
+    TDate       startDate;  /* Start date of last forward zero price */
+    double      startPrice; /* Zero price at startDate */
+} TCompiledCurve;
+
+
+/*f
+***************************************************************************
+** Compiles a zero curve for repeated lookups.
+***************************************************************************
+*/
+int JpmcdsCompiledCurveInit
+(TCompiledCurve *cc,
+ TCurve         *zeroCurve);
+
+
+/*f
+***************************************************************************
+** Releases the contents of a TCompiledCurve.
+***************************************************************************
+*/
+void JpmcdsCompiledCurveClear
+(TCompiledCurve *cc);
+
+
+/*f
+***************************************************************************
+** Calculates the zero price for a given date from a compiled curve.
+** Gives the same result as JpmcdsZeroPrice. Returns NaN for errors.
+***************************************************************************
+*/
+double JpmcdsCompiledZeroPrice
+(TCompiledCurve *cc,
+ TDate           date);
+
+
+/*f
+***************************************************************************
+** Calculates the zero price for a given start date and maturity date from
+** a compiled curve. Gives the same result as JpmcdsForwardZeroPrice.
+** Returns NaN for errors.
+***************************************************************************
+*/
+double JpmcdsCompiledForwardZeroPrice
+(TCompiledCurve *cc,
+ TDate           startDate,
+ TDate           maturityDate);
+
+
 /*f
 ***************************************************************************
 ** Converts a compound rate from one frequency to another.
@@ -39,11 +39,65 @@ static int FeePaymentPVWithTimeLine
  long            accrueDCC,
  double          notional,
  double          couponRate,
- TCurve         *discCurve,
- TCurve         *spreadCurve,
+ TCompiledCurve *discCurve,
+ TCompiledCurve *spreadCurve,
  TDateList      *tl,
  TBoolean        obsStartOfDay,
- double         *pv);
+ int             rateIdx,
+ double         *pv,
+ double         *dpv);
+
+
+/*
+***************************************************************************
+** Calculates the PV of a fee leg and optionally its derivative.
+***************************************************************************
+*/
+static int feeLegPV
+(TFeeLeg      *fl,
+ TDate         today,
+ TDate         stepinDate,
+ TDate         valueDate,
+ TCurve       *discCurve,
+ TCurve       *spreadCurve,
+ TBoolean      payAccruedAtStart,
+ TLegPVCache  *cache,
+ int           rateIdx,
+ double       *pv,
+ double       *dpv);
+
+
+/*
+***************************************************************************
+** Calculates the PV of the accruals which occur on default and optionally
+** its derivative.
+***************************************************************************
+*/
+static int accrualOnDefaultPV
+(TDate           today,
+ TDate           stepinDate,
+ TDate           startDate,
+ TDate           endDate,
+ double          amount,
+ TCompiledCurve *discCurve,
+ TCompiledCurve *spreadCurve,
+ TDateList      *criticalDates,
+ int             rateIdx,
+ double         *pv,
+ double         *dpv);
+
+
+/*
+***************************************************************************
+** Derivative of log(S(date)/S(today)) with respect to the spread curve
+** rate at rateIdx.
+***************************************************************************
+*/
+static double logSurvivalDeriv
+(TCurve         *spreadCurve,
+ TDate           today,
+ TDate           date,
+ int             rateIdx);
 
 
 /*
@@ -57,6 +111,65 @@ static int FeeLegAI
  double       *ai);
 
 
+/*
+***************************************************************************
+** Adds weight times the derivatives of the PV of a single fee payment with
+** respect to the discount and spread curve rates.
+***************************************************************************
+*/
+static int FeePaymentPVGrad
+(TAccrualPayConv accrualPayConv,
+ TDate           today,
+ TDate           stepinDate,
+ TDate           accStartDate,
+ TDate           accEndDate,
+ TDate           payDate,
+ long            accrueDCC,
+ double          notional,
+ double          couponRate,
+ TCompiledCurve *discCurve,
+ TCompiledCurve *spreadCurve,
+ TDateList      *tl,
+ TBoolean        obsStartOfDay,
+ double          weight,
+ double         *discGrad,
+ double         *spreadGrad);
+
+
+/*
+***************************************************************************
+** Adds weight times the derivatives of the PV of the accruals which occur
+** on default with respect to the discount and spread curve rates.
+***************************************************************************
+*/
+static int accrualOnDefaultPVGrad
+(TDate           today,
+ TDate           stepinDate,
+ TDate           startDate,
+ TDate           endDate,
+ double          amount,
+ TCompiledCurve *discCurve,
+ TCompiledCurve *spreadCurve,
+ TDateList      *criticalDates,
+ double          weight,
+ double         *discGrad,
+ double         *spreadGrad);
+
+
+/*
+***************************************************************************
+** Adds weight times the derivative of log(Z(date)/Z(today)) with respect
+** to the rates of a curve to grad. Does nothing if grad is NULL.
+***************************************************************************
+*/
+static int addLogPriceGrad
+(TCompiledCurve *curve,
+ TDate           today,
+ TDate           date,
+ double          weight,
+ double         *grad);
+
+
 /*
 ***************************************************************************
 ** Calculates the PV of a fee leg with fixed fee payments.
@@ -71,14 +184,462 @@ int JpmcdsFeeLegPV
  TCurve       *spreadCurve,
  TBoolean      payAccruedAtStart,
  double       *pv)
+{
+    return feeLegPV (fl,
+                     today,
+                     stepinDate,
+                     valueDate,
+                     discCurve,
+                     spreadCurve,
+                     payAccruedAtStart,
+                     NULL,
+                     -1,
+                     pv,
+                     NULL);
+}
+
+
+/*
+***************************************************************************
+** Calculates the PV of a fee leg with fixed fee payments together with its
+** derivative with respect to the rate at index rateIdx of the spread curve.
+**
+** The spread curve must hold continuously compounded ACT/365F rates.
+***************************************************************************
+*/
+int JpmcdsFeeLegPVRateDeriv
+(TFeeLeg      *fl,
+ TDate         today,
+ TDate         stepinDate,
+ TDate         valueDate,
+ TCurve       *discCurve,
+ TCurve       *spreadCurve,
+ TBoolean      payAccruedAtStart,
+ int           rateIdx,
+ double       *pv,
+ double       *dpv)
+{
+    static char routine[] = "JpmcdsFeeLegPVRateDeriv";
+
+    if (dpv == NULL || rateIdx < 0 || spreadCurve == NULL ||
+        rateIdx >= spreadCurve->fNumItems)
+    {
+        JpmcdsErrMsg ("%s: Invalid rate index %d\n", routine, rateIdx);
+        return FAILURE;
+    }
+
+    return feeLegPV (fl,
+                     today,
+                     stepinDate,
+                     valueDate,
+                     discCurve,
+                     spreadCurve,
+                     payAccruedAtStart,
+                     NULL,
+                     rateIdx,
+                     pv,
+                     dpv);
+}
+
+
+/*
+***************************************************************************
+** Calculates the PV of a fee leg with fixed fee payments reusing the PV of
+** the payments observed on or before cache->fixedDate from earlier calls.
+**
+** The first call fills the cache. Later calls must use the same leg, dates
+** and curve dates, and spread curve rates may only have changed after
+** cache->fixedDate. If dpv is not NULL it returns the derivative with
+** respect to the rate at index rateIdx of the spread curve, which must not
+** affect the cached part.
+***************************************************************************
+*/
+int JpmcdsFeeLegPVCached
+(TFeeLeg      *fl,
+ TDate         today,
+ TDate         stepinDate,
+ TDate         valueDate,
+ TCurve       *discCurve,
+ TCurve       *spreadCurve,
+ TBoolean      payAccruedAtStart,
+ TLegPVCache  *cache,
+ int           rateIdx,
+ double       *pv,
+ double       *dpv)
+{
+    static char routine[] = "JpmcdsFeeLegPVCached";
+
+    if (cache == NULL)
+    {
+        JpmcdsErrMsg ("%s: NULL cache\n", routine);
+        return FAILURE;
+    }
+
+    if (dpv != NULL && (rateIdx < 0 || spreadCurve == NULL ||
+        rateIdx >= spreadCurve->fNumItems))
+    {
+        JpmcdsErrMsg ("%s: Invalid rate index %d\n", routine, rateIdx);
+        return FAILURE;
+    }
+
+    return feeLegPV (fl,
+                     today,
+                     stepinDate,
+                     valueDate,
+                     discCurve,
+                     spreadCurve,
+                     payAccruedAtStart,
+                     cache,
+                     rateIdx,
+                     pv,
+                     dpv);
+}
+
+
+/*
+***************************************************************************
+** Calculates the PVs of fee legs which only differ in their last payments,
+** such as one leg run to a ladder of maturities.
+**
+** The payments every leg shares with the longest leg are priced once along
+** the timeline of the longest leg and summed in the same order as
+** JpmcdsFeeLegPV, so each leg has the same PV as when priced on its own.
+***************************************************************************
+*/
+int JpmcdsFeeLegPVLadder
+(int           nbLegs,
+ TFeeLeg     **fls,
+ TDate         today,
+ TDate         stepinDate,
+ TDate         valueDate,
+ TCurve       *discCurve,
+ TCurve       *spreadCurve,
+ TBoolean      payAccruedAtStart,
+ double       *pv)
+{
+    static char routine[] = "JpmcdsFeeLegPVLadder";
+    int         status    = FAILURE;
+    int         i;
+    int         j;
+    double      valueDatePv;
+    double     *sharedPv = NULL; /* sharedPv[i] is the PV of payments 0 to i-1 */
+    TFeeLeg    *ref = NULL;      /* longest leg */
+    TDateList  *tl = NULL;
+    TCompiledCurve discCC = {NULL};
+    TCompiledCurve spreadCC = {NULL};
+
+    REQUIRE (nbLegs > 0);
+    REQUIRE (fls != NULL);
+    REQUIRE (discCurve != NULL);
+    REQUIRE (spreadCurve != NULL);
+    REQUIRE (pv != NULL);
+    REQUIRE (valueDate >= today);
+    REQUIRE (stepinDate >= today);
+
+    for (j = 0; j < nbLegs; ++j)
+    {
+        REQUIRE (fls[j] != NULL);
+        REQUIRE (fls[j]->nbDates > 0);
+        if (ref == NULL || fls[j]->accEndDates[fls[j]->nbDates-1] >
+                           ref->accEndDates[ref->nbDates-1])
+            ref = fls[j];
+    }
+
+    for (j = 0; j < nbLegs; ++j)
+    {
+        REQUIRE (fls[j]->accrualPayConv == ref->accrualPayConv);
+        REQUIRE (fls[j]->dcc == ref->dcc);
+        REQUIRE (fls[j]->notional == ref->notional);
+        REQUIRE (fls[j]->couponRate == ref->couponRate);
+        REQUIRE (fls[j]->obsStartOfDay == ref->obsStartOfDay);
+    }
+
+    if (ref->nbDates > 1)
+    {
+        tl = JpmcdsRiskyTimeLine(ref->accStartDates[0],
+                                 ref->accEndDates[ref->nbDates-1],
+                                 discCurve,
+                                 spreadCurve);
+        if (tl == NULL)
+            goto done;
+    }
+
+    if (JpmcdsCompiledCurveInit(&discCC, discCurve) != SUCCESS ||
+        JpmcdsCompiledCurveInit(&spreadCC, spreadCurve) != SUCCESS)
+        goto done;
+
+    sharedPv = NEW_ARRAY(double, ref->nbDates + 1);
+    if (sharedPv == NULL)
+        goto done;
+
+    sharedPv[0] = 0.0;
+    for (i = 0; i < ref->nbDates; ++i)
+    {
+        double thisPv = 0;
+
+        if (FeePaymentPVWithTimeLine (ref->accrualPayConv,
+                                      today,
+                                      stepinDate,
+                                      ref->accStartDates[i],
+                                      ref->accEndDates[i],
+                                      ref->payDates[i],
+                                      ref->dcc,
+                                      ref->notional,
+                                      ref->couponRate,
+                                      &discCC,
+                                      &spreadCC,
+                                      tl,
+                                      ref->obsStartOfDay,
+                                      -1,
+                                      &thisPv,
+                                      NULL) != SUCCESS)
+            goto done;
+
+        sharedPv[i+1] = sharedPv[i] + thisPv;
+    }
+
+    valueDatePv = JpmcdsCompiledForwardZeroPrice (&discCC, today, valueDate);
+
+    for (j = 0; j < nbLegs; ++j)
+    {
+        TFeeLeg *fl = fls[j];
+        int      nbShared = 0;
+        double   myPv;
+        TDate    matDate = (fl->obsStartOfDay == TRUE ?
+                            fl->accEndDates[fl->nbDates - 1] - 1 :
+                            fl->accEndDates[fl->nbDates - 1]);
+
+        if (today > matDate || stepinDate > matDate)
+        {
+            pv[j] = 0.0;
+            continue;
+        }
+
+        /* a leg of one payment is priced without a timeline */
+        if (fl->nbDates > 1)
+        {
+            while (nbShared < fl->nbDates && nbShared < ref->nbDates &&
+                   fl->accStartDates[nbShared] == ref->accStartDates[nbShared] &&
+                   fl->accEndDates[nbShared] == ref->accEndDates[nbShared] &&
+                   fl->payDates[nbShared] == ref->payDates[nbShared])
+                ++nbShared;
+        }
+
+        myPv = sharedPv[nbShared];
+        for (i = nbShared; i < fl->nbDates; ++i)
+        {
+            double thisPv = 0;
+
+            if (FeePaymentPVWithTimeLine (fl->accrualPayConv,
+                                          today,
+                                          stepinDate,
+                                          fl->accStartDates[i],
+                                          fl->accEndDates[i],
+                                          fl->payDates[i],
+                                          fl->dcc,
+                                          fl->notional,
+                                          fl->couponRate,
+                                          &discCC,
+                                          &spreadCC,
+                                          fl->nbDates > 1 ? tl : NULL,
+                                          fl->obsStartOfDay,
+                                          -1,
+                                          &thisPv,
+                                          NULL) != SUCCESS)
+                goto done;
+
+            myPv += thisPv;
+        }
+
+        pv[j] = myPv / valueDatePv;
+
+        if (payAccruedAtStart) /* clean price */
+        {
+            double ai;
+            if (FeeLegAI(fl, stepinDate, &ai) == FAILURE)
+            {
+                JpmcdsErrMsg ("%s: accrued interest calculation failed.\n", routine);
+                goto done;
+            }
+            pv[j] -= ai;
+        }
+    }
+
+    status = SUCCESS;
+
+ done:
+
+    if (status != SUCCESS)
+        JpmcdsErrMsgFailure (routine);
+
+    FREE (sharedPv);
+    JpmcdsFreeDateList (tl);
+    JpmcdsCompiledCurveClear(&discCC);
+    JpmcdsCompiledCurveClear(&spreadCC);
+    return status;
+}
+
+
+/*
+***************************************************************************
+** Calculates the PV of a fee leg with fixed fee payments and adds weight
+** times its derivatives with respect to the continuously compounded
+** ACT/365F rates of both curves to discGrad and spreadGrad.
+**
+** Each fee payment and each segment of the accrual on default integral
+** hands its sensitivities to the at most two curve points either side of
+** its dates, so the cost is about that of one more pricing.
+***************************************************************************
+*/
+int JpmcdsFeeLegPVRateGrad
+(TFeeLeg      *fl,
+ TDate         today,
+ TDate         stepinDate,
+ TDate         valueDate,
+ TCurve       *discCurve,
+ TCurve       *spreadCurve,
+ TBoolean      payAccruedAtStart,
+ TDateList    *criticalDates,
+ double        weight,
+ double       *pv,
+ double       *discGrad,
+ double       *spreadGrad)
+{
+    static char routine[] = "JpmcdsFeeLegPVRateGrad";
+    int         status    = FAILURE;
+    int         i;
+    double      dirtyPv;
+    double      valueDatePv;
+    double      scale;
+    TDateList  *tl = criticalDates;
+    TDate       matDate;
+    TCompiledCurve discCC = {NULL};
+    TCompiledCurve spreadCC = {NULL};
+
+    REQUIRE (pv != NULL);
+
+    /* the accrued interest does not depend on the curves */
+    if (feeLegPV (fl,
+                  today,
+                  stepinDate,
+                  valueDate,
+                  discCurve,
+                  spreadCurve,
+                  FALSE,
+                  NULL,
+                  -1,
+                  &dirtyPv,
+                  NULL) != SUCCESS)
+        goto done;
+
+    *pv = dirtyPv;
+    if (payAccruedAtStart) /* clean price */
+    {
+        double ai;
+        if (FeeLegAI(fl, stepinDate, &ai) == FAILURE)
+        {
+            JpmcdsErrMsg ("%s: accrued interest calculation failed.\n", routine);
+            goto done;
+        }
+        *pv -= ai;
+    }
+
+    matDate = (fl->obsStartOfDay == TRUE ?
+               fl->accEndDates[fl->nbDates - 1] - 1 :
+               fl->accEndDates[fl->nbDates - 1]);
+
+    if (today > matDate || stepinDate > matDate)
+    {
+        status = SUCCESS;
+        goto done;
+    }
+
+    if (tl == NULL && fl->nbDates > 1)
+    {
+        tl = JpmcdsRiskyTimeLine(fl->accStartDates[0],
+                                 fl->accEndDates[fl->nbDates-1],
+                                 discCurve,
+                                 spreadCurve);
+        if (tl == NULL)
+            goto done;
+    }
+
+    if (JpmcdsCompiledCurveInit(&discCC, discCurve) != SUCCESS ||
+        JpmcdsCompiledCurveInit(&spreadCC, spreadCurve) != SUCCESS)
+        goto done;
+
+    valueDatePv = JpmcdsCompiledForwardZeroPrice (&discCC, today, valueDate);
+    scale = weight / valueDatePv;
+
+    for (i = 0; i < fl->nbDates; ++i)
+    {
+        if (FeePaymentPVGrad (fl->accrualPayConv,
+                              today,
+                              stepinDate,
+                              fl->accStartDates[i],
+                              fl->accEndDates[i],
+                              fl->payDates[i],
+                              fl->dcc,
+                              fl->notional,
+                              fl->couponRate,
+                              &discCC,
+                              &spreadCC,
+                              tl,
+                              fl->obsStartOfDay,
+                              scale,
+                              discGrad,
+                              spreadGrad) != SUCCESS)
+            goto done;
+    }
+
+    if (addLogPriceGrad (&discCC, today, valueDate, -weight * dirtyPv, discGrad) != SUCCESS)
+        goto done;
+
+    status = SUCCESS;
+
+ done:
+
+    if (status != SUCCESS)
+        JpmcdsErrMsgFailure (routine);
+
+    if (tl != criticalDates)
+        JpmcdsFreeDateList (tl);
+
+    JpmcdsCompiledCurveClear(&discCC);
+    JpmcdsCompiledCurveClear(&spreadCC);
+    return status;
+}
+
+
+/*
+***************************************************************************
+** Calculates the PV of a fee leg and optionally its derivative.
+***************************************************************************
+*/
+static int feeLegPV
+(TFeeLeg      *fl,
+ TDate         today,
+ TDate         stepinDate,
+ TDate         valueDate,
+ TCurve       *discCurve,
+ TCurve       *spreadCurve,
+ TBoolean      payAccruedAtStart,
+ TLegPVCache  *cache,
+ int           rateIdx,
+ double       *pv,
+ double       *dpv)
 {
     static char routine[] = "JpmcdsFeeLegPV";
     int         status    = FAILURE;
     int         i;
+    int         first = 0; /* first fee payment to price */
     double      myPv;
+    double      myDpv;
     double      valueDatePv;
     TDateList  *tl = NULL;
     TDate       matDate;
+    TCompiledCurve discCC = {NULL};
+    TCompiledCurve spreadCC = {NULL};
 
     REQUIRE (spreadCurve != NULL);
 
@@ -90,6 +651,7 @@ int JpmcdsFeeLegPV
     REQUIRE (stepinDate >= today);
 
     myPv = 0.0;
+    myDpv = 0.0;
 
     if (fl->nbDates > 1)
     {
@@ -112,11 +674,17 @@ int JpmcdsFeeLegPV
             goto done;
         }
 
-        tl = JpmcdsRiskyTimeLine(startDate,
-                                 endDate,
-                                 discCurve,
-                                 spreadCurve);
-
+        if (cache != NULL)
+            tl = JpmcdsLegPVCacheTimeLine(cache,
+                                          startDate,
+                                          endDate,
+                                          discCurve,
+                                          spreadCurve);
+        else
+            tl = JpmcdsRiskyTimeLine(startDate,
+                                     endDate,
+                                     discCurve,
+                                     spreadCurve);
         if (tl == NULL)
             goto done;
     }
@@ -129,12 +697,26 @@ int JpmcdsFeeLegPV
     {
         status = SUCCESS;
         *pv = 0;
+        if (dpv != NULL)
+            *dpv = 0;
         goto done;
     }
 
-    for (i = 0; i < fl->nbDates; ++i)
+    if (JpmcdsCompiledCurveInit(&discCC, discCurve) != SUCCESS ||
+        JpmcdsCompiledCurveInit(&spreadCC, spreadCurve) != SUCCESS)
+        goto done;
+
+    if (cache != NULL && cache->valid)
+    {
+        /* payments observed up to the fixed date have been priced before */
+        first = cache->nbFixed;
+        myPv  = cache->pv;
+    }
+
+    for (i = first; i < fl->nbDates; ++i)
     {
         double thisPv = 0;
+        double thisDpv = 0;
         
         if (FeePaymentPVWithTimeLine (fl->accrualPayConv,
                                       today,
@@ -145,19 +727,34 @@ int JpmcdsFeeLegPV
                                       fl->dcc,
                                       fl->notional,
                                       fl->couponRate,
-                                      discCurve,
-                                      spreadCurve,
+                                      &discCC,
+                                      &spreadCC,
                                       tl,
                                       fl->obsStartOfDay,
-                                      &thisPv) != SUCCESS)
+                                      rateIdx,
+                                      &thisPv,
+                                      dpv == NULL ? NULL : &thisDpv) != SUCCESS)
             goto done;
 
         myPv += thisPv;
+        myDpv += thisDpv;
+
+        if (cache != NULL && !cache->valid && cache->nbFixed == i &&
+            fl->accEndDates[i] + (fl->obsStartOfDay ? -1 : 0) <= cache->fixedDate)
+        {
+            cache->nbFixed = i + 1;
+            cache->pv      = myPv;
+        }
     }
 
-    valueDatePv = JpmcdsForwardZeroPrice (discCurve, today, valueDate);
+    if (cache != NULL)
+        cache->valid = TRUE;
+
+    valueDatePv = JpmcdsCompiledForwardZeroPrice (&discCC, today, valueDate);
 
     *pv = myPv / valueDatePv;
+    if (dpv != NULL)
+        *dpv = myDpv / valueDatePv;
     
     if(payAccruedAtStart) /* clean price */
     {
@@ -177,8 +774,11 @@ int JpmcdsFeeLegPV
     if (status != SUCCESS)
         JpmcdsErrMsgFailure (routine);
 
-    JpmcdsFreeDateList (tl);
+    if (cache == NULL)
+        JpmcdsFreeDateList (tl);
 
+    JpmcdsCompiledCurveClear(&discCC);
+    JpmcdsCompiledCurveClear(&spreadCC);
     return status;
 }
 
@@ -207,11 +807,13 @@ static int FeePaymentPVWithTimeLine
  long            accrueDCC,
  double          notional,
  double          couponRate,
- TCurve         *discCurve,
- TCurve         *spreadCurve,
+ TCompiledCurve *discCurve,
+ TCompiledCurve *spreadCurve,
  TDateList      *tl,
  TBoolean        obsStartOfDay,
- double         *pv)
+ int             rateIdx,
+ double         *pv,
+ double         *dpv)
 {
     static char routine[] = "FeePaymentPVWithTimeLine";
     int         status    = FAILURE;
@@ -232,6 +834,8 @@ static int FeePaymentPVWithTimeLine
     if(accEndDate <= stepinDate)
     {
         *pv = 0;
+        if (dpv != NULL)
+            *dpv = 0;
         return SUCCESS;
     }
 
@@ -249,9 +853,11 @@ static int FeePaymentPVWithTimeLine
             goto done;
         
         amount   = notional * couponRate * accTime;
-        survival = JpmcdsForwardZeroPrice(spreadCurve, today, accEndDate + obsOffset);
-        discount = JpmcdsForwardZeroPrice(discCurve, today, payDate);
+        survival = JpmcdsCompiledForwardZeroPrice(spreadCurve, today, accEndDate + obsOffset);
+        discount = JpmcdsCompiledForwardZeroPrice(discCurve, today, payDate);
         myPv = amount * survival * discount;
+        if (dpv != NULL)
+            *dpv = myPv * logSurvivalDeriv(spreadCurve->curve, today, accEndDate + obsOffset, rateIdx);
         break;
     }
     case ACCRUAL_PAY_ALL:
@@ -263,28 +869,36 @@ static int FeePaymentPVWithTimeLine
         double survival;
         double discount;
         double accrual;
+        double accrualDeriv;
         
         if (JpmcdsDayCountFraction(accStartDate, accEndDate, accrueDCC, &accTime) != SUCCESS)
             goto done;
 
         amount   = notional * couponRate * accTime;
-        survival = JpmcdsForwardZeroPrice(spreadCurve, today, accEndDate + obsOffset);
-        discount = JpmcdsForwardZeroPrice(discCurve, today, payDate);
+        survival = JpmcdsCompiledForwardZeroPrice(spreadCurve, today, accEndDate + obsOffset);
+        discount = JpmcdsCompiledForwardZeroPrice(discCurve, today, payDate);
         myPv = amount * survival * discount;
         
         /* also need to calculate accrual PV */
         
-        if (JpmcdsAccrualOnDefaultPVWithTimeLine(today,
-                                                 stepinDate + obsOffset,
-                                                 accStartDate + obsOffset,
-                                                 accEndDate + obsOffset,
-                                                 amount,
-                                                 discCurve,
-                                                 spreadCurve,
-                                                 tl,
-                                                 &accrual) != SUCCESS)
+        if (accrualOnDefaultPV(today,
+                               stepinDate + obsOffset,
+                               accStartDate + obsOffset,
+                               accEndDate + obsOffset,
+                               amount,
+                               discCurve,
+                               spreadCurve,
+                               tl,
+                               rateIdx,
+                               &accrual,
+                               dpv == NULL ? NULL : &accrualDeriv) != SUCCESS)
             goto done;
         
+        if (dpv != NULL)
+        {
+            *dpv = myPv * logSurvivalDeriv(spreadCurve->curve, today, accEndDate + obsOffset, rateIdx)
+                + accrualDeriv;
+        }
         myPv += accrual;
         break;
     }
@@ -305,6 +919,36 @@ static int FeePaymentPVWithTimeLine
 }
 
 
+/*
+***************************************************************************
+** Calculates the accrued interest of a fee leg at stepinDate.
+***************************************************************************
+*/
+int JpmcdsFeeLegAI
+(TFeeLeg      *fl,
+ TDate         stepinDate,
+ double       *ai)
+{
+    static char routine[] = "JpmcdsFeeLegAI";
+    int         status    = FAILURE;
+
+    REQUIRE (fl != NULL);
+    REQUIRE (ai != NULL);
+
+    if (FeeLegAI (fl, stepinDate, ai) != SUCCESS)
+        goto done;
+
+    status = SUCCESS;
+
+ done:
+
+    if (status != SUCCESS)
+        JpmcdsErrMsgFailure (routine);
+
+    return status;
+}
+
+
 /*
 ***************************************************************************
 ** Calculates the PV of the accruals which occur on default.
@@ -325,7 +969,63 @@ int JpmcdsAccrualOnDefaultPVWithTimeLine
     static char routine[] = "JpmcdsAccrualOnDefaultPVWithTimeLine";
     int         status    = FAILURE;
 
+    TCompiledCurve discCC = {NULL};
+    TCompiledCurve spreadCC = {NULL};
+
+    REQUIRE (discCurve != NULL);
+    REQUIRE (spreadCurve != NULL);
+
+    if (JpmcdsCompiledCurveInit(&discCC, discCurve) != SUCCESS ||
+        JpmcdsCompiledCurveInit(&spreadCC, spreadCurve) != SUCCESS)
+        goto done;
+
+    status = accrualOnDefaultPV (today,
+                                 stepinDate,
+                                 startDate,
+                                 endDate,
+                                 amount,
+                                 &discCC,
+                                 &spreadCC,
+                                 criticalDates,
+                                 -1,
+                                 pv,
+                                 NULL);
+
+ done:
+
+    if (status != SUCCESS)
+        JpmcdsErrMsgFailure (routine);
+
+    JpmcdsCompiledCurveClear(&discCC);
+    JpmcdsCompiledCurveClear(&spreadCC);
+    return status;
+}
+
+
+/*
+***************************************************************************
+** Calculates the PV of the accruals which occur on default and optionally
+** its derivative.
+***************************************************************************
+*/
+static int accrualOnDefaultPV
+(TDate           today,
+ TDate           stepinDate,
+ TDate           startDate,
+ TDate           endDate,
+ double          amount,
+ TCompiledCurve *discCurve,
+ TCompiledCurve *spreadCurve,
+ TDateList      *criticalDates,
+ int             rateIdx,
+ double         *pv,
+ double         *dpv)
+{
+    static char routine[] = "JpmcdsAccrualOnDefaultPVWithTimeLine";
+    int         status    = FAILURE;
+
     double  myPv = 0.0;
+    double  myDpv = 0.0;
     int     i;
 
     double t;
@@ -334,6 +1034,8 @@ int JpmcdsAccrualOnDefaultPVWithTimeLine
     double df0;
     double df1;
     double accRate;
+    double a0 = 0.0; /* derivatives of log(s0) and log(s1) */
+    double a1;
     TDate  subStartDate;
 
     TDateList  *tl = NULL;
@@ -354,7 +1056,7 @@ int JpmcdsAccrualOnDefaultPVWithTimeLine
     }
     else
     {
-        tl = JpmcdsRiskyTimeLine (startDate, endDate, discCurve, spreadCurve);
+        tl = JpmcdsRiskyTimeLine (startDate, endDate, discCurve->curve, spreadCurve->curve);
     }
     if (tl == NULL)
         goto done;
@@ -372,8 +1074,10 @@ int JpmcdsAccrualOnDefaultPVWithTimeLine
     subStartDate = MAX(stepinDate, startDate);
     t       = (double)(endDate-startDate)/365.0;
     accRate = amount/t;
-    s0      = JpmcdsForwardZeroPrice(spreadCurve, today, subStartDate);
-    df0     = JpmcdsForwardZeroPrice(discCurve, today, MAX(today, subStartDate));
+    s0      = JpmcdsCompiledForwardZeroPrice(spreadCurve, today, subStartDate);
+    df0     = JpmcdsCompiledForwardZeroPrice(discCurve, today, MAX(today, subStartDate));
+    if (dpv != NULL)
+        a0 = logSurvivalDeriv(spreadCurve->curve, today, subStartDate, rateIdx);
 
     for (i = 1; i < tl->fNumItems; ++i)
     {
@@ -386,8 +1090,8 @@ int JpmcdsAccrualOnDefaultPVWithTimeLine
         if(tl->fArray[i] <= stepinDate)
             continue;
 
-        s1  = JpmcdsForwardZeroPrice(spreadCurve, today, tl->fArray[i]);
-        df1 = JpmcdsForwardZeroPrice(discCurve, today, tl->fArray[i]);
+        s1  = JpmcdsCompiledForwardZeroPrice(spreadCurve, today, tl->fArray[i]);
+        df1 = JpmcdsCompiledForwardZeroPrice(discCurve, today, tl->fArray[i]);
 
         t0  = (double)(subStartDate + 0.5 - startDate)/365.0;
         t1  = (double)(tl->fArray[i] + 0.5- startDate)/365.0;
@@ -472,6 +1176,40 @@ int JpmcdsAccrualOnDefaultPVWithTimeLine
 		}
 
         myPv += thisPv;
+
+        if (dpv != NULL)
+        {
+            /* thisPv = lambda . accRate . s0 . df0 . h(x) where both lambda
+               and x move by a0 - a1 and s0 moves by s0 . a0 */
+            double x = lambdafwdRate;
+            double dlambda;
+            double h;
+            double dh;
+
+            a1 = logSurvivalDeriv(spreadCurve->curve, today, tl->fArray[i], rateIdx);
+            dlambda = a0 - a1;
+
+            if (fabs(x) > 1e-4)
+            {
+                double e  = s1/s0 * df1/df0;
+                double x2 = x * x;
+                double x3 = x2 * x;
+                h  = (t0 + t/x)/x - (t1 + t/x)/x * e;
+                dh = -t0/x2 - 2.*t/x3 + e * (t1/x + t/x2 + t1/x2 + 2.*t/x3);
+            }
+            else
+            {
+                h  = 0.5 * ((t0 + t1) - x * ((t0 + 2.*t1)/3. - x * ((t0 + 3.*t1)/12. -
+                     x * ((t0 + 4.*t1)/60. - x * (t0 + 5.*t1)/360.))));
+                dh = 0.5 * (-(t0 + 2.*t1)/3. + x * ((t0 + 3.*t1)/6. -
+                     x * ((t0 + 4.*t1)/20. - x * (t0 + 5.*t1)/90.)));
+            }
+
+            myDpv += accRate * s0 * df0 *
+                (dlambda * (h + lambda * dh) + lambda * h * a0);
+            a0 = a1;
+        }
+
         s0  = s1;
         df0 = df1;
         subStartDate = tl->fArray[i];
@@ -479,6 +1217,8 @@ int JpmcdsAccrualOnDefaultPVWithTimeLine
 
     status = SUCCESS;
     *pv = myPv;
+    if (dpv != NULL)
+        *dpv = myDpv;
         
  done:
 
@@ -598,3 +1338,259 @@ static int FeeLegAI
 
     return status;
 }
+
+
+/*
+***************************************************************************
+** Derivative of log(S(date)/S(today)) with respect to the spread curve
+** rate at rateIdx.
+***************************************************************************
+*/
+static double logSurvivalDeriv
+(TCurve         *spreadCurve,
+ TDate           today,
+ TDate           date,
+ int             rateIdx)
+{
+    return JpmcdsZeroPriceRateDeriv(spreadCurve, date, rateIdx) -
+        JpmcdsZeroPriceRateDeriv(spreadCurve, today, rateIdx);
+}
+
+
+/*
+***************************************************************************
+** Adds weight times the derivatives of the PV of a single fee payment with
+** respect to the discount and spread curve rates.
+***************************************************************************
+*/
+static int FeePaymentPVGrad
+(TAccrualPayConv accrualPayConv,
+ TDate           today,
+ TDate           stepinDate,
+ TDate           accStartDate,
+ TDate           accEndDate,
+ TDate           payDate,
+ long            accrueDCC,
+ double          notional,
+ double          couponRate,
+ TCompiledCurve *discCurve,
+ TCompiledCurve *spreadCurve,
+ TDateList      *tl,
+ TBoolean        obsStartOfDay,
+ double          weight,
+ double         *discGrad,
+ double         *spreadGrad)
+{
+    static char routine[] = "FeePaymentPVGrad";
+    int         status    = FAILURE;
+
+    int    obsOffset = obsStartOfDay ? -1 : 0;
+    double accTime;
+    double amount;
+    double survival;
+    double discount;
+    double p;
+
+    REQUIRE (discCurve != NULL);
+    REQUIRE (spreadCurve != NULL);
+
+    if(accEndDate <= stepinDate)
+        return SUCCESS;
+
+    if (accrualPayConv != ACCRUAL_PAY_NONE && accrualPayConv != ACCRUAL_PAY_ALL)
+    {
+        JpmcdsErrMsg("%s: Invalid accrual payment type %d\n", routine, (int)accrualPayConv);
+        goto done;
+    }
+
+    /* the fee pays amount . S(accEndDate) . Z(payDate) */
+    if (JpmcdsDayCountFraction(accStartDate, accEndDate, accrueDCC, &accTime) != SUCCESS)
+        goto done;
+
+    amount   = notional * couponRate * accTime;
+    survival = JpmcdsCompiledForwardZeroPrice(spreadCurve, today, accEndDate + obsOffset);
+    discount = JpmcdsCompiledForwardZeroPrice(discCurve, today, payDate);
+    p        = weight * amount * survival * discount;
+
+    if (addLogPriceGrad (spreadCurve, today, accEndDate + obsOffset, p, spreadGrad) != SUCCESS ||
+        addLogPriceGrad (discCurve, today, payDate, p, discGrad) != SUCCESS)
+        goto done;
+
+    if (accrualPayConv == ACCRUAL_PAY_ALL &&
+        accrualOnDefaultPVGrad (today,
+                                stepinDate + obsOffset,
+                                accStartDate + obsOffset,
+                                accEndDate + obsOffset,
+                                amount,
+                                discCurve,
+                                spreadCurve,
+                                tl,
+                                weight,
+                                discGrad,
+                                spreadGrad) != SUCCESS)
+        goto done;
+
+    status = SUCCESS;
+
+ done:
+
+    if (status != SUCCESS)
+        JpmcdsErrMsgFailure (routine);
+
+    return status;
+}
+
+
+/*
+***************************************************************************
+** Adds weight times the derivatives of the PV of the accruals which occur
+** on default with respect to the discount and spread curve rates.
+**
+** Each segment of the timeline integrates lambda . accRate . s0 . df0 . h(x)
+** with lambda = L0 - L1, x = lambda + D0 - D1 and L, D the logs of the
+** survival probability and discount factor at the ends of the segment.
+***************************************************************************
+*/
+static int accrualOnDefaultPVGrad
+(TDate           today,
+ TDate           stepinDate,
+ TDate           startDate,
+ TDate           endDate,
+ double          amount,
+ TCompiledCurve *discCurve,
+ TCompiledCurve *spreadCurve,
+ TDateList      *criticalDates,
+ double          weight,
+ double         *discGrad,
+ double         *spreadGrad)
+{
+    static char routine[] = "accrualOnDefaultPVGrad";
+    int         status    = FAILURE;
+
+    int     i;
+
+    double t;
+    double s0;
+    double s1;
+    double df0;
+    double df1;
+    double accRate;
+    double bL0 = 0.0; /* sensitivities to L and D at the segment start */
+    double bD0 = 0.0;
+    TDate  subStartDate;
+    TDate  dDate0;    /* date at which D is observed */
+
+    TDateList  *tl = NULL;
+
+    REQUIRE (endDate > startDate);
+    REQUIRE (discCurve != NULL);
+    REQUIRE (spreadCurve != NULL);
+
+    if (criticalDates != NULL)
+    {
+        tl = JpmcdsTruncateTimeLine (criticalDates, startDate, endDate);
+    }
+    else
+    {
+        tl = JpmcdsRiskyTimeLine (startDate, endDate, discCurve->curve, spreadCurve->curve);
+    }
+    if (tl == NULL)
+        goto done;
+
+    subStartDate = MAX(stepinDate, startDate);
+    dDate0  = MAX(today, subStartDate);
+    t       = (double)(endDate-startDate)/365.0;
+    accRate = amount/t;
+    s0      = JpmcdsCompiledForwardZeroPrice(spreadCurve, today, subStartDate);
+    df0     = JpmcdsCompiledForwardZeroPrice(discCurve, today, dDate0);
+
+    for (i = 1; i < tl->fNumItems; ++i)
+    {
+        double lambda;
+        double t0;
+        double t1;
+        double x;
+        double h;
+        double dh;
+        double p;
+
+        if(tl->fArray[i] <= stepinDate)
+            continue;
+
+        s1  = JpmcdsCompiledForwardZeroPrice(spreadCurve, today, tl->fArray[i]);
+        df1 = JpmcdsCompiledForwardZeroPrice(discCurve, today, tl->fArray[i]);
+
+        t0  = (double)(subStartDate + 0.5 - startDate)/365.0;
+        t1  = (double)(tl->fArray[i] + 0.5- startDate)/365.0;
+        t   = t1-t0;
+
+        lambda = log(s0) - log(s1);
+        x      = lambda + log(df0) - log(df1) + 1.0e-50;
+
+        if (fabs(x) > 1e-4)
+        {
+            double e  = s1/s0 * df1/df0;
+            double x2 = x * x;
+            double x3 = x2 * x;
+            h  = (t0 + t/x)/x - (t1 + t/x)/x * e;
+            dh = -t0/x2 - 2.*t/x3 + e * (t1/x + t/x2 + t1/x2 + 2.*t/x3);
+        }
+        else
+        {
+            h  = 0.5 * ((t0 + t1) - x * ((t0 + 2.*t1)/3. - x * ((t0 + 3.*t1)/12. -
+                 x * ((t0 + 4.*t1)/60. - x * (t0 + 5.*t1)/360.))));
+            dh = 0.5 * (-(t0 + 2.*t1)/3. + x * ((t0 + 3.*t1)/6. -
+                 x * ((t0 + 4.*t1)/20. - x * (t0 + 5.*t1)/90.)));
+        }
+
+        p = weight * accRate * s0 * df0;
+
+        /* the start of this segment is complete */
+        bL0 += p * (h + lambda * dh + lambda * h);
+        bD0 += p * lambda * (dh + h);
+        if (addLogPriceGrad (spreadCurve, today, subStartDate, bL0, spreadGrad) != SUCCESS ||
+            addLogPriceGrad (discCurve, today, dDate0, bD0, discGrad) != SUCCESS)
+            goto done;
+
+        bL0 = -p * (h + lambda * dh);
+        bD0 = -p * lambda * dh;
+
+        s0  = s1;
+        df0 = df1;
+        subStartDate = tl->fArray[i];
+        dDate0 = tl->fArray[i];
+    }
+
+    if (addLogPriceGrad (spreadCurve, today, subStartDate, bL0, spreadGrad) != SUCCESS ||
+        addLogPriceGrad (discCurve, today, dDate0, bD0, discGrad) != SUCCESS)
+        goto done;
+
+    status = SUCCESS;
+
+ done:
+
+    if (status != SUCCESS)
+        JpmcdsErrMsgFailure (routine);
+
+    JpmcdsFreeDateList (tl);
+    return status;
+}
+
+
+/*
+***************************************************************************
+** Adds weight times the derivative of log(Z(date)/Z(today)) with respect
+** to the rates of a curve to grad. Does nothing if grad is NULL.
+***************************************************************************
+*/
+static int addLogPriceGrad
+(TCompiledCurve *curve,
+ TDate           today,
+ TDate           date,
+ double          weight,
+ double         *grad)
+{
+    if (grad == NULL)
+        return SUCCESS;
+    return JpmcdsForwardZeroPriceRateGrad(curve->curve, today, date, weight, grad);
+}
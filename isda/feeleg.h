@@ -35,6 +35,96 @@ int JpmcdsFeeLegPV
  double        *pv);
 
 
+/*f
+***************************************************************************
+** Calculates the PV of a fee leg with fixed fee payments together with its
+** derivative with respect to the rate at index rateIdx of the spread curve.
+**
+** The spread curve must hold continuously compounded ACT/365F rates.
+***************************************************************************
+*/
+int JpmcdsFeeLegPVRateDeriv
+(TFeeLeg       *fl,
+ TDate          today,
+ TDate          stepinDate,
+ TDate          valueDate,
+ TCurve        *discCurve,
+ TCurve        *spreadCurve,
+ TBoolean       payAccruedAtStart,
+ int            rateIdx,
+ double        *pv,
+ double        *dpv);
+
+
+/*f
+***************************************************************************
+** Calculates the PV of a fee leg with fixed fee payments reusing the PV of
+** the payments observed on or before cache->fixedDate from earlier calls.
+**
+** The first call fills the cache. Later calls must use the same leg, dates
+** and curve dates, and spread curve rates may only have changed after
+** cache->fixedDate. If dpv is not NULL it returns the derivative with
+** respect to the rate at index rateIdx of the spread curve, which must not
+** affect the cached part.
+***************************************************************************
+*/
+int JpmcdsFeeLegPVCached
+(TFeeLeg       *fl,
+ TDate          today,
+ TDate          stepinDate,
+ TDate          valueDate,
+ TCurve        *discCurve,
+ TCurve        *spreadCurve,
+ TBoolean       payAccruedAtStart,
+ TLegPVCache   *cache,
+ int            rateIdx,
+ double        *pv,
+ double        *dpv);
+
+
+/*f
+***************************************************************************
+** Calculates the PVs of fee legs which only differ in their last payments.
+** The payments they share with the longest leg are priced only once.
+***************************************************************************
+*/
+int JpmcdsFeeLegPVLadder
+(int            nbLegs,
+ TFeeLeg      **fls,               /* (I) Legs with the same conventions   */
+ TDate          today,
+ TDate          stepinDate,
+ TDate          valueDate,
+ TCurve        *discCurve,
+ TCurve        *spreadCurve,
+ TBoolean       payAccruedAtStart,
+ double        *pv);               /* (O) One PV per leg                   */
+
+
+/*f
+***************************************************************************
+** Calculates the PV of a fee leg with fixed fee payments and adds weight
+** times its derivatives with respect to the continuously compounded
+** ACT/365F rates of the discount and spread curves to discGrad and
+** spreadGrad, arrays of the size of each curve.
+**
+** All derivatives come from a single reverse sweep over the leg.
+***************************************************************************
+*/
+int JpmcdsFeeLegPVRateGrad
+(TFeeLeg       *fl,
+ TDate          today,
+ TDate          stepinDate,
+ TDate          valueDate,
+ TCurve        *discCurve,
+ TCurve        *spreadCurve,
+ TBoolean       payAccruedAtStart,
+ TDateList     *criticalDates,     /* (I) Timeline of the leg. Can be NULL */
+ double         weight,            /* (I) Multiplies the derivatives       */
+ double        *pv,
+ double        *discGrad,          /* (I/O) Discount rates. Can be NULL    */
+ double        *spreadGrad);       /* (I/O) Spread rates. Can be NULL      */
+
+
 /*f
 ***************************************************************************
 ** Calculates the PV of the accruals which occur on default with delay.
@@ -52,6 +142,18 @@ int JpmcdsAccrualOnDefaultPVWithTimeLine
  double         *pv);
 
 
+/*f
+***************************************************************************
+** Calculates the accrued interest of a fee leg at stepinDate. This is the
+** amount JpmcdsFeeLegPV subtracts when payAccruedAtStart is set.
+***************************************************************************
+*/
+int JpmcdsFeeLegAI
+(TFeeLeg       *fl,
+ TDate          stepinDate,
+ double        *ai);
+
+
 /*f
 ***************************************************************************
 ** Computes the non-contingent cash flows for a fee leg.
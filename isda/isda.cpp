@@ -18,7 +18,14 @@
 #include "cds.h"
 #include <iomanip>
 #include "cxzerocurve.h"
+#include "cerror.h"
 #include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <functional>
 
 using namespace std;
 
@@ -31,19 +38,81 @@ return "Marshall Exception";
 
 } marshallexception;
 
+// curves kept per thread while pricing a grid of same-shaped spread curves
+static const int SCENARIO_CURVE_POOL_SIZE = 16;
+
+// standard conventions parsed once and shared by the pricing loops, NULL when
+// they fail to parse so the calls below report the error and fail as before
+static TCdsConventions* standard_cds_conventions()
+{
+	static TCdsConventions conventions;
+	static TCdsConventions *parsed =
+		make_cds_conventions(&conventions) == 0 ? &conventions : NULL;
+	return parsed;
+}
+
+// the standard conventions bootstrapping with newton, for the builders whose
+// curves are not compared exactly against a curve built with brent
+static TCdsConventions* newton_cds_conventions()
+{
+	static TCdsConventions conventions;
+	static TCdsConventions *parsed = standard_cds_conventions() == NULL ? NULL
+		: (conventions = *standard_cds_conventions(),
+		   conventions.bootstrapSolver = JPMCDS_BOOTSTRAP_NEWTON,
+		   &conventions);
+	return parsed;
+}
+
 TDate parse_string_ddmmyyyy(const std::string& s, int& day, int& month, int& year)
 {
   sscanf(s.c_str(), "%2d/%2d/%4d", &day, &month, &year);
   return JpmcdsDate(year, month, day);
 };
 
+// read up to max_digits digits from p, returns the number of digits read
+static int parse_digits(const char*& p, int max_digits, int& value)
+{
+  int n = 0;
+  value = 0;
+  while (n < max_digits && *p >= '0' && *p <= '9') {
+    value = value * 10 + (*p++ - '0');
+    n++;
+  }
+  return n;
+}
+
 TDate parse_string_ddmmyyyy_to_jpmcdsdate(const std::string& s)
 {
   int day, month, year;
+  const char* p = s.c_str();
+
+  // hand rolled D/M/YYYY scan, sscanf is kept for anything unusual (spaces, signs)
+  if (parse_digits(p, 2, day) > 0 && *p++ == '/'
+    && parse_digits(p, 2, month) > 0 && *p++ == '/'
+    && parse_digits(p, 4, year) > 0) {
+    return JpmcdsDate(year, month, day);
+  }
+
   sscanf(s.c_str(), "%2d/%2d/%4d", &day, &month, &year);
   return JpmcdsDate(year, month, day);
 };
 
+// TDate as an int YYYYMMDD, or -1 if the date cannot be converted
+static int jpmcdsdate_to_yyyymmdd(TDate date)
+{
+  TMonthDayYear mdy;
+  if (JpmcdsDateToMDY(date, &mdy) != SUCCESS) {
+    return -1;
+  }
+  return static_cast<int>(mdy.year * 10000 + mdy.month * 100 + mdy.day);
+}
+
+// widen python int dates to the long TDate arrays taken by the curve builders
+static vector<long int> to_jpmcdsdates(const vector<int>& dates)
+{
+  return vector<long int>(dates.begin(), dates.end());
+}
+
 //TDate parse_string_ddmmyyyy_to_jpmcdsdate_minus_one(const std::string& s)
 //{
 //  int day, month, year;
@@ -52,11 +121,12 @@ TDate parse_string_ddmmyyyy_to_jpmcdsdate(const std::string& s)
 //}
 
 
-vector< double >  calculate_spread_from_upfront_charge(
- string trade_date,						    /* (I) trade date of cds as DD/MM/YYYY */
- string maturity_date,						/* (I) maturity date of cds as DD/MM/YYYY */
- string accrual_start_date,				    /* (I) maturity date of cds as DD/MM/YYYY */
- string settle_date,                        /* (I) settlement date T+3 business days*/
+// calculate_spread_from_upfront_charge once its dates are TDates, shared by the string and TDate entry points
+static vector< double > spread_from_upfront_charge(
+ TDate trade_date_jpm,                      /* (I) trade date */
+ TDate maturity_date_jpm,                   /* (I) maturity date */
+ TDate accrual_start_date_jpm,              /* (I) accrual start date */
+ TDate settle_date_jpm,                     /* (I) settle date */
  double recovery_rate,				        /* (I) recover rate of the curve in basis points */
  double coupon_rate,						/* (I) CouponRate (e.g. 0.05 = 5% = 500bp) */
  double notional,							/* (I) Notional MM */
@@ -86,9 +156,6 @@ vector< double >  calculate_spread_from_upfront_charge(
 
     try {
 
-        TDate trade_date_jpm, maturity_date_jpm,
-        accrual_start_date_jpm, minus_1d_maturity_date_jpm, settle_date_jpm;
-
         vector<char*> cstrings_expiries{};
         vector<double> swap_rates_tmp;
         double coupon_rate_in_basis_points = coupon_rate / 10000.0;
@@ -96,16 +163,6 @@ vector< double >  calculate_spread_from_upfront_charge(
         string strings_type;
 
 
-        /////////////////////////////
-        // parse char* to jpm dates
-        /////////////////////////////
-
-        trade_date_jpm = parse_string_ddmmyyyy_to_jpmcdsdate(trade_date);
-        maturity_date_jpm = parse_string_ddmmyyyy_to_jpmcdsdate(maturity_date);
-        accrual_start_date_jpm = parse_string_ddmmyyyy_to_jpmcdsdate(accrual_start_date);
-        settle_date_jpm = parse_string_ddmmyyyy_to_jpmcdsdate(settle_date);
-
-
         if (verbose == 1) {
             std::cout << "trade_date_jpm " << trade_date_jpm << std::endl;
             std::cout << "accrual_start_date_jpm " << accrual_start_date_jpm << std::endl;
@@ -196,7 +253,7 @@ vector< double >  calculate_spread_from_upfront_charge(
         allinone.push_back(1);
         allinone.push_back((clock() - start_s));
 
-         FREE(zerocurve);
+         JpmcdsFreeTCurve(zerocurve);
     }
 
     catch(exception &e)
@@ -211,7 +268,7 @@ vector< double >  calculate_spread_from_upfront_charge(
     return allinone;
 };
 
-vector< double >  compute_isda_upfront(
+vector< double >  calculate_spread_from_upfront_charge(
  string trade_date,						    /* (I) trade date of cds as DD/MM/YYYY */
  string maturity_date,						/* (I) maturity date of cds as DD/MM/YYYY */
  string accrual_start_date,				    /* (I) maturity date of cds as DD/MM/YYYY */
@@ -222,6 +279,93 @@ vector< double >  compute_isda_upfront(
  int is_buy_protection,						/* (I) direction of credit risk */
  vector<double> swap_rates, 				/* (I) swap rates */
  vector<string> swap_tenors,			    /* (I) swap tenors "1M", "2M" */
+ double upfront_charge,                     /* (I) upfront charge */
+ int is_rofr,							    /* (I) rofr rates or libor */
+ int is_upfront_clean,						/* (I) is_upfront_clean = 0 means dirty is_upfront_clean = 1 means clean  */
+ string holiday_filename,                   /* (I) YYMMDD holiday.dat filename */
+ string swap_floating_day_count_convention, /* (I) swap_floating_payment_frequency ACT/360 */
+ string swap_fixed_day_count_convention,    /* (I) swap_fixed_day_count_convention 30/360*/
+ string swap_fixed_payment_frequency,       /* (I) swap_fixed_payment_frequency 1Y */
+ string swap_floating_payment_frequency,    /* (I) swap_floating_payment_frequency 1Y */
+ int verbose
+)
+{
+    return spread_from_upfront_charge(parse_string_ddmmyyyy_to_jpmcdsdate(trade_date)
+        , parse_string_ddmmyyyy_to_jpmcdsdate(maturity_date)
+        , parse_string_ddmmyyyy_to_jpmcdsdate(accrual_start_date)
+        , parse_string_ddmmyyyy_to_jpmcdsdate(settle_date)
+        , recovery_rate
+        , coupon_rate
+        , notional
+        , is_buy_protection
+        , swap_rates
+        , swap_tenors
+        , upfront_charge
+        , is_rofr
+        , is_upfront_clean
+        , holiday_filename
+        , swap_floating_day_count_convention
+        , swap_fixed_day_count_convention
+        , swap_fixed_payment_frequency
+        , swap_floating_payment_frequency
+        , verbose);
+};
+
+vector< double >  calculate_spread_from_upfront_charge_tdate(
+ int trade_date,                            /* (I) trade date of cds as TDate */
+ int maturity_date,                         /* (I) maturity date of cds as TDate */
+ int accrual_start_date,                    /* (I) accrual start date of cds as TDate */
+ int settle_date,                           /* (I) settle date of cds as TDate */
+ double recovery_rate,				        /* (I) recover rate of the curve in basis points */
+ double coupon_rate,						/* (I) CouponRate (e.g. 0.05 = 5% = 500bp) */
+ double notional,							/* (I) Notional MM */
+ int is_buy_protection,						/* (I) direction of credit risk */
+ vector<double> swap_rates, 				/* (I) swap rates */
+ vector<string> swap_tenors,			    /* (I) swap tenors "1M", "2M" */
+ double upfront_charge,                     /* (I) upfront charge */
+ int is_rofr,							    /* (I) rofr rates or libor */
+ int is_upfront_clean,						/* (I) is_upfront_clean = 0 means dirty is_upfront_clean = 1 means clean  */
+ string holiday_filename,                   /* (I) YYMMDD holiday.dat filename */
+ string swap_floating_day_count_convention, /* (I) swap_floating_payment_frequency ACT/360 */
+ string swap_fixed_day_count_convention,    /* (I) swap_fixed_day_count_convention 30/360*/
+ string swap_fixed_payment_frequency,       /* (I) swap_fixed_payment_frequency 1Y */
+ string swap_floating_payment_frequency,    /* (I) swap_floating_payment_frequency 1Y */
+ int verbose
+)
+{
+    return spread_from_upfront_charge(trade_date
+        , maturity_date
+        , accrual_start_date
+        , settle_date
+        , recovery_rate
+        , coupon_rate
+        , notional
+        , is_buy_protection
+        , swap_rates
+        , swap_tenors
+        , upfront_charge
+        , is_rofr
+        , is_upfront_clean
+        , holiday_filename
+        , swap_floating_day_count_convention
+        , swap_fixed_day_count_convention
+        , swap_fixed_payment_frequency
+        , swap_floating_payment_frequency
+        , verbose);
+};
+
+// compute_isda_upfront once its dates are TDates, shared by the string and TDate entry points
+static vector< double > isda_upfront(
+ TDate trade_date_jpm,                      /* (I) trade date */
+ TDate maturity_date_jpm,                   /* (I) maturity date */
+ TDate accrual_start_date_jpm,              /* (I) accrual start date */
+ TDate settle_date_jpm,                     /* (I) settle date */
+ double recovery_rate,				        /* (I) recover rate of the curve in basis points */
+ double coupon_rate,						/* (I) CouponRate (e.g. 0.05 = 5% = 500bp) */
+ double notional,							/* (I) Notional MM */
+ int is_buy_protection,						/* (I) direction of credit risk */
+ vector<double> swap_rates, 				/* (I) swap rates */
+ vector<string> swap_tenors,			    /* (I) swap tenors "1M", "2M" */
  double par_spread,                         /* (I) par spread */
  int is_rofr,							    /* (I) rofr rates or libor */
  string holiday_filename,                   /* (I) YYMMDD holiday.dat filename */
@@ -244,9 +388,6 @@ vector< double >  compute_isda_upfront(
 
     try {
 
-        TDate trade_date_jpm, maturity_date_jpm,
-        accrual_start_date_jpm, minus_1d_maturity_date_jpm, settle_date_jpm;
-
         vector<char*> cstrings_expiries{};
         vector<double> swap_rates_tmp;
         double coupon_rate_in_basis_points = coupon_rate / 10000.0;
@@ -255,16 +396,6 @@ vector< double >  compute_isda_upfront(
         string strings_type;
 
 
-        /////////////////////////////
-        // parse char* to jpm dates
-        /////////////////////////////
-
-        trade_date_jpm = parse_string_ddmmyyyy_to_jpmcdsdate(trade_date);
-        maturity_date_jpm = parse_string_ddmmyyyy_to_jpmcdsdate(maturity_date);
-        accrual_start_date_jpm = parse_string_ddmmyyyy_to_jpmcdsdate(accrual_start_date);
-        settle_date_jpm = parse_string_ddmmyyyy_to_jpmcdsdate(settle_date);
-
-
         if (verbose == 1) {
             std::cout << "trade_date_jpm " << trade_date_jpm << std::endl;
             std::cout << "accrual_start_date_jpm " << accrual_start_date_jpm << std::endl;
@@ -376,7 +507,7 @@ vector< double >  compute_isda_upfront(
         allinone.push_back(1);
         allinone.push_back((clock() - start_s));
 
-         FREE(zerocurve);
+         JpmcdsFreeTCurve(zerocurve);
     }
 
     catch(exception &e)
@@ -393,162 +524,714 @@ vector< double >  compute_isda_upfront(
     return allinone;
 };
 
-vector< double > cds_discount_rate_ir_tenor_dates(
-	string value_date,						/* (I) date to value the cds DD/MM/YYYY */
-	vector<string> value_dates,             /* (I) input forward dates DD/MM/YYYY */
-	vector<double> swap_rates, 				/* (I) swap rates */
-	vector<string> swap_tenors,				/* (I) swap tenors "1M", "2M" */
+vector< double >  compute_isda_upfront(
+ string trade_date,						    /* (I) trade date of cds as DD/MM/YYYY */
+ string maturity_date,						/* (I) maturity date of cds as DD/MM/YYYY */
+ string accrual_start_date,				    /* (I) maturity date of cds as DD/MM/YYYY */
+ string settle_date,                        /* (I) settlement date T+3 business days*/
+ double recovery_rate,				        /* (I) recover rate of the curve in basis points */
+ double coupon_rate,						/* (I) CouponRate (e.g. 0.05 = 5% = 500bp) */
+ double notional,							/* (I) Notional MM */
+ int is_buy_protection,						/* (I) direction of credit risk */
+ vector<double> swap_rates, 				/* (I) swap rates */
+ vector<string> swap_tenors,			    /* (I) swap tenors "1M", "2M" */
+ double par_spread,                         /* (I) par spread */
+ int is_rofr,							    /* (I) rofr rates or libor */
+ string holiday_filename,                   /* (I) YYMMDD holiday.dat filename */
+ string swap_floating_day_count_convention, /* (I) swap_floating_payment_frequency ACT/360 */
+ string swap_fixed_day_count_convention,    /* (I) swap_fixed_day_count_convention 30/360*/
+ string swap_fixed_payment_frequency,       /* (I) swap_fixed_payment_frequency 1Y */
+ string swap_floating_payment_frequency,    /* (I) swap_floating_payment_frequency 1Y */
+ int verbose
+)
+{
+    return isda_upfront(parse_string_ddmmyyyy_to_jpmcdsdate(trade_date)
+        , parse_string_ddmmyyyy_to_jpmcdsdate(maturity_date)
+        , parse_string_ddmmyyyy_to_jpmcdsdate(accrual_start_date)
+        , parse_string_ddmmyyyy_to_jpmcdsdate(settle_date)
+        , recovery_rate
+        , coupon_rate
+        , notional
+        , is_buy_protection
+        , swap_rates
+        , swap_tenors
+        , par_spread
+        , is_rofr
+        , holiday_filename
+        , swap_floating_day_count_convention
+        , swap_fixed_day_count_convention
+        , swap_fixed_payment_frequency
+        , swap_floating_payment_frequency
+        , verbose);
+};
+
+vector< double >  compute_isda_upfront_tdate(
+ int trade_date,                            /* (I) trade date of cds as TDate */
+ int maturity_date,                         /* (I) maturity date of cds as TDate */
+ int accrual_start_date,                    /* (I) accrual start date of cds as TDate */
+ int settle_date,                           /* (I) settle date of cds as TDate */
+ double recovery_rate,				        /* (I) recover rate of the curve in basis points */
+ double coupon_rate,						/* (I) CouponRate (e.g. 0.05 = 5% = 500bp) */
+ double notional,							/* (I) Notional MM */
+ int is_buy_protection,						/* (I) direction of credit risk */
+ vector<double> swap_rates, 				/* (I) swap rates */
+ vector<string> swap_tenors,			    /* (I) swap tenors "1M", "2M" */
+ double par_spread,                         /* (I) par spread */
+ int is_rofr,							    /* (I) rofr rates or libor */
+ string holiday_filename,                   /* (I) YYMMDD holiday.dat filename */
+ string swap_floating_day_count_convention, /* (I) swap_floating_payment_frequency ACT/360 */
+ string swap_fixed_day_count_convention,    /* (I) swap_fixed_day_count_convention 30/360*/
+ string swap_fixed_payment_frequency,       /* (I) swap_fixed_payment_frequency 1Y */
+ string swap_floating_payment_frequency,    /* (I) swap_floating_payment_frequency 1Y */
+ int verbose
+)
+{
+    return isda_upfront(trade_date
+        , maturity_date
+        , accrual_start_date
+        , settle_date
+        , recovery_rate
+        , coupon_rate
+        , notional
+        , is_buy_protection
+        , swap_rates
+        , swap_tenors
+        , par_spread
+        , is_rofr
+        , holiday_filename
+        , swap_floating_day_count_convention
+        , swap_fixed_day_count_convention
+        , swap_fixed_payment_frequency
+        , swap_floating_payment_frequency
+        , verbose);
+};
+
+// bootstrap the discount curve shared by a batch of quotes, NULL on failure
+static TCurve* build_quote_zero_curve(
+	TDate trade_date_jpm,
+	vector<double>& swap_rates,
+	vector<string>& swap_tenors,
+	int is_rofr,
+	string& holiday_filename,
+	string& swap_floating_day_count_convention,
+	string& swap_fixed_day_count_convention,
+	string& swap_fixed_payment_frequency,
+	string& swap_floating_payment_frequency,
 	int verbose
 ) {
 
-	TDate value_date_jpm, tmp_date_jpm;
-	vector <double> allinone;
 	vector<char*> cstrings_expiries{};
-	vector<double> swap_rates_tmp;
-
-	// empty curve pointers
-	TCurve *zerocurve = NULL;
+	string strings_type;
 
-    value_date_jpm = parse_string_ddmmyyyy_to_jpmcdsdate(value_date);
+	for (auto& string : swap_tenors) {
+		cstrings_expiries.push_back(&string.front());
+	}
 
-	for (int r = 0; r < static_cast<int>(swap_rates.size()); r++) {
-		swap_rates_tmp.push_back(swap_rates[r]);
+	if (is_rofr != 1) {
+		return build_zero_interest_rate_curve(trade_date_jpm
+			, swap_rates.data()
+			, cstrings_expiries.data()
+			, verbose);
 	}
 
-	for (auto& string : swap_tenors) {
-		cstrings_expiries.push_back(&string.front());
+	for (int r = 0; r < static_cast<int>(swap_tenors.size()); r++) {
+		strings_type += "S";
 	}
 
-	// bootstrap discount curve
-	zerocurve = build_zero_interest_rate_curve(value_date_jpm
-		, swap_rates_tmp.data()
+	return build_zero_interest_rate_curve_rofr(trade_date_jpm
+		, swap_rates.data()
 		, cstrings_expiries.data()
+		, static_cast<int>(swap_rates.size())
+		, const_cast<char*>(strings_type.c_str())
+		, const_cast<char*>(swap_floating_day_count_convention.c_str())
+		, const_cast<char*>(swap_fixed_day_count_convention.c_str())
+		, const_cast<char*>(swap_fixed_payment_frequency.c_str())
+		, const_cast<char*>(swap_floating_payment_frequency.c_str())
+		, const_cast<char*>(holiday_filename.c_str())
 		, verbose);
+}
 
-    for (int s = 0; s < static_cast<int>(value_dates.size()); s++) {
-        tmp_date_jpm = parse_string_ddmmyyyy_to_jpmcdsdate(value_dates[s]);
-        allinone.push_back(JpmcdsZeroPrice(zerocurve, tmp_date_jpm));
-    }
-
-	FREE(zerocurve);
-
-	reverse(allinone.begin(), allinone.end());
+// run price_quote over quotes 0..n-1 handed out to number_of_threads workers
+static void run_quote_workers(
+	int n,
+	int number_of_threads,
+	const std::function<void(int)>& price_quote
+) {
 
-	return allinone;
+	std::atomic<int> next_quote(0);
 
-};
+	if (number_of_threads <= 0) {
+		number_of_threads = static_cast<int>(std::thread::hardware_concurrency());
+	}
+	number_of_threads = std::max(1, std::min(number_of_threads, n));
+
+	// quotes on a worker allocate the same temporaries, so their blocks are recycled
+	auto drain = [&]() {
+		JpmcdsErrMsgEnableRecord(20, 128);
+		JpmcdsArenaStart(JPMCDS_ARENA_SIZE);
+		for (int r = next_quote++; r < n; r = next_quote++) {
+			price_quote(r);
+		}
+		JpmcdsArenaStop();
+	};
+
+	// each worker gets its own error record from the pricing calls, free it
+	// before the thread exits
+	vector<std::thread> workers;
+	for (int w = 1; w < number_of_threads; w++) {
+		workers.push_back(std::thread([&]() {
+			drain();
+			JpmcdsErrMsgDisableRecord();
+		}));
+	}
 
-vector< vector<double> > cds_coupon_schedule(
-    string accrual_start_date, /* (I) maturity date of cds as DD/MM/YYYY */
-    string maturity_date, /* (I) maturity date of cds as DD/MM/YYYY */
-    string coupon_interval, /* (I) maturity date of cds as DD/MM/YYYY */
-    string day_count_convention, /* (I) day_count_convention Act/360 */
-    string stub_method, /* (I) stub_method F/S/20 */
-    string holiday_filename, /* (I) day_count_convention Act/360 */
-    double coupon_rate, /* (I) coupon_rate 1.0 1% */
-    double notional, /* (I) notional 1.0 MM */
-    int verbose
-){
+	drain();
 
+	for (auto& worker : workers) {
+		worker.join();
+	}
+}
 
-    static char *routine = "isda_cds_payment_schedule";
+// compute_isda_upfront_vector once its dates are TDates, shared by the string and TDate entry points
+static vector< vector<double> > isda_upfront_vector(
+	TDate trade_date_jpm,					/* (I) trade date of cds */
+	TDate accrual_start_date_jpm,			/* (I) accrual start date of cds */
+	TDate settle_date_jpm,					/* (I) settlement date T+3 business days */
+	vector<long int> maturity_dates_jpm,	/* (I) maturity date per quote */
+	vector<double> coupon_rates,			/* (I) CouponRate per quote (e.g. 100 = 1%) */
+	vector<double> recovery_rates,			/* (I) recovery rate per quote */
+	vector<double> par_spreads,				/* (I) par spread per quote */
+	vector<double> swap_rates, 				/* (I) swap rates */
+	vector<string> swap_tenors,				/* (I) swap tenors "1M", "2M" */
+	int is_rofr,							/* (I) rofr rates or libor */
+	string holiday_filename,				/* (I) YYMMDD holiday.dat filename */
+	string swap_floating_day_count_convention, /* (I) swap_floating_day_count_convention ACT/360 */
+	string swap_fixed_day_count_convention,	/* (I) swap_fixed_day_count_convention 30/360 */
+	string swap_fixed_payment_frequency,	/* (I) swap_fixed_payment_frequency 1Y */
+	string swap_floating_payment_frequency,	/* (I) swap_floating_payment_frequency 1Y */
+	int number_of_threads,					/* (I) worker threads, 0 uses every core */
+	int verbose
+) {
 
-    // outer return vector
-    vector < vector<double> > allinone;
-    // inner return vector
-    vector <double> allinone_base;
-    vector <double> allinone_date;
-    vector <double> allinone_amount;
+	int start_s = clock();
 
-    TDateInterval  couponInterval;
-    TStubMethod    stubMethod;
-    TCashFlowList  *cashFlowList;
-    //double         notional;
-    //double         couponRate;
-    long int       paymentDcc;
+	int n = static_cast<int>(maturity_dates_jpm.size());
 
-    //notional = 1.0;
-    //couponRate = 1.0;
-    paymentDcc = 0;
+	// outer return vector, one contiguous column per measure
+	vector < vector<double> > allinone(4, vector<double>(n, 0.0));
 
-    TDate maturity_date_jpm, accrual_start_date_jpm;
+	bool columns_ok = static_cast<int>(coupon_rates.size()) == n
+		&& static_cast<int>(recovery_rates.size()) == n
+		&& static_cast<int>(par_spreads.size()) == n;
 
-    int start_s = clock();
+	// one discount curve for every quote
+	TCurve *zerocurve = columns_ok ? build_quote_zero_curve(trade_date_jpm
+		, swap_rates
+		, swap_tenors
+		, is_rofr
+		, holiday_filename
+		, swap_floating_day_count_convention
+		, swap_fixed_day_count_convention
+		, swap_fixed_payment_frequency
+		, swap_floating_payment_frequency
+		, verbose) : NULL;
 
-    try{
+	if (zerocurve == NULL) {
+		if (verbose) {
+			std::cout << (columns_ok ? "zerocurve == NULL" : "quote columns must all have the same size") << std::endl;
+		}
+		std::fill(allinone[3].begin(), allinone[3].end(), -1);
+	} else {
 
-    /////////////////////////////
-    // parse char* to jpm dates
-    /////////////////////////////
+		char* c_holiday_filename = const_cast<char*>(holiday_filename.c_str());
 
-    maturity_date_jpm = parse_string_ddmmyyyy_to_jpmcdsdate(maturity_date);
-    accrual_start_date_jpm = parse_string_ddmmyyyy_to_jpmcdsdate(accrual_start_date);
+		run_quote_workers(n, number_of_threads, [&](int r) {
 
-    char* c_coupon_interval = const_cast<char*>(coupon_interval.c_str());
-    if (JpmcdsStringToDateInterval(c_coupon_interval, routine, &couponInterval) != SUCCESS)
-    {
-    throw marshallexception;
-    }
+			double coupon_rate_in_basis_points = coupon_rates[r] / 10000.0;
 
-    char* c_stub_method = const_cast<char*>(stub_method.c_str());
-    if (JpmcdsStringToStubMethod(c_stub_method, &stubMethod) != SUCCESS)
-    {
-    throw marshallexception;
-    }
+			allinone[0][r] = calculate_upfront_charge_with_conventions(standard_cds_conventions()
+				, trade_date_jpm
+				, maturity_dates_jpm[r]
+				, accrual_start_date_jpm
+				, settle_date_jpm
+				, zerocurve
+				, coupon_rate_in_basis_points
+				, par_spreads[r]
+				, recovery_rates[r]
+				, 1.0
+				, c_holiday_filename
+				, 0
+				, verbose);
 
+			allinone[1][r] = calculate_upfront_charge_with_conventions(standard_cds_conventions()
+				, trade_date_jpm
+				, maturity_dates_jpm[r]
+				, accrual_start_date_jpm
+				, settle_date_jpm
+				, zerocurve
+				, coupon_rate_in_basis_points
+				, par_spreads[r]
+				, recovery_rates[r]
+				, 1.0
+				, c_holiday_filename
+				, 1
+				, verbose);
 
-    char* c_day_count_convention = const_cast<char*>(day_count_convention.c_str());
-    if (JpmcdsStringToDayCountConv(c_day_count_convention, &paymentDcc) != SUCCESS)
-    {
-    throw marshallexception;
-    }
+			allinone[2][r] = allinone[0][r] - allinone[1][r];
+			allinone[3][r] = 1;
+		});
 
-    char* c_holiday_filename = const_cast<char*>(holiday_filename.c_str());
+		JpmcdsFreeTCurve(zerocurve);
+	}
 
-    cashFlowList = JpmcdsCdsFeeLegFlows
-    (accrual_start_date_jpm,
-    maturity_date_jpm,
-    &couponInterval,
-    &stubMethod,
-    notional,
-    coupon_rate,
-    paymentDcc,
-    'F',
-    c_holiday_filename);
+	vector <double> allinone_time;
+	allinone_time.push_back((clock() - start_s));
+	allinone.push_back(allinone_time);
 
-    if (cashFlowList == NULL) {
-        std::cout << cashFlowList << std::endl;
-        std::cout << "bad cashFlowList" << std::endl;
-        throw marshallexception;
-    }
+	return allinone;
+};
 
-    // decompose TCashFlowList into a vector object
-    int idx = 0;
-    TMonthDayYear mdy;
+vector< vector<double> > compute_isda_upfront_vector(
+	string trade_date,						/* (I) trade date of cds as DD/MM/YYYY */
+	string accrual_start_date,				/* (I) accrual start date of cds as DD/MM/YYYY */
+	string settle_date,						/* (I) settlement date T+3 business days */
+	vector<string> maturity_dates,			/* (I) maturity date per quote DD/MM/YYYY */
+	vector<double> coupon_rates,			/* (I) CouponRate per quote (e.g. 100 = 1%) */
+	vector<double> recovery_rates,			/* (I) recovery rate per quote */
+	vector<double> par_spreads,				/* (I) par spread per quote */
+	vector<double> swap_rates, 				/* (I) swap rates */
+	vector<string> swap_tenors,				/* (I) swap tenors "1M", "2M" */
+	int is_rofr,							/* (I) rofr rates or libor */
+	string holiday_filename,				/* (I) YYMMDD holiday.dat filename */
+	string swap_floating_day_count_convention, /* (I) swap_floating_day_count_convention ACT/360 */
+	string swap_fixed_day_count_convention,	/* (I) swap_fixed_day_count_convention 30/360 */
+	string swap_fixed_payment_frequency,	/* (I) swap_fixed_payment_frequency 1Y */
+	string swap_floating_payment_frequency,	/* (I) swap_floating_payment_frequency 1Y */
+	int number_of_threads,					/* (I) worker threads, 0 uses every core */
+	int verbose
+) {
 
-    for (idx = 0; idx < cashFlowList->fNumItems; idx++)
-    {
+	vector<long int> maturity_dates_jpm;
+	for (int r = 0; r < static_cast<int>(maturity_dates.size()); r++) {
+		maturity_dates_jpm.push_back(parse_string_ddmmyyyy_to_jpmcdsdate(maturity_dates[r]));
+	}
 
-    // TODO: move into function call
-    std::stringstream ss;
+	return isda_upfront_vector(parse_string_ddmmyyyy_to_jpmcdsdate(trade_date)
+		, parse_string_ddmmyyyy_to_jpmcdsdate(accrual_start_date)
+		, parse_string_ddmmyyyy_to_jpmcdsdate(settle_date)
+		, maturity_dates_jpm
+		, coupon_rates
+		, recovery_rates
+		, par_spreads
+		, swap_rates
+		, swap_tenors
+		, is_rofr
+		, holiday_filename
+		, swap_floating_day_count_convention
+		, swap_fixed_day_count_convention
+		, swap_fixed_payment_frequency
+		, swap_floating_payment_frequency
+		, number_of_threads
+		, verbose);
+};
 
-    if (JpmcdsDateToMDY(cashFlowList->fArray[idx].fDate, &mdy) != SUCCESS)
-    {
-        throw marshallexception;
-    }
-    if (JpmcdsNormalizeMDY(&mdy) != SUCCESS)
-    {
-        throw marshallexception;
-    }
+vector< vector<double> > compute_isda_upfront_vector_tdate(
+	int trade_date,							/* (I) trade date of cds as TDate */
+	int accrual_start_date,					/* (I) accrual start date of cds as TDate */
+	int settle_date,						/* (I) settlement date T+3 business days as TDate */
+	vector<int> maturity_dates,				/* (I) maturity date per quote as TDate */
+	vector<double> coupon_rates,			/* (I) CouponRate per quote (e.g. 100 = 1%) */
+	vector<double> recovery_rates,			/* (I) recovery rate per quote */
+	vector<double> par_spreads,				/* (I) par spread per quote */
+	vector<double> swap_rates, 				/* (I) swap rates */
+	vector<string> swap_tenors,				/* (I) swap tenors "1M", "2M" */
+	int is_rofr,							/* (I) rofr rates or libor */
+	string holiday_filename,				/* (I) YYMMDD holiday.dat filename */
+	string swap_floating_day_count_convention, /* (I) swap_floating_day_count_convention ACT/360 */
+	string swap_fixed_day_count_convention,	/* (I) swap_fixed_day_count_convention 30/360 */
+	string swap_fixed_payment_frequency,	/* (I) swap_fixed_payment_frequency 1Y */
+	string swap_floating_payment_frequency,	/* (I) swap_floating_payment_frequency 1Y */
+	int number_of_threads,					/* (I) worker threads, 0 uses every core */
+	int verbose
+) {
 
-    ss << std::setw(2) << std::setfill('0') << mdy.day;
-    ss << std::setw(2) << std::setfill('0') << mdy.month;
-    ss << std::setw(4) << std::setfill('0') << mdy.year;
+	return isda_upfront_vector(trade_date
+		, accrual_start_date
+		, settle_date
+		, to_jpmcdsdates(maturity_dates)
+		, coupon_rates
+		, recovery_rates
+		, par_spreads
+		, swap_rates
+		, swap_tenors
+		, is_rofr
+		, holiday_filename
+		, swap_floating_day_count_convention
+		, swap_fixed_day_count_convention
+		, swap_fixed_payment_frequency
+		, swap_floating_payment_frequency
+		, number_of_threads
+		, verbose);
+};
 
-    // convert stream to string
-    std::string s = ss.str();
+// calculate_spread_from_upfront_charge_vector once its dates are TDates, shared by the string and TDate entry points
+static vector< vector<double> > spread_from_upfront_charge_vector(
+	TDate trade_date_jpm,					/* (I) trade date of cds */
+	TDate accrual_start_date_jpm,			/* (I) accrual start date of cds */
+	TDate settle_date_jpm,					/* (I) settlement date T+3 business days */
+	vector<long int> maturity_dates_jpm,	/* (I) maturity date per quote */
+	vector<double> coupon_rates,			/* (I) CouponRate per quote (e.g. 100 = 1%) */
+	vector<double> recovery_rates,			/* (I) recovery rate per quote */
+	vector<double> upfront_charges,			/* (I) upfront charge per quote */
+	vector<double> spread_guesses,			/* (I) starting spread per quote as returned, empty starts from the coupons */
+	int is_upfront_clean,					/* (I) is_upfront_clean = 0 means dirty is_upfront_clean = 1 means clean */
+	vector<double> swap_rates, 				/* (I) swap rates */
+	vector<string> swap_tenors,				/* (I) swap tenors "1M", "2M" */
+	int is_rofr,							/* (I) rofr rates or libor */
+	string holiday_filename,				/* (I) YYMMDD holiday.dat filename */
+	string swap_floating_day_count_convention, /* (I) swap_floating_day_count_convention ACT/360 */
+	string swap_fixed_day_count_convention,	/* (I) swap_fixed_day_count_convention 30/360 */
+	string swap_fixed_payment_frequency,	/* (I) swap_fixed_payment_frequency 1Y */
+	string swap_floating_payment_frequency,	/* (I) swap_floating_payment_frequency 1Y */
+	int number_of_threads,					/* (I) worker threads, 0 uses every core */
+	int verbose
+) {
+
+	int start_s = clock();
+
+	int n = static_cast<int>(maturity_dates_jpm.size());
+
+	// outer return vector, one contiguous column per measure
+	vector < vector<double> > allinone(2, vector<double>(n, 0.0));
+
+	bool columns_ok = static_cast<int>(coupon_rates.size()) == n
+		&& static_cast<int>(recovery_rates.size()) == n
+		&& static_cast<int>(upfront_charges.size()) == n
+		&& (spread_guesses.empty() || static_cast<int>(spread_guesses.size()) == n);
+
+	// one discount curve for every quote
+	TCurve *zerocurve = columns_ok ? build_quote_zero_curve(trade_date_jpm
+		, swap_rates
+		, swap_tenors
+		, is_rofr
+		, holiday_filename
+		, swap_floating_day_count_convention
+		, swap_fixed_day_count_convention
+		, swap_fixed_payment_frequency
+		, swap_floating_payment_frequency
+		, verbose) : NULL;
+
+	if (zerocurve == NULL) {
+		if (verbose) {
+			std::cout << (columns_ok ? "zerocurve == NULL" : "quote columns must all have the same size") << std::endl;
+		}
+		std::fill(allinone[1].begin(), allinone[1].end(), -1);
+	} else {
+
+		char* c_holiday_filename = const_cast<char*>(holiday_filename.c_str());
+
+		run_quote_workers(n, number_of_threads, [&](int r) {
+
+			allinone[0][r] = calculate_spread_from_upfront_charge_with_conventions(standard_cds_conventions()
+				, trade_date_jpm
+				, maturity_dates_jpm[r]
+				, accrual_start_date_jpm
+				, settle_date_jpm
+				, zerocurve
+				, coupon_rates[r] / 10000.0
+				, upfront_charges[r]
+				, recovery_rates[r]
+				, 1.0
+				, c_holiday_filename
+				, is_upfront_clean
+				, spread_guesses.empty() ? 0.0 : spread_guesses[r]
+				, verbose);
+
+			// the solver reports failure as a spread of -1
+			allinone[1][r] = allinone[0][r] < 0.0 ? -1 : 1;
+		});
+
+		JpmcdsFreeTCurve(zerocurve);
+	}
+
+	vector <double> allinone_time;
+	allinone_time.push_back((clock() - start_s));
+	allinone.push_back(allinone_time);
+
+	return allinone;
+};
+
+vector< vector<double> > calculate_spread_from_upfront_charge_vector(
+	string trade_date,						/* (I) trade date of cds as DD/MM/YYYY */
+	string accrual_start_date,				/* (I) accrual start date of cds as DD/MM/YYYY */
+	string settle_date,						/* (I) settlement date T+3 business days */
+	vector<string> maturity_dates,			/* (I) maturity date per quote DD/MM/YYYY */
+	vector<double> coupon_rates,			/* (I) CouponRate per quote (e.g. 100 = 1%) */
+	vector<double> recovery_rates,			/* (I) recovery rate per quote */
+	vector<double> upfront_charges,			/* (I) upfront charge per quote */
+	vector<double> spread_guesses,			/* (I) starting spread per quote as returned, empty starts from the coupons */
+	int is_upfront_clean,					/* (I) is_upfront_clean = 0 means dirty is_upfront_clean = 1 means clean */
+	vector<double> swap_rates, 				/* (I) swap rates */
+	vector<string> swap_tenors,				/* (I) swap tenors "1M", "2M" */
+	int is_rofr,							/* (I) rofr rates or libor */
+	string holiday_filename,				/* (I) YYMMDD holiday.dat filename */
+	string swap_floating_day_count_convention, /* (I) swap_floating_day_count_convention ACT/360 */
+	string swap_fixed_day_count_convention,	/* (I) swap_fixed_day_count_convention 30/360 */
+	string swap_fixed_payment_frequency,	/* (I) swap_fixed_payment_frequency 1Y */
+	string swap_floating_payment_frequency,	/* (I) swap_floating_payment_frequency 1Y */
+	int number_of_threads,					/* (I) worker threads, 0 uses every core */
+	int verbose
+) {
+
+	vector<long int> maturity_dates_jpm;
+	for (int r = 0; r < static_cast<int>(maturity_dates.size()); r++) {
+		maturity_dates_jpm.push_back(parse_string_ddmmyyyy_to_jpmcdsdate(maturity_dates[r]));
+	}
+
+	return spread_from_upfront_charge_vector(parse_string_ddmmyyyy_to_jpmcdsdate(trade_date)
+		, parse_string_ddmmyyyy_to_jpmcdsdate(accrual_start_date)
+		, parse_string_ddmmyyyy_to_jpmcdsdate(settle_date)
+		, maturity_dates_jpm
+		, coupon_rates
+		, recovery_rates
+		, upfront_charges
+		, spread_guesses
+		, is_upfront_clean
+		, swap_rates
+		, swap_tenors
+		, is_rofr
+		, holiday_filename
+		, swap_floating_day_count_convention
+		, swap_fixed_day_count_convention
+		, swap_fixed_payment_frequency
+		, swap_floating_payment_frequency
+		, number_of_threads
+		, verbose);
+};
+
+vector< vector<double> > calculate_spread_from_upfront_charge_vector_tdate(
+	int trade_date,							/* (I) trade date of cds as TDate */
+	int accrual_start_date,					/* (I) accrual start date of cds as TDate */
+	int settle_date,						/* (I) settlement date T+3 business days as TDate */
+	vector<int> maturity_dates,				/* (I) maturity date per quote as TDate */
+	vector<double> coupon_rates,			/* (I) CouponRate per quote (e.g. 100 = 1%) */
+	vector<double> recovery_rates,			/* (I) recovery rate per quote */
+	vector<double> upfront_charges,			/* (I) upfront charge per quote */
+	vector<double> spread_guesses,			/* (I) starting spread per quote as returned, empty starts from the coupons */
+	int is_upfront_clean,					/* (I) is_upfront_clean = 0 means dirty is_upfront_clean = 1 means clean */
+	vector<double> swap_rates, 				/* (I) swap rates */
+	vector<string> swap_tenors,				/* (I) swap tenors "1M", "2M" */
+	int is_rofr,							/* (I) rofr rates or libor */
+	string holiday_filename,				/* (I) YYMMDD holiday.dat filename */
+	string swap_floating_day_count_convention, /* (I) swap_floating_day_count_convention ACT/360 */
+	string swap_fixed_day_count_convention,	/* (I) swap_fixed_day_count_convention 30/360 */
+	string swap_fixed_payment_frequency,	/* (I) swap_fixed_payment_frequency 1Y */
+	string swap_floating_payment_frequency,	/* (I) swap_floating_payment_frequency 1Y */
+	int number_of_threads,					/* (I) worker threads, 0 uses every core */
+	int verbose
+) {
+
+	return spread_from_upfront_charge_vector(trade_date
+		, accrual_start_date
+		, settle_date
+		, to_jpmcdsdates(maturity_dates)
+		, coupon_rates
+		, recovery_rates
+		, upfront_charges
+		, spread_guesses
+		, is_upfront_clean
+		, swap_rates
+		, swap_tenors
+		, is_rofr
+		, holiday_filename
+		, swap_floating_day_count_convention
+		, swap_fixed_day_count_convention
+		, swap_fixed_payment_frequency
+		, swap_floating_payment_frequency
+		, number_of_threads
+		, verbose);
+};
+
+// cds_discount_rate_ir_tenor_dates once its dates are TDates, shared by the string and TDate entry points
+static vector< double > discount_rate_ir_tenor_dates(
+	TDate value_date_jpm,					/* (I) date to value the cds */
+	vector<long int> value_dates_jpm,		/* (I) input forward dates */
+	vector<double> swap_rates, 				/* (I) swap rates */
+	vector<string> swap_tenors,				/* (I) swap tenors "1M", "2M" */
+	int verbose
+) {
+
+	vector <double> allinone;
+	vector<char*> cstrings_expiries{};
+	vector<double> swap_rates_tmp;
+
+	// empty curve pointers
+	TCurve *zerocurve = NULL;
+
+	for (int r = 0; r < static_cast<int>(swap_rates.size()); r++) {
+		swap_rates_tmp.push_back(swap_rates[r]);
+	}
+
+	for (auto& string : swap_tenors) {
+		cstrings_expiries.push_back(&string.front());
+	}
+
+	// bootstrap discount curve
+	zerocurve = build_zero_interest_rate_curve(value_date_jpm
+		, swap_rates_tmp.data()
+		, cstrings_expiries.data()
+		, verbose);
+
+    for (int s = 0; s < static_cast<int>(value_dates_jpm.size()); s++) {
+        allinone.push_back(JpmcdsZeroPrice(zerocurve, value_dates_jpm[s]));
+    }
+
+	JpmcdsFreeTCurve(zerocurve);
+
+	reverse(allinone.begin(), allinone.end());
+
+	return allinone;
+
+};
+
+vector< double > cds_discount_rate_ir_tenor_dates(
+	string value_date,						/* (I) date to value the cds DD/MM/YYYY */
+	vector<string> value_dates,             /* (I) input forward dates DD/MM/YYYY */
+	vector<double> swap_rates, 				/* (I) swap rates */
+	vector<string> swap_tenors,				/* (I) swap tenors "1M", "2M" */
+	int verbose
+) {
+
+	vector<long int> value_dates_jpm;
+	for (int s = 0; s < static_cast<int>(value_dates.size()); s++) {
+		value_dates_jpm.push_back(parse_string_ddmmyyyy_to_jpmcdsdate(value_dates[s]));
+	}
+
+	return discount_rate_ir_tenor_dates(parse_string_ddmmyyyy_to_jpmcdsdate(value_date)
+		, value_dates_jpm
+		, swap_rates
+		, swap_tenors
+		, verbose);
+};
+
+vector< double > cds_discount_rate_ir_tenor_dates_tdate(
+	int value_date,							/* (I) date to value the cds as TDate */
+	vector<int> value_dates,				/* (I) input forward dates as TDate */
+	vector<double> swap_rates, 				/* (I) swap rates */
+	vector<string> swap_tenors,				/* (I) swap tenors "1M", "2M" */
+	int verbose
+) {
+
+	return discount_rate_ir_tenor_dates(value_date
+		, to_jpmcdsdates(value_dates)
+		, swap_rates
+		, swap_tenors
+		, verbose);
+};
+
+// coupon schedule once its dates are TDates, payment dates returned as TDates
+// or as the DDMMYYYY numbers of the string entry point
+static vector< vector<double> > coupon_schedule(
+    TDate accrual_start_date_jpm, /* (I) accrual start date of cds */
+    TDate maturity_date_jpm, /* (I) maturity date of cds */
+    int is_tdate_output, /* (I) 1 payment dates as TDate, 0 as DDMMYYYY */
+    string coupon_interval, /* (I) maturity date of cds as DD/MM/YYYY */
+    string day_count_convention, /* (I) day_count_convention Act/360 */
+    string stub_method, /* (I) stub_method F/S/20 */
+    string holiday_filename, /* (I) day_count_convention Act/360 */
+    double coupon_rate, /* (I) coupon_rate 1.0 1% */
+    double notional, /* (I) notional 1.0 MM */
+    int verbose
+){
+
+
+    static char *routine = "isda_cds_payment_schedule";
+
+    // outer return vector
+    vector < vector<double> > allinone;
+    // inner return vector
+    vector <double> allinone_base;
+    vector <double> allinone_date;
+    vector <double> allinone_amount;
+
+    TDateInterval  couponInterval;
+    TStubMethod    stubMethod;
+    TCashFlowList  *cashFlowList;
+    //double         notional;
+    //double         couponRate;
+    long int       paymentDcc;
+
+    //notional = 1.0;
+    //couponRate = 1.0;
+    paymentDcc = 0;
 
-    allinone_date.push_back(std::stoi(s));
+    int start_s = clock();
+
+    try{
+
+    char* c_coupon_interval = const_cast<char*>(coupon_interval.c_str());
+    if (JpmcdsStringToDateInterval(c_coupon_interval, routine, &couponInterval) != SUCCESS)
+    {
+    throw marshallexception;
+    }
+
+    char* c_stub_method = const_cast<char*>(stub_method.c_str());
+    if (JpmcdsStringToStubMethod(c_stub_method, &stubMethod) != SUCCESS)
+    {
+    throw marshallexception;
+    }
+
+
+    char* c_day_count_convention = const_cast<char*>(day_count_convention.c_str());
+    if (JpmcdsStringToDayCountConv(c_day_count_convention, &paymentDcc) != SUCCESS)
+    {
+    throw marshallexception;
+    }
+
+    char* c_holiday_filename = const_cast<char*>(holiday_filename.c_str());
+
+    cashFlowList = JpmcdsCdsFeeLegFlows
+    (accrual_start_date_jpm,
+    maturity_date_jpm,
+    &couponInterval,
+    &stubMethod,
+    notional,
+    coupon_rate,
+    paymentDcc,
+    'F',
+    c_holiday_filename);
+
+    if (cashFlowList == NULL) {
+        std::cout << cashFlowList << std::endl;
+        std::cout << "bad cashFlowList" << std::endl;
+        throw marshallexception;
+    }
+
+    // decompose TCashFlowList into a vector object
+    int idx = 0;
+    TMonthDayYear mdy;
+
+    for (idx = 0; idx < cashFlowList->fNumItems; idx++)
+    {
+
+    if (is_tdate_output)
+    {
+        allinone_date.push_back(cashFlowList->fArray[idx].fDate);
+    }
+    else
+    {
+        if (JpmcdsDateToMDY(cashFlowList->fArray[idx].fDate, &mdy) != SUCCESS)
+        {
+            throw marshallexception;
+        }
+        if (JpmcdsNormalizeMDY(&mdy) != SUCCESS)
+        {
+            throw marshallexception;
+        }
+
+        // DDMMYYYY digits read as a number
+        allinone_date.push_back(mdy.day * 1000000 + mdy.month * 10000 + mdy.year);
+    }
     allinone_amount.push_back(cashFlowList->fArray[idx].fAmount);
     }
 
@@ -573,34 +1256,85 @@ vector< vector<double> > cds_coupon_schedule(
 
 };
 
-vector< vector<double> > cds_all_in_one(
-	string trade_date,						/* (I) trade date of cds as DD/MM/YYYY */
-	string effective_date,					/* (I) effective date of cds as DD/MM/YYYY */
-	string maturity_date,					/* (I) maturity date of cds as DD/MM/YYYY */
-	string value_date,						/* (I) date to value the cds DD/MM/YYYY */
-	string accrual_start_date,				/* (I) maturity date of cds as DD/MM/YYYY */
+vector< vector<double> > cds_coupon_schedule(
+    string accrual_start_date, /* (I) maturity date of cds as DD/MM/YYYY */
+    string maturity_date, /* (I) maturity date of cds as DD/MM/YYYY */
+    string coupon_interval, /* (I) maturity date of cds as DD/MM/YYYY */
+    string day_count_convention, /* (I) day_count_convention Act/360 */
+    string stub_method, /* (I) stub_method F/S/20 */
+    string holiday_filename, /* (I) day_count_convention Act/360 */
+    double coupon_rate, /* (I) coupon_rate 1.0 1% */
+    double notional, /* (I) notional 1.0 MM */
+    int verbose
+){
+    return coupon_schedule(parse_string_ddmmyyyy_to_jpmcdsdate(accrual_start_date)
+    , parse_string_ddmmyyyy_to_jpmcdsdate(maturity_date)
+    , 0
+    , coupon_interval
+    , day_count_convention
+    , stub_method
+    , holiday_filename
+    , coupon_rate
+    , notional
+    , verbose);
+};
+
+vector< vector<double> > cds_coupon_schedule_tdate(
+    int accrual_start_date, /* (I) accrual start date of cds as TDate */
+    int maturity_date, /* (I) maturity date of cds as TDate */
+    string coupon_interval, /* (I) coupon interval Q, 1M, 2M */
+    string day_count_convention, /* (I) day_count_convention Act/360 */
+    string stub_method, /* (I) stub_method F/S/20 */
+    string holiday_filename, /* (I) YYMMDD holiday.dat filename */
+    double coupon_rate, /* (I) coupon_rate 1.0 1% */
+    double notional, /* (I) notional 1.0 MM */
+    int verbose
+){
+    return coupon_schedule(accrual_start_date
+    , maturity_date
+    , 1
+    , coupon_interval
+    , day_count_convention
+    , stub_method
+    , holiday_filename
+    , coupon_rate
+    , notional
+    , verbose);
+};
+
+// cds_all_in_one once its dates are TDates, shared by the string and TDate entry points
+static vector< vector<double> > all_in_one(
+	TDate trade_date_jpm,					/* (I) trade date of cds */
+	TDate effective_date_jpm,				/* (I) effective date of cds */
+	TDate maturity_date_jpm,				/* (I) maturity date of cds */
+	TDate value_date_jpm,					/* (I) date to value the cds */
+	TDate accrual_start_date_jpm,			/* (I) accrual start date of cds */
 	double	recovery_rate,					/* (I) recover rate of the curve in basis points */
 	double coupon_rate,						/* (I) CouponRate (e.g. 0.05 = 5% = 500bp) */
 	double notional,						/* (I) Notional MM */
 	int is_buy_protection,					/* (I) direction of credit risk */
 	vector<double> swap_rates, 				/* (I) swap rates */
 	vector<string> swap_tenors,				/* (I) swap tenors "1M", "2M" */
-	vector<string> swap_maturities,			/* (I) swap maturity dates */
+	vector<long int> maturity,				/* (I) swap maturity dates */
 	vector<double> spread_rates,			/* (I) spread spreads */
 	vector<string> spread_tenors,			/* (I) spread tenors "6M", "1Y" */
 	vector<string> spread_roll_tenors, 		/* (I) spread roll tenors */
-	vector<string> imm_dates,				/* (I) imm dates */
+	vector<long int> tenors,				/* (I) imm dates */
 	vector<double> scenario_tenors,			/* (I) spread tenors -100, -90, -80, -70 ... */
 	int verbose
 ) {
 
 	int start_s = clock();
 
+	// error messages and this thread's error record are turned on once, the
+	// calls below take the parsed conventions and leave them alone
+	JpmcdsErrMsgOn();
+	JpmcdsErrMsgEnableRecord(20, 128); /* ie. 20 lines, each of max length 128 */
+
 	// used in risk calculations
 	double single_basis_point = 0.0001;
 
-	TDate trade_date_jpm, effective_date_jpm, maturity_date_jpm,
-	accrual_start_date_jpm, value_date_jpm, minus_1d_maturity_date_jpm;
+	TDate minus_1d_maturity_date_jpm;
 	//minus_1d_value_date_jpm;
 
 	// empty curve pointers
@@ -611,10 +1345,8 @@ vector< vector<double> > cds_all_in_one(
 	TCurve *spreadcurve_dv01 = NULL;
 
 	// discount
-	vector<long int> maturity;
 	vector<char*> cstrings_expiries{};
 	vector<double> spreads;
-	vector<long int> tenors;
 
 	// bumped rates
 	vector<double> swap_rates_dv01;
@@ -649,18 +1381,6 @@ vector< vector<double> > cds_all_in_one(
 	double roll_pvclean;
 	double roll_pvdirty;
 
-	/////////////////////////////
-	// parse char* to jpm dates
-	/////////////////////////////
-
-	trade_date_jpm = parse_string_ddmmyyyy_to_jpmcdsdate(trade_date);
-	effective_date_jpm = parse_string_ddmmyyyy_to_jpmcdsdate(effective_date);
-	maturity_date_jpm = parse_string_ddmmyyyy_to_jpmcdsdate(maturity_date);
-	accrual_start_date_jpm = parse_string_ddmmyyyy_to_jpmcdsdate(accrual_start_date);
-	value_date_jpm = parse_string_ddmmyyyy_to_jpmcdsdate(value_date);
-	//minus_1d_value_date_jpm = parse_string_ddmmyyyy_to_jpmcdsdate_minus_one(value_date);
-	//minus_1d_maturity_date_jpm = parse_string_ddmmyyyy_to_jpmcdsdate_minus_one(maturity_date);
-
 	if (verbose == 1) {
 		std::cout << "value_date_jpm " << value_date_jpm << std::endl;
 		std::cout << "trade_date_jpm " << trade_date_jpm << std::endl;
@@ -682,10 +1402,6 @@ vector< vector<double> > cds_all_in_one(
 		cstrings_expiries.push_back(&string.front());
 	}
 
-	for (int r = 0; r < static_cast<int>(swap_maturities.size()); r++) {
-		maturity.push_back(parse_string_ddmmyyyy_to_jpmcdsdate(swap_maturities[r].c_str()));
-	}
-
 	// bootstrap discount curve
 	zerocurve = build_zero_interest_rate_curve2(value_date_jpm
 		, swap_rates.data()
@@ -703,11 +1419,6 @@ vector< vector<double> > cds_all_in_one(
 	// bootstrap spread curve
 	/////////////////////////////
 
-	// parse imm dates into jpm string format
-	for (int r = 0; r < static_cast<int>(imm_dates.size()); r++) {
-		tenors.push_back(parse_string_ddmmyyyy_to_jpmcdsdate(imm_dates[r]));
-	}
-
 	// build array of spreads for base & cs01
 	for (int r = 0; r < static_cast<int>(spread_rates.size()); r++) {
 		spreads.push_back(spread_rates[r]);
@@ -718,14 +1429,15 @@ vector< vector<double> > cds_all_in_one(
 	}
 
 	// build base case spread curve
-	spreadcurve = build_credit_spread_par_curve(
-		value_date_jpm
+	spreadcurve = build_credit_spread_par_curve_with_conventions(
+		standard_cds_conventions()
+		, value_date_jpm
 		, zerocurve
 		, effective_date_jpm
 		, spreads.data()
 		, tenors.data()
 		, recovery_rate
-		, static_cast<int>(imm_dates.size())
+		, static_cast<int>(tenors.size())
 		, verbose);
 
 	if (spreadcurve == NULL) {
@@ -741,14 +1453,15 @@ vector< vector<double> > cds_all_in_one(
 	}
 	
 	// build cs01 spread curve
-	spreadcurve_cs01 = build_credit_spread_par_curve(
-		value_date_jpm
+	spreadcurve_cs01 = build_credit_spread_par_curve_with_conventions(
+		standard_cds_conventions()
+		, value_date_jpm
 		, zerocurve
 		, effective_date_jpm
 		, spreads_cs01.data()
 		, tenors.data()
 		, recovery_rate
-		, static_cast<int>(imm_dates.size())
+		, static_cast<int>(tenors.size())
 		, verbose);
 
 	if (spreadcurve_cs01 == NULL) {
@@ -764,14 +1477,15 @@ vector< vector<double> > cds_all_in_one(
 	}
 
 	// build dv01 spread_curve
-	spreadcurve_dv01 = build_credit_spread_par_curve(
-		value_date_jpm
+	spreadcurve_dv01 = build_credit_spread_par_curve_with_conventions(
+		standard_cds_conventions()
+		, value_date_jpm
 		, zerocurve_dv01
 		, effective_date_jpm
 		, spreads.data()
 		, tenors.data()
 		, recovery_rate
-		, static_cast<int>(imm_dates.size())
+		, static_cast<int>(tenors.size())
 		, verbose);
 
 	if (spreadcurve_dv01 == NULL) {
@@ -789,27 +1503,25 @@ vector< vector<double> > cds_all_in_one(
 	int is_dirty_price = 0;
 	int is_clean_price = 1;
 
-	// calculate price cds
-	dirtypv = -calculate_cds_price(value_date_jpm
+	// coupon schedule and timelines are built once for all prices of the trade
+	TCdsTrade *trade = prepare_cds_trade_with_conventions(
+		standard_cds_conventions()
+		, value_date_jpm
 		, maturity_date_jpm
-		, zerocurve
-		, spreadcurve
 		, accrual_start_date_jpm
-		, recovery_rate
 		, coupon_rate_in_basis_points
-		, is_dirty_price
 		, verbose);
 
-	// calculate price cds
-	cleanpv = -calculate_cds_price(value_date_jpm
-		, maturity_date_jpm
+	// calculate dirty and clean price cds from one valuation of the legs
+	calculate_cds_trade_prices(trade
 		, zerocurve
 		, spreadcurve
-		, accrual_start_date_jpm
 		, recovery_rate
-		, coupon_rate_in_basis_points
-		, is_clean_price
+		, &dirtypv
+		, &cleanpv
 		, verbose);
+	dirtypv = -dirtypv;
+	cleanpv = -cleanpv;
 		
 	// calculate price cds
 	//roll_1d_cleanpv = -calculate_cds_price(value_date_jpm
@@ -825,23 +1537,17 @@ vector< vector<double> > cds_all_in_one(
 	// compute accured interest
 	ai = dirtypv - cleanpv;
 
-	dirtypv_cs01 = -calculate_cds_price(value_date_jpm
-		, maturity_date_jpm
+	dirtypv_cs01 = -calculate_cds_trade_price(trade
 		, zerocurve
 		, spreadcurve_cs01
-		, accrual_start_date_jpm
 		, recovery_rate
-		, coupon_rate_in_basis_points
 		, is_dirty_price
 		, verbose);
 
-	dirtypv_dv01 = -calculate_cds_price(value_date_jpm
-		, maturity_date_jpm
+	dirtypv_dv01 = -calculate_cds_trade_price(trade
 		, zerocurve_dv01
 		, spreadcurve_dv01
-		, accrual_start_date_jpm
 		, recovery_rate
-		, coupon_rate_in_basis_points
 		, is_dirty_price
 		, verbose);
 
@@ -856,30 +1562,25 @@ vector< vector<double> > cds_all_in_one(
 	allinone_base.push_back((dirtypv_cs01 - dirtypv) * notional * credit_risk_direction_scale_factor);
 	allinone_base.push_back((dirtypv_dv01 - dirtypv) * notional * credit_risk_direction_scale_factor);
 
-	// compute PVBP
+	// compute PVBP, price is linear in coupon so it is one basis point of the risky annuity
 
-	for (int r = 0; r < static_cast<int>(imm_dates.size()); r++) {
-		allinone_pvbp.push_back(
-			(calculate_cds_price(value_date_jpm
-				, tenors[r]
-				, zerocurve
-				, spreadcurve
-				, value_date_jpm
-				, recovery_rate
-				, 0.01
-				, is_dirty_price
-				, verbose)
-				-
-				calculate_cds_price(value_date_jpm
-					, tenors[r]
-					, zerocurve
-					, spreadcurve
-					, value_date_jpm
-					, recovery_rate
-					, 0.01 + single_basis_point
-					, is_dirty_price
-					, verbose)) * credit_risk_direction_scale_factor
-		);
+	vector<double> risky_annuities(tenors.size(), 0.0);
+	if (!tenors.empty()) {
+		calculate_cds_risky_annuities_with_conventions(
+			standard_cds_conventions()
+			, value_date_jpm
+			, tenors.data()
+			, static_cast<int>(tenors.size())
+			, zerocurve
+			, spreadcurve
+			, value_date_jpm
+			, is_dirty_price
+			, risky_annuities.data()
+			, verbose);
+	}
+
+	for (int r = 0; r < static_cast<int>(tenors.size()); r++) {
+		allinone_pvbp.push_back(risky_annuities[r] * single_basis_point * credit_risk_direction_scale_factor);
 	}
 
 	for (auto& string : spread_roll_tenors) {
@@ -891,7 +1592,24 @@ vector< vector<double> > cds_all_in_one(
 		static_cast<int>(spread_roll_tenors.size()),
 		verbose);
 
-	for (int s = 0; s < static_cast<int>(scenario_tenors.size()); s++) {
+	// one trade per roll date, repriced against every scenario curve
+	vector<TCdsTrade*> roll_trades;
+	for (int r = 0; r < static_cast<int>(spread_roll_tenors.size()); r++) {
+		roll_trades.push_back(prepare_cds_trade_with_conventions(
+			standard_cds_conventions()
+			, value_date_jpm
+			, pointer_roll_dates_jpm[r]
+			, accrual_start_date_jpm
+			, coupon_rate_in_basis_points
+			, verbose));
+	}
+
+	// scenario curves all have the same shape, so they are pooled on this thread
+	// together with the blocks of the pricing temporaries
+	JpmcdsArenaStart(JPMCDS_ARENA_SIZE);
+	JpmcdsTCurvePoolStart(SCENARIO_CURVE_POOL_SIZE);
+
+	for (int s = 0; s < static_cast<int>(scenario_tenors.size()); s++) {
 
 		vector <double> scenario_tenors_pvdirty;
 		vector <double> scenario_tenors_pvclean;
@@ -903,15 +1621,19 @@ vector< vector<double> > cds_all_in_one(
 			spreads_cs01.push_back(spread_rates[r] + spread_rates[r] * scenario_tenors[s] / 100);
 		}
 
+		// release the previous curve so its slot is reused by this scenario
+		JpmcdsFreeTCurve(spreadcurve);
+
 		// build spread curve
-		spreadcurve = build_credit_spread_par_curve(
-			value_date_jpm
+		spreadcurve = build_credit_spread_par_curve_with_conventions(
+			standard_cds_conventions()
+			, value_date_jpm
 			, zerocurve
 			, effective_date_jpm
 			, spreads_cs01.data()
 			, tenors.data()
 			, recovery_rate
-			, static_cast<int>(imm_dates.size())
+			, static_cast<int>(tenors.size())
 			, verbose);
 
 		for (int r = 0; r < static_cast<int>(spread_roll_tenors.size()); r++) {
@@ -920,25 +1642,16 @@ vector< vector<double> > cds_all_in_one(
 				std::cout << cstrings_spread_roll_expiries[r] << " " << pointer_roll_dates_jpm[r] << std::endl;
 			}
 
-			roll_pvclean = -calculate_cds_price(value_date_jpm
-				, pointer_roll_dates_jpm[r]
-				, zerocurve
-				, spreadcurve
-				, accrual_start_date_jpm
-				, recovery_rate
-				, coupon_rate_in_basis_points
-				, is_clean_price
-				, verbose);
-				
-			roll_pvdirty = -calculate_cds_price(value_date_jpm
-				, pointer_roll_dates_jpm[r]
+			// calculate dirty and clean price cds from one valuation of the legs
+			calculate_cds_trade_prices(roll_trades[r]
 				, zerocurve
 				, spreadcurve
-				, accrual_start_date_jpm
 				, recovery_rate
-				, coupon_rate_in_basis_points
-				, is_dirty_price
+				, &roll_pvdirty
+				, &roll_pvclean
 				, verbose);
+			roll_pvdirty = -roll_pvdirty;
+			roll_pvclean = -roll_pvclean;
 
 			scenario_tenors_pvclean.push_back(roll_pvclean * notional * credit_risk_direction_scale_factor);
 			scenario_tenors_pvdirty.push_back(roll_pvdirty * notional * credit_risk_direction_scale_factor);
@@ -950,6 +1663,9 @@ vector< vector<double> > cds_all_in_one(
 		allinone_roll_dirty.push_back(scenario_tenors_pvdirty);
 	}
 
+	JpmcdsTCurvePoolStop();
+	JpmcdsArenaStop();
+
 	// compute the par spread vector
 	par_spread_pointer = calculate_cds_par_spread(value_date_jpm
 		, maturity_date_jpm
@@ -984,30 +1700,36 @@ vector< vector<double> > cds_all_in_one(
 		allinone.push_back(allinone_roll_dirty[r]);
 	}
 
-	// handle free of the curve objects via call to JpmcdsFreeSafe macro
-	FREE(spreadcurve);
-	FREE(spreadcurve_dv01);
-	FREE(spreadcurve_cs01);
-	FREE(zerocurve);
-	FREE(zerocurve_dv01);
+	// handle free of the curve objects and their rate arrays
+	JpmcdsFreeTCurve(spreadcurve);
+	JpmcdsFreeTCurve(spreadcurve_dv01);
+	JpmcdsFreeTCurve(spreadcurve_cs01);
+	JpmcdsFreeTCurve(zerocurve);
+	JpmcdsFreeTCurve(zerocurve_dv01);
 	FREE(pointer_roll_dates_jpm);
+	FREE(par_spread_pointer);
+	JpmcdsCdsTradeFree(trade);
+	for (auto roll_trade : roll_trades) {
+		JpmcdsCdsTradeFree(roll_trade);
+	}
 
 	return allinone;
 };
 
 
-vector< vector<double> > cds_all_in_one_exclude_ir_tenor_dates(
+vector< vector<double> > cds_all_in_one(
 	string trade_date,						/* (I) trade date of cds as DD/MM/YYYY */
 	string effective_date,					/* (I) effective date of cds as DD/MM/YYYY */
 	string maturity_date,					/* (I) maturity date of cds as DD/MM/YYYY */
 	string value_date,						/* (I) date to value the cds DD/MM/YYYY */
 	string accrual_start_date,				/* (I) maturity date of cds as DD/MM/YYYY */
-	double recovery_rate,					/* (I) recover rate of the curve in basis points */
+	double	recovery_rate,					/* (I) recover rate of the curve in basis points */
 	double coupon_rate,						/* (I) CouponRate (e.g. 0.05 = 5% = 500bp) */
 	double notional,						/* (I) Notional MM */
 	int is_buy_protection,					/* (I) direction of credit risk */
 	vector<double> swap_rates, 				/* (I) swap rates */
 	vector<string> swap_tenors,				/* (I) swap tenors "1M", "2M" */
+	vector<string> swap_maturities,			/* (I) swap maturity dates */
 	vector<double> spread_rates,			/* (I) spread spreads */
 	vector<string> spread_tenors,			/* (I) spread tenors "6M", "1Y" */
 	vector<string> spread_roll_tenors, 		/* (I) spread roll tenors */
@@ -1015,14 +1737,110 @@ vector< vector<double> > cds_all_in_one_exclude_ir_tenor_dates(
 	vector<double> scenario_tenors,			/* (I) spread tenors -100, -90, -80, -70 ... */
 	int verbose
 ) {
+
+	vector<long int> maturity;
+	vector<long int> tenors;
+
+	for (int r = 0; r < static_cast<int>(swap_maturities.size()); r++) {
+		maturity.push_back(parse_string_ddmmyyyy_to_jpmcdsdate(swap_maturities[r]));
+	}
+
+	// parse imm dates into jpm string format
+	for (int r = 0; r < static_cast<int>(imm_dates.size()); r++) {
+		tenors.push_back(parse_string_ddmmyyyy_to_jpmcdsdate(imm_dates[r]));
+	}
+
+	return all_in_one(parse_string_ddmmyyyy_to_jpmcdsdate(trade_date)
+		, parse_string_ddmmyyyy_to_jpmcdsdate(effective_date)
+		, parse_string_ddmmyyyy_to_jpmcdsdate(maturity_date)
+		, parse_string_ddmmyyyy_to_jpmcdsdate(value_date)
+		, parse_string_ddmmyyyy_to_jpmcdsdate(accrual_start_date)
+		, recovery_rate
+		, coupon_rate
+		, notional
+		, is_buy_protection
+		, swap_rates
+		, swap_tenors
+		, maturity
+		, spread_rates
+		, spread_tenors
+		, spread_roll_tenors
+		, tenors
+		, scenario_tenors
+		, verbose);
+};
+
+vector< vector<double> > cds_all_in_one_tdate(
+	int trade_date,							/* (I) trade date of cds as TDate */
+	int effective_date,						/* (I) effective date of cds as TDate */
+	int maturity_date,						/* (I) maturity date of cds as TDate */
+	int value_date,							/* (I) date to value the cds as TDate */
+	int accrual_start_date,					/* (I) accrual start date of cds as TDate */
+	double	recovery_rate,					/* (I) recover rate of the curve in basis points */
+	double coupon_rate,						/* (I) CouponRate (e.g. 0.05 = 5% = 500bp) */
+	double notional,						/* (I) Notional MM */
+	int is_buy_protection,					/* (I) direction of credit risk */
+	vector<double> swap_rates, 				/* (I) swap rates */
+	vector<string> swap_tenors,				/* (I) swap tenors "1M", "2M" */
+	vector<int> swap_maturities,			/* (I) swap maturity dates as TDate */
+	vector<double> spread_rates,			/* (I) spread spreads */
+	vector<string> spread_tenors,			/* (I) spread tenors "6M", "1Y" */
+	vector<string> spread_roll_tenors, 		/* (I) spread roll tenors */
+	vector<int> imm_dates,					/* (I) imm dates as TDate */
+	vector<double> scenario_tenors,			/* (I) spread tenors -100, -90, -80, -70 ... */
+	int verbose
+) {
+
+	return all_in_one(trade_date
+		, effective_date
+		, maturity_date
+		, value_date
+		, accrual_start_date
+		, recovery_rate
+		, coupon_rate
+		, notional
+		, is_buy_protection
+		, swap_rates
+		, swap_tenors
+		, to_jpmcdsdates(swap_maturities)
+		, spread_rates
+		, spread_tenors
+		, spread_roll_tenors
+		, to_jpmcdsdates(imm_dates)
+		, scenario_tenors
+		, verbose);
+};
+
+
+// cds_all_in_one_exclude_ir_tenor_dates once its dates are TDates, shared by the string and TDate entry points
+static vector< vector<double> > all_in_one_exclude_ir_tenor_dates(
+	TDate trade_date_jpm,					/* (I) trade date of cds */
+	TDate effective_date_jpm,				/* (I) effective date of cds */
+	TDate maturity_date_jpm,				/* (I) maturity date of cds */
+	TDate value_date_jpm,					/* (I) date to value the cds */
+	TDate accrual_start_date_jpm,			/* (I) accrual start date of cds */
+	double recovery_rate,					/* (I) recover rate of the curve in basis points */
+	double coupon_rate,						/* (I) CouponRate (e.g. 0.05 = 5% = 500bp) */
+	double notional,						/* (I) Notional MM */
+	int is_buy_protection,					/* (I) direction of credit risk */
+	vector<double> swap_rates, 				/* (I) swap rates */
+	vector<string> swap_tenors,				/* (I) swap tenors "1M", "2M" */
+	vector<double> spread_rates,			/* (I) spread spreads */
+	vector<string> spread_tenors,			/* (I) spread tenors "6M", "1Y" */
+	vector<string> spread_roll_tenors, 		/* (I) spread roll tenors */
+	vector<long int> tenors,				/* (I) imm dates */
+	vector<double> scenario_tenors,			/* (I) spread tenors -100, -90, -80, -70 ... */
+	int verbose
+) {
 	int start_s = clock();
 
+	// turned on once, as in all_in_one
+	JpmcdsErrMsgOn();
+	JpmcdsErrMsgEnableRecord(20, 128); /* ie. 20 lines, each of max length 128 */
+
 	// used in risk calculations
 	double single_basis_point = 0.0001;
 
-	TDate trade_date_jpm, effective_date_jpm, maturity_date_jpm,
-		accrual_start_date_jpm, value_date_jpm;
-
 	// empty curve pointers
 	TCurve *zerocurve = NULL;
 	TCurve *zerocurve_dv01 = NULL;
@@ -1034,7 +1852,6 @@ vector< vector<double> > cds_all_in_one_exclude_ir_tenor_dates(
 	//vector<long int> maturity;
 	vector<char*> cstrings_expiries{};
 	vector<double> spreads;
-	vector<long int> tenors;
 
 	// bumped rates
 	vector<double> swap_rates_dv01;
@@ -1067,16 +1884,6 @@ vector< vector<double> > cds_all_in_one_exclude_ir_tenor_dates(
 	TDate *pointer_roll_dates_jpm;
 	double roll_pvclean;
 
-	/////////////////////////////
-	// parse char* to jpm dates
-	/////////////////////////////
-
-	trade_date_jpm = parse_string_ddmmyyyy_to_jpmcdsdate(trade_date);
-	effective_date_jpm = parse_string_ddmmyyyy_to_jpmcdsdate(effective_date);
-	maturity_date_jpm = parse_string_ddmmyyyy_to_jpmcdsdate(maturity_date);
-	accrual_start_date_jpm = parse_string_ddmmyyyy_to_jpmcdsdate(accrual_start_date);
-	value_date_jpm = parse_string_ddmmyyyy_to_jpmcdsdate(value_date);
-
 	if (verbose == 1) {
 		std::cout << "value_date_jpm " << value_date_jpm << std::endl;
 		std::cout << "trade_date_jpm " << trade_date_jpm << std::endl;
@@ -1116,11 +1923,6 @@ vector< vector<double> > cds_all_in_one_exclude_ir_tenor_dates(
 	// bootstrap spread curve
 	/////////////////////////////
 
-	// parse imm dates into jpm string format
-	for (int r = 0; r < static_cast<int>(imm_dates.size()); r++) {
-		tenors.push_back(parse_string_ddmmyyyy_to_jpmcdsdate(imm_dates[r]));
-	}
-
 	// build array of spreads for base & cs01
 	for (int r = 0; r < static_cast<int>(spread_rates.size()); r++) {
 		spreads.push_back(spread_rates[r]);
@@ -1131,14 +1933,15 @@ vector< vector<double> > cds_all_in_one_exclude_ir_tenor_dates(
 	}
 
 	// build base case spread curve
-	spreadcurve = build_credit_spread_par_curve(
-		value_date_jpm
+	spreadcurve = build_credit_spread_par_curve_with_conventions(
+		standard_cds_conventions()
+		, value_date_jpm
 		, zerocurve
 		, effective_date_jpm
 		, spreads.data()
 		, tenors.data()
 		, recovery_rate
-		, static_cast<int>(imm_dates.size())
+		, static_cast<int>(tenors.size())
 		, verbose);
 
 	if (spreadcurve == NULL) {
@@ -1154,14 +1957,15 @@ vector< vector<double> > cds_all_in_one_exclude_ir_tenor_dates(
 	}
 
 	// build cs01 spread curve
-	spreadcurve_cs01 = build_credit_spread_par_curve(
-		value_date_jpm
+	spreadcurve_cs01 = build_credit_spread_par_curve_with_conventions(
+		standard_cds_conventions()
+		, value_date_jpm
 		, zerocurve
 		, effective_date_jpm
 		, spreads_cs01.data()
 		, tenors.data()
 		, recovery_rate
-		, static_cast<int>(imm_dates.size())
+		, static_cast<int>(tenors.size())
 		, verbose);
 
 	if (spreadcurve_cs01 == NULL) {
@@ -1177,14 +1981,15 @@ vector< vector<double> > cds_all_in_one_exclude_ir_tenor_dates(
 	}
 
 	// build dv01 spread_curve
-	spreadcurve_dv01 = build_credit_spread_par_curve(
-		value_date_jpm
+	spreadcurve_dv01 = build_credit_spread_par_curve_with_conventions(
+		standard_cds_conventions()
+		, value_date_jpm
 		, zerocurve_dv01
 		, effective_date_jpm
 		, spreads.data()
 		, tenors.data()
 		, recovery_rate
-		, static_cast<int>(imm_dates.size())
+		, static_cast<int>(tenors.size())
 		, verbose);
 
 	if (spreadcurve_dv01 == NULL) {
@@ -1202,48 +2007,40 @@ vector< vector<double> > cds_all_in_one_exclude_ir_tenor_dates(
 	int is_dirty_price = 0;
 	int is_clean_price = 1;
 
-	// calculate price cds
-	dirtypv = -calculate_cds_price(value_date_jpm
+	// coupon schedule and timelines are built once for all prices of the trade
+	TCdsTrade *trade = prepare_cds_trade_with_conventions(
+		standard_cds_conventions()
+		, value_date_jpm
 		, maturity_date_jpm
-		, zerocurve
-		, spreadcurve
 		, accrual_start_date_jpm
-		, recovery_rate
 		, coupon_rate_in_basis_points
-		, is_dirty_price
 		, verbose);
 
-	// calculate price cds
-	cleanpv = -calculate_cds_price(value_date_jpm
-		, maturity_date_jpm
+	// calculate dirty and clean price cds from one valuation of the legs
+	calculate_cds_trade_prices(trade
 		, zerocurve
 		, spreadcurve
-		, accrual_start_date_jpm
 		, recovery_rate
-		, coupon_rate_in_basis_points
-		, is_clean_price
+		, &dirtypv
+		, &cleanpv
 		, verbose);
+	dirtypv = -dirtypv;
+	cleanpv = -cleanpv;
 
 	// compute accured interest
 	ai = dirtypv - cleanpv;
 
-	dirtypv_cs01 = -calculate_cds_price(value_date_jpm
-		, maturity_date_jpm
+	dirtypv_cs01 = -calculate_cds_trade_price(trade
 		, zerocurve
 		, spreadcurve_cs01
-		, accrual_start_date_jpm
 		, recovery_rate
-		, coupon_rate_in_basis_points
 		, is_dirty_price
 		, verbose);
 
-	dirtypv_dv01 = -calculate_cds_price(value_date_jpm
-		, maturity_date_jpm
+	dirtypv_dv01 = -calculate_cds_trade_price(trade
 		, zerocurve_dv01
 		, spreadcurve_dv01
-		, accrual_start_date_jpm
 		, recovery_rate
-		, coupon_rate_in_basis_points
 		, is_dirty_price
 		, verbose);
 
@@ -1258,30 +2055,25 @@ vector< vector<double> > cds_all_in_one_exclude_ir_tenor_dates(
 	allinone_base.push_back((dirtypv_cs01 - dirtypv) * notional * credit_risk_direction_scale_factor);
 	allinone_base.push_back((dirtypv_dv01 - dirtypv) * notional * credit_risk_direction_scale_factor);
 
-	// compute PVBP
+	// compute PVBP, price is linear in coupon so it is one basis point of the risky annuity
 
-	for (int r = 0; r < static_cast<int>(imm_dates.size()); r++) {
-		allinone_pvbp.push_back(
-			(calculate_cds_price(value_date_jpm
-				, tenors[r]
-				, zerocurve
-				, spreadcurve
-				, value_date_jpm
-				, recovery_rate
-				, 0.01
-				, is_dirty_price
-				, verbose)
-				-
-				calculate_cds_price(value_date_jpm
-					, tenors[r]
-					, zerocurve
-					, spreadcurve
-					, value_date_jpm
-					, recovery_rate
-					, 0.01 + single_basis_point
-					, is_dirty_price
-					, verbose)) * credit_risk_direction_scale_factor
-		);
+	vector<double> risky_annuities(tenors.size(), 0.0);
+	if (!tenors.empty()) {
+		calculate_cds_risky_annuities_with_conventions(
+			standard_cds_conventions()
+			, value_date_jpm
+			, tenors.data()
+			, static_cast<int>(tenors.size())
+			, zerocurve
+			, spreadcurve
+			, value_date_jpm
+			, is_dirty_price
+			, risky_annuities.data()
+			, verbose);
+	}
+
+	for (int r = 0; r < static_cast<int>(tenors.size()); r++) {
+		allinone_pvbp.push_back(risky_annuities[r] * single_basis_point * credit_risk_direction_scale_factor);
 	}
 
 	for (auto& string : spread_roll_tenors) {
@@ -1293,6 +2085,23 @@ vector< vector<double> > cds_all_in_one_exclude_ir_tenor_dates(
 		static_cast<int>(spread_roll_tenors.size()),
 		verbose);
 
+	// one trade per roll date, repriced against every scenario curve
+	vector<TCdsTrade*> roll_trades;
+	for (int r = 0; r < static_cast<int>(spread_roll_tenors.size()); r++) {
+		roll_trades.push_back(prepare_cds_trade_with_conventions(
+			standard_cds_conventions()
+			, value_date_jpm
+			, pointer_roll_dates_jpm[r]
+			, accrual_start_date_jpm
+			, coupon_rate_in_basis_points
+			, verbose));
+	}
+
+	// scenario curves all have the same shape, so they are pooled on this thread
+	// together with the blocks of the pricing temporaries
+	JpmcdsArenaStart(JPMCDS_ARENA_SIZE);
+	JpmcdsTCurvePoolStart(SCENARIO_CURVE_POOL_SIZE);
+
 	for (int s = 0; s < static_cast<int>(scenario_tenors.size()); s++) {
 
 		vector <double> scenario_tenors_pvdirty;
@@ -1305,26 +2114,27 @@ vector< vector<double> > cds_all_in_one_exclude_ir_tenor_dates(
 			spreads_cs01.push_back(spread_rates[r] + spread_rates[r] * scenario_tenors[s] / 100);
 		}
 
+		// release the previous curve so its slot is reused by this scenario
+		JpmcdsFreeTCurve(spreadcurve);
+
 		// build spread curve
-		spreadcurve = build_credit_spread_par_curve(
-			value_date_jpm
+		spreadcurve = build_credit_spread_par_curve_with_conventions(
+			standard_cds_conventions()
+			, value_date_jpm
 			, zerocurve
 			, effective_date_jpm
 			, spreads_cs01.data()
 			, tenors.data()
 			, recovery_rate
-			, static_cast<int>(imm_dates.size())
+			, static_cast<int>(tenors.size())
 			, verbose);
 
 		for (int r = 0; r < static_cast<int>(spread_roll_tenors.size()); r++) {
 
-			roll_pvclean = -calculate_cds_price(value_date_jpm
-				, pointer_roll_dates_jpm[r]
+			roll_pvclean = -calculate_cds_trade_price(roll_trades[r]
 				, zerocurve
 				, spreadcurve
-				, accrual_start_date_jpm
 				, recovery_rate
-				, coupon_rate_in_basis_points
 				, is_clean_price
 				, verbose);
 
@@ -1337,6 +2147,9 @@ vector< vector<double> > cds_all_in_one_exclude_ir_tenor_dates(
 		allinone_roll.push_back(scenario_tenors_pvdirty);
 	}
 
+	JpmcdsTCurvePoolStop();
+	JpmcdsArenaStop();
+
 	// compute the par spread vector
 	par_spread_pointer = calculate_cds_par_spread(value_date_jpm
 		, maturity_date_jpm
@@ -1367,35 +2180,197 @@ vector< vector<double> > cds_all_in_one_exclude_ir_tenor_dates(
 		allinone.push_back(allinone_roll[r]);
 	}
 
-	// handle free of the curve objects via call to JpmcdsFreeSafe macro
-	FREE(spreadcurve);
-	FREE(spreadcurve_dv01);
-	FREE(spreadcurve_cs01);
-	FREE(zerocurve);
-	FREE(zerocurve_dv01);
+	// handle free of the curve objects and their rate arrays
+	JpmcdsFreeTCurve(spreadcurve);
+	JpmcdsFreeTCurve(spreadcurve_dv01);
+	JpmcdsFreeTCurve(spreadcurve_cs01);
+	JpmcdsFreeTCurve(zerocurve);
+	JpmcdsFreeTCurve(zerocurve_dv01);
 	FREE(pointer_roll_dates_jpm);
+	FREE(par_spread_pointer);
+	JpmcdsCdsTradeFree(trade);
+	for (auto roll_trade : roll_trades) {
+		JpmcdsCdsTradeFree(roll_trade);
+	}
 
 	return allinone;
 };
 
-vector< vector<double> > cds_index_all_in_one(
-	string trade_date,					/* (I) trade date of cds as DD/MM/YYYY */
+vector< vector<double> > cds_all_in_one_exclude_ir_tenor_dates(
+	string trade_date,						/* (I) trade date of cds as DD/MM/YYYY */
 	string effective_date,					/* (I) effective date of cds as DD/MM/YYYY */
 	string maturity_date,					/* (I) maturity date of cds as DD/MM/YYYY */
 	string value_date,						/* (I) date to value the cds DD/MM/YYYY */
-	string accrual_start_date,				/* (I) accrual start date of cds as DD/MM/YYYY */
+	string accrual_start_date,				/* (I) maturity date of cds as DD/MM/YYYY */
+	double recovery_rate,					/* (I) recover rate of the curve in basis points */
+	double coupon_rate,						/* (I) CouponRate (e.g. 0.05 = 5% = 500bp) */
+	double notional,						/* (I) Notional MM */
+	int is_buy_protection,					/* (I) direction of credit risk */
+	vector<double> swap_rates, 				/* (I) swap rates */
+	vector<string> swap_tenors,				/* (I) swap tenors "1M", "2M" */
+	vector<double> spread_rates,			/* (I) spread spreads */
+	vector<string> spread_tenors,			/* (I) spread tenors "6M", "1Y" */
+	vector<string> spread_roll_tenors, 		/* (I) spread roll tenors */
+	vector<string> imm_dates,				/* (I) imm dates */
+	vector<double> scenario_tenors,			/* (I) spread tenors -100, -90, -80, -70 ... */
+	int verbose
+) {
+
+	vector<long int> tenors;
+
+	// parse imm dates into jpm string format
+	for (int r = 0; r < static_cast<int>(imm_dates.size()); r++) {
+		tenors.push_back(parse_string_ddmmyyyy_to_jpmcdsdate(imm_dates[r]));
+	}
+
+	return all_in_one_exclude_ir_tenor_dates(parse_string_ddmmyyyy_to_jpmcdsdate(trade_date)
+		, parse_string_ddmmyyyy_to_jpmcdsdate(effective_date)
+		, parse_string_ddmmyyyy_to_jpmcdsdate(maturity_date)
+		, parse_string_ddmmyyyy_to_jpmcdsdate(value_date)
+		, parse_string_ddmmyyyy_to_jpmcdsdate(accrual_start_date)
+		, recovery_rate
+		, coupon_rate
+		, notional
+		, is_buy_protection
+		, swap_rates
+		, swap_tenors
+		, spread_rates
+		, spread_tenors
+		, spread_roll_tenors
+		, tenors
+		, scenario_tenors
+		, verbose);
+};
+
+vector< vector<double> > cds_all_in_one_exclude_ir_tenor_dates_tdate(
+	int trade_date,							/* (I) trade date of cds as TDate */
+	int effective_date,						/* (I) effective date of cds as TDate */
+	int maturity_date,						/* (I) maturity date of cds as TDate */
+	int value_date,							/* (I) date to value the cds as TDate */
+	int accrual_start_date,					/* (I) accrual start date of cds as TDate */
+	double recovery_rate,					/* (I) recover rate of the curve in basis points */
+	double coupon_rate,						/* (I) CouponRate (e.g. 0.05 = 5% = 500bp) */
+	double notional,						/* (I) Notional MM */
+	int is_buy_protection,					/* (I) direction of credit risk */
+	vector<double> swap_rates, 				/* (I) swap rates */
+	vector<string> swap_tenors,				/* (I) swap tenors "1M", "2M" */
+	vector<double> spread_rates,			/* (I) spread spreads */
+	vector<string> spread_tenors,			/* (I) spread tenors "6M", "1Y" */
+	vector<string> spread_roll_tenors, 		/* (I) spread roll tenors */
+	vector<int> imm_dates,					/* (I) imm dates as TDate */
+	vector<double> scenario_tenors,			/* (I) spread tenors -100, -90, -80, -70 ... */
+	int verbose
+) {
+
+	return all_in_one_exclude_ir_tenor_dates(trade_date
+		, effective_date
+		, maturity_date
+		, value_date
+		, accrual_start_date
+		, recovery_rate
+		, coupon_rate
+		, notional
+		, is_buy_protection
+		, swap_rates
+		, swap_tenors
+		, spread_rates
+		, spread_tenors
+		, spread_roll_tenors
+		, to_jpmcdsdates(imm_dates)
+		, scenario_tenors
+		, verbose);
+};
+
+// price constituents handed out by next_constituent; each writes its own slot
+static void price_index_constituents(
+	std::atomic<int>* next_constituent,
+	TDate value_date_jpm,
+	TDate effective_date_jpm,
+	TDate maturity_date_jpm,
+	TDate accrual_start_date_jpm,
+	TCurve* zerocurve,
+	const vector<double>& recovery_rate,
+	const vector< vector<double> >& spread_rates,
+	const vector<long int>& tenors,
+	double coupon_rate_in_basis_points,
+	vector<double>* dirtypv,
+	vector<double>* cleanpv,
+	int verbose
+) {
+
+	JpmcdsErrMsgEnableRecord(20, 128); /* ie. 20 lines, each of max length 128 */
+
+	// constituent curves all have the same shape, so they are pooled on this thread
+	// together with the blocks of the pricing temporaries
+	JpmcdsArenaStart(JPMCDS_ARENA_SIZE);
+	JpmcdsTCurvePoolStart(SCENARIO_CURVE_POOL_SIZE);
+
+	// constituents share the trade dates, so the worker prepares the trade once
+	TCdsTrade *trade = prepare_cds_trade_with_conventions(
+		standard_cds_conventions()
+		, value_date_jpm
+		, maturity_date_jpm
+		, accrual_start_date_jpm
+		, coupon_rate_in_basis_points
+		, verbose);
+
+	for (int r = (*next_constituent)++; r < static_cast<int>(spread_rates.size()); r = (*next_constituent)++) {
+
+		// build array of spreads
+		vector<double> spreads(spread_rates[r]);
+		vector<long int> curve_tenors(tenors);
+
+		// build spread curve
+		TCurve *spreadcurve = build_credit_spread_par_curve_with_conventions(
+			standard_cds_conventions()
+			, value_date_jpm
+			, zerocurve
+			, effective_date_jpm
+			, spreads.data()
+			, curve_tenors.data()
+			, recovery_rate[r]
+			, static_cast<int>(tenors.size())
+			, verbose);
+
+		// calculate dirty and clean price cds from one valuation of the legs
+		calculate_cds_trade_prices(trade
+			, zerocurve
+			, spreadcurve
+			, recovery_rate[r]
+			, &(*dirtypv)[r]
+			, &(*cleanpv)[r]
+			, verbose);
+		(*dirtypv)[r] = -(*dirtypv)[r];
+		(*cleanpv)[r] = -(*cleanpv)[r];
+
+		JpmcdsFreeTCurve(spreadcurve);
+	}
+
+	JpmcdsCdsTradeFree(trade);
+	JpmcdsTCurvePoolStop();
+	JpmcdsArenaStop();
+}
+
+// cds_index_all_in_one_parallel once its dates are TDates, shared by the string and TDate entry points
+static vector< vector<double> > index_all_in_one(
+	TDate trade_date_jpm,					/* (I) trade date of cds */
+	TDate effective_date_jpm,				/* (I) effective date of cds */
+	TDate maturity_date_jpm,				/* (I) maturity date of cds */
+	TDate value_date_jpm,					/* (I) date to value the cds */
+	TDate accrual_start_date_jpm,			/* (I) accrual start date of cds */
 	vector<double> recovery_rate,			/* (I) recover rate of the curve in basis points */
 	double coupon_rate,						/* (I) CouponRate (e.g. 0.05 = 5% = 500bp) */
 	double notional,						/* (I) Notional MM */
 	int is_buy_protection,					/* (I) direction of credit risk */
 	vector<double> swap_rates, 				/* (I) swap rates */
 	vector<string> swap_tenors,				/* (I) swap tenors "1M", "2M" */
-	vector<string> swap_maturities,			/* (I) swap maturity dates */
+	vector<long int> maturity,				/* (I) swap maturity dates */
 	vector< vector<double> > spread_rates,	/* (I) spread spreads */
 	vector<string> spread_tenors,			/* (I) spread tenors "6M", "1Y" */
 	vector<string> spread_roll_tenors,		/* (I) spread roll tenors */
-	vector<string> imm_dates,				/* (I) imm dates */
+	vector<long int> tenors,				/* (I) imm dates */
 	vector<double> scenario_tenors,			/* (I) spread tenors -100, -90, -80, -70 ... */
+	int number_of_threads,					/* (I) worker threads, 0 uses every core */
 	int verbose								/* (I) output message text */
 )
 {
@@ -1403,24 +2378,14 @@ vector< vector<double> > cds_index_all_in_one(
 	int start_s = clock();
 
 
-	TDate trade_date_jpm, effective_date_jpm, maturity_date_jpm,
-		accrual_start_date_jpm, value_date_jpm;
-
 	// empty curve pointers
 	TCurve *zerocurve = NULL;
-	TCurve *spreadcurve = NULL;
 
 	// discount
-	vector<long int> maturity;
 	vector<char*> cstrings_expiries{};
-	vector<double> spreads;
-	vector<long int> tenors;
 
 	// numeric values
 	double coupon_rate_in_basis_points = coupon_rate / 10000.0;
-	double dirtypv;
-	double cleanpv;
-	double ai;
 
 	double dirtypv_index = 0.0;
 	double cleanpv_index = 0.0;
@@ -1438,16 +2403,6 @@ vector< vector<double> > cds_index_all_in_one(
 	// assumes sell protection default
 	double credit_risk_direction_scale_factor = 1;
 
-	/////////////////////////////
-	// parse char* to jpm dates
-	/////////////////////////////
-
-	trade_date_jpm = parse_string_ddmmyyyy_to_jpmcdsdate(trade_date);
-	effective_date_jpm = parse_string_ddmmyyyy_to_jpmcdsdate(effective_date);
-	maturity_date_jpm = parse_string_ddmmyyyy_to_jpmcdsdate(maturity_date);
-	accrual_start_date_jpm = parse_string_ddmmyyyy_to_jpmcdsdate(accrual_start_date);
-	value_date_jpm = parse_string_ddmmyyyy_to_jpmcdsdate(value_date);
-
 	if (verbose == 1) {
 		std::cout << "value_date_jpm " << value_date_jpm << std::endl;
 		std::cout << "trade_date_jpm " << trade_date_jpm << std::endl;
@@ -1460,16 +2415,10 @@ vector< vector<double> > cds_index_all_in_one(
 	// bootstrap interest rate curve
 	/////////////////////////////
 
-    //double *rates = swap_rates.data();
-
     for (auto& string : swap_tenors) {
 	  cstrings_expiries.push_back(&string.front());
     }
 
-    for(int r = 0; r < static_cast<int>(swap_maturities.size()); r++){
-	  maturity.push_back(parse_string_ddmmyyyy_to_jpmcdsdate(swap_maturities[r].c_str()));
-    } 
-
 	// bootstrap discount curve
 	zerocurve = build_zero_interest_rate_curve2(value_date_jpm
 			, swap_rates.data()
@@ -1481,70 +2430,73 @@ vector< vector<double> > cds_index_all_in_one(
 	// bootstrap spread curve
 	/////////////////////////////
 
-	// parse imm dates into jpm string format
-	for(int r = 0; r < static_cast<int>(imm_dates.size()); r++){
-		tenors.push_back(parse_string_ddmmyyyy_to_jpmcdsdate(imm_dates[r]));
+	int n = static_cast<int>(spread_rates.size());
+	vector<double> dirtypv(n, 0.0);
+	vector<double> cleanpv(n, 0.0);
+	std::atomic<int> next_constituent(0);
+
+	if (number_of_threads <= 0) {
+		number_of_threads = static_cast<int>(std::thread::hardware_concurrency());
 	}
+	number_of_threads = std::max(1, std::min(number_of_threads, n));
 
-	int is_dirty_price = 0;
-	int is_clean_price = 1;
+	// each worker gets its own error record from the pricing calls, free it
+	// before the thread exits
+	auto worker_main = [&]() {
+		price_index_constituents(&next_constituent
+			, value_date_jpm
+			, effective_date_jpm
+			, maturity_date_jpm
+			, accrual_start_date_jpm
+			, zerocurve
+			, recovery_rate
+			, spread_rates
+			, tenors
+			, coupon_rate_in_basis_points
+			, &dirtypv
+			, &cleanpv
+			, verbose);
+		JpmcdsErrMsgDisableRecord();
+	};
 
-	for(int r = 0; r < static_cast<int>(spread_rates.size()); r++){
-  
-		// build array of spreads
-		for(int s = 0; s < static_cast<int>(spread_rates[r].size()); s++){
-		spreads.push_back(spread_rates[r][s]);
-		}
+	vector<std::thread> workers;
+	for (int w = 1; w < number_of_threads; w++) {
+		workers.push_back(std::thread(worker_main));
+	}
 
-		// build spread curve
-		spreadcurve = build_credit_spread_par_curve(
-      			value_date_jpm
-      			, zerocurve
-      			, effective_date_jpm
-      			, spreads.data()
-      			, tenors.data()
-      			, recovery_rate[r]
-      			, static_cast<int>(imm_dates.size())
-      			, verbose);
-
-		// calculate price cds
-		dirtypv = -calculate_cds_price(value_date_jpm
+	price_index_constituents(&next_constituent
+		, value_date_jpm
+		, effective_date_jpm
 		, maturity_date_jpm
-		, zerocurve
-		, spreadcurve
 		, accrual_start_date_jpm
-		, recovery_rate[r]
-		, coupon_rate_in_basis_points
-		, is_dirty_price
-		, verbose);
-
-		// calculate price cds
-		cleanpv = -calculate_cds_price(value_date_jpm
-		, maturity_date_jpm
 		, zerocurve
-		, spreadcurve
-		, accrual_start_date_jpm
-		, recovery_rate[r]
+		, recovery_rate
+		, spread_rates
+		, tenors
 		, coupon_rate_in_basis_points
-		, is_clean_price
+		, &dirtypv
+		, &cleanpv
 		, verbose);
 
+	for (auto& worker : workers) {
+		worker.join();
+	}
+
+	// reduce in constituent order so the index level does not depend on the worker count
+	for(int r = 0; r < n; r++){
+
 		// compute accured interest
-		ai = dirtypv - cleanpv;
+		double ai = dirtypv[r] - cleanpv[r];
       
 		// push back credit level result
-		allinone_base.push_back(dirtypv * notional * credit_risk_direction_scale_factor);
-		allinone_base.push_back(cleanpv * notional * credit_risk_direction_scale_factor);
+		allinone_base.push_back(dirtypv[r] * notional * credit_risk_direction_scale_factor);
+		allinone_base.push_back(cleanpv[r] * notional * credit_risk_direction_scale_factor);
 		allinone_base.push_back(ai * notional );
       
 		// index level
-		dirtypv_index += dirtypv * notional * credit_risk_direction_scale_factor;
-		cleanpv_index += cleanpv * notional * credit_risk_direction_scale_factor;
+		dirtypv_index += dirtypv[r] * notional * credit_risk_direction_scale_factor;
+		cleanpv_index += cleanpv[r] * notional * credit_risk_direction_scale_factor;
 		ai_index += ai * notional * credit_risk_direction_scale_factor;
-		spreads.clear();
-	  
-		FREE(spreadcurve);
-		spreads.clear();
 	  
 	}
   
@@ -1559,14 +2511,1497 @@ vector< vector<double> > cds_index_all_in_one(
 	allinone.push_back(allinone_base);
 	allinone.push_back(allinone_index);
   
-	// handle free of the curve objects via call to JpmcdsFreeSafe macro
-	//FREE(spreadcurve);
-	FREE(zerocurve);
+	// handle free of the curve objects and their rate arrays
+	JpmcdsFreeTCurve(zerocurve);
 
 	return allinone;
 
 };
 
+vector< vector<double> > cds_index_all_in_one_parallel(
+	string trade_date,					/* (I) trade date of cds as DD/MM/YYYY */
+	string effective_date,					/* (I) effective date of cds as DD/MM/YYYY */
+	string maturity_date,					/* (I) maturity date of cds as DD/MM/YYYY */
+	string value_date,						/* (I) date to value the cds DD/MM/YYYY */
+	string accrual_start_date,				/* (I) accrual start date of cds as DD/MM/YYYY */
+	vector<double> recovery_rate,			/* (I) recover rate of the curve in basis points */
+	double coupon_rate,						/* (I) CouponRate (e.g. 0.05 = 5% = 500bp) */
+	double notional,						/* (I) Notional MM */
+	int is_buy_protection,					/* (I) direction of credit risk */
+	vector<double> swap_rates, 				/* (I) swap rates */
+	vector<string> swap_tenors,				/* (I) swap tenors "1M", "2M" */
+	vector<string> swap_maturities,			/* (I) swap maturity dates */
+	vector< vector<double> > spread_rates,	/* (I) spread spreads */
+	vector<string> spread_tenors,			/* (I) spread tenors "6M", "1Y" */
+	vector<string> spread_roll_tenors,		/* (I) spread roll tenors */
+	vector<string> imm_dates,				/* (I) imm dates */
+	vector<double> scenario_tenors,			/* (I) spread tenors -100, -90, -80, -70 ... */
+	int number_of_threads,					/* (I) worker threads, 0 uses every core */
+	int verbose								/* (I) output message text */
+)
+{
+	vector<long int> maturity;
+	vector<long int> tenors;
+
+	for (int r = 0; r < static_cast<int>(swap_maturities.size()); r++) {
+		maturity.push_back(parse_string_ddmmyyyy_to_jpmcdsdate(swap_maturities[r]));
+	}
+
+	// parse imm dates into jpm string format
+	for (int r = 0; r < static_cast<int>(imm_dates.size()); r++) {
+		tenors.push_back(parse_string_ddmmyyyy_to_jpmcdsdate(imm_dates[r]));
+	}
+
+	return index_all_in_one(parse_string_ddmmyyyy_to_jpmcdsdate(trade_date)
+		, parse_string_ddmmyyyy_to_jpmcdsdate(effective_date)
+		, parse_string_ddmmyyyy_to_jpmcdsdate(maturity_date)
+		, parse_string_ddmmyyyy_to_jpmcdsdate(value_date)
+		, parse_string_ddmmyyyy_to_jpmcdsdate(accrual_start_date)
+		, recovery_rate
+		, coupon_rate
+		, notional
+		, is_buy_protection
+		, swap_rates
+		, swap_tenors
+		, maturity
+		, spread_rates
+		, spread_tenors
+		, spread_roll_tenors
+		, tenors
+		, scenario_tenors
+		, number_of_threads
+		, verbose);
+};
+
+vector< vector<double> > cds_index_all_in_one_parallel_tdate(
+	int trade_date,							/* (I) trade date of cds as TDate */
+	int effective_date,						/* (I) effective date of cds as TDate */
+	int maturity_date,						/* (I) maturity date of cds as TDate */
+	int value_date,							/* (I) date to value the cds as TDate */
+	int accrual_start_date,					/* (I) accrual start date of cds as TDate */
+	vector<double> recovery_rate,			/* (I) recover rate of the curve in basis points */
+	double coupon_rate,						/* (I) CouponRate (e.g. 0.05 = 5% = 500bp) */
+	double notional,						/* (I) Notional MM */
+	int is_buy_protection,					/* (I) direction of credit risk */
+	vector<double> swap_rates, 				/* (I) swap rates */
+	vector<string> swap_tenors,				/* (I) swap tenors "1M", "2M" */
+	vector<int> swap_maturities,			/* (I) swap maturity dates as TDate */
+	vector< vector<double> > spread_rates,	/* (I) spread spreads */
+	vector<string> spread_tenors,			/* (I) spread tenors "6M", "1Y" */
+	vector<string> spread_roll_tenors,		/* (I) spread roll tenors */
+	vector<int> imm_dates,					/* (I) imm dates as TDate */
+	vector<double> scenario_tenors,			/* (I) spread tenors -100, -90, -80, -70 ... */
+	int number_of_threads,					/* (I) worker threads, 0 uses every core */
+	int verbose								/* (I) output message text */
+)
+{
+	return index_all_in_one(trade_date
+		, effective_date
+		, maturity_date
+		, value_date
+		, accrual_start_date
+		, recovery_rate
+		, coupon_rate
+		, notional
+		, is_buy_protection
+		, swap_rates
+		, swap_tenors
+		, to_jpmcdsdates(swap_maturities)
+		, spread_rates
+		, spread_tenors
+		, spread_roll_tenors
+		, to_jpmcdsdates(imm_dates)
+		, scenario_tenors
+		, number_of_threads
+		, verbose);
+};
+
+vector< vector<double> > cds_index_all_in_one(
+	string trade_date,					/* (I) trade date of cds as DD/MM/YYYY */
+	string effective_date,					/* (I) effective date of cds as DD/MM/YYYY */
+	string maturity_date,					/* (I) maturity date of cds as DD/MM/YYYY */
+	string value_date,						/* (I) date to value the cds DD/MM/YYYY */
+	string accrual_start_date,				/* (I) accrual start date of cds as DD/MM/YYYY */
+	vector<double> recovery_rate,			/* (I) recover rate of the curve in basis points */
+	double coupon_rate,						/* (I) CouponRate (e.g. 0.05 = 5% = 500bp) */
+	double notional,						/* (I) Notional MM */
+	int is_buy_protection,					/* (I) direction of credit risk */
+	vector<double> swap_rates, 				/* (I) swap rates */
+	vector<string> swap_tenors,				/* (I) swap tenors "1M", "2M" */
+	vector<string> swap_maturities,			/* (I) swap maturity dates */
+	vector< vector<double> > spread_rates,	/* (I) spread spreads */
+	vector<string> spread_tenors,			/* (I) spread tenors "6M", "1Y" */
+	vector<string> spread_roll_tenors,		/* (I) spread roll tenors */
+	vector<string> imm_dates,				/* (I) imm dates */
+	vector<double> scenario_tenors,			/* (I) spread tenors -100, -90, -80, -70 ... */
+	int verbose								/* (I) output message text */
+)
+{
+	// serial pricing is the single worker case
+	return cds_index_all_in_one_parallel(trade_date
+		, effective_date
+		, maturity_date
+		, value_date
+		, accrual_start_date
+		, recovery_rate
+		, coupon_rate
+		, notional
+		, is_buy_protection
+		, swap_rates
+		, swap_tenors
+		, swap_maturities
+		, spread_rates
+		, spread_tenors
+		, spread_roll_tenors
+		, imm_dates
+		, scenario_tenors
+		, 1
+		, verbose);
+
+};
+
+vector< vector<double> > cds_index_all_in_one_tdate(
+	int trade_date,							/* (I) trade date of cds as TDate */
+	int effective_date,						/* (I) effective date of cds as TDate */
+	int maturity_date,						/* (I) maturity date of cds as TDate */
+	int value_date,							/* (I) date to value the cds as TDate */
+	int accrual_start_date,					/* (I) accrual start date of cds as TDate */
+	vector<double> recovery_rate,			/* (I) recover rate of the curve in basis points */
+	double coupon_rate,						/* (I) CouponRate (e.g. 0.05 = 5% = 500bp) */
+	double notional,						/* (I) Notional MM */
+	int is_buy_protection,					/* (I) direction of credit risk */
+	vector<double> swap_rates, 				/* (I) swap rates */
+	vector<string> swap_tenors,				/* (I) swap tenors "1M", "2M" */
+	vector<int> swap_maturities,			/* (I) swap maturity dates as TDate */
+	vector< vector<double> > spread_rates,	/* (I) spread spreads */
+	vector<string> spread_tenors,			/* (I) spread tenors "6M", "1Y" */
+	vector<string> spread_roll_tenors,		/* (I) spread roll tenors */
+	vector<int> imm_dates,					/* (I) imm dates as TDate */
+	vector<double> scenario_tenors,			/* (I) spread tenors -100, -90, -80, -70 ... */
+	int verbose								/* (I) output message text */
+)
+{
+	// serial pricing is the single worker case
+	return cds_index_all_in_one_parallel_tdate(trade_date
+		, effective_date
+		, maturity_date
+		, value_date
+		, accrual_start_date
+		, recovery_rate
+		, coupon_rate
+		, notional
+		, is_buy_protection
+		, swap_rates
+		, swap_tenors
+		, swap_maturities
+		, spread_rates
+		, spread_tenors
+		, spread_roll_tenors
+		, imm_dates
+		, scenario_tenors
+		, 1
+		, verbose);
+
+};
+
+
+/////////////////////////////
+// persistent curve handles
+/////////////////////////////
+
+// curves built once and shared by every trade priced against the handle
+struct CurveSet {
+	TCurve *curve;						// base case curve
+	TCurve *curve_cs01;					// spread curve bootstrapped on spreads + 1bp
+	TCurve *curve_dv01;					// curve bootstrapped on swap rates + 1bp
+	TDate value_date;
+	double recovery_rate;
+	std::shared_ptr<CurveSet> discount;	// discount curve set a spread curve was built on
+
+	// market inputs kept to bootstrap the key rate curves on first use
+	vector<double> rates;				// swap rates or spread rates
+	vector<string> swap_tenors;
+	vector<long int> dates;				// swap maturities or imm dates
+	TDate effective_date;
+
+	// one curve per swap rate bumped +1bp, spread curves bootstrapped on them
+	std::mutex key_rate_mutex;
+	vector<TCurve*> key_rate_curves;
+
+	// d spread curve rate / d spread and / d discount curve rate, row major
+	std::mutex jacobian_mutex;
+	vector<double> rate_by_quote;
+	vector<double> rate_by_discount;
+
+	// one spread curve per pillar with only that spread bumped +1bp
+	std::mutex bucket_mutex;
+	vector<TCurve*> bucket_curves;
+
+	CurveSet() : curve(NULL), curve_cs01(NULL), curve_dv01(NULL),
+		value_date(0), recovery_rate(0.0), effective_date(0) {}
+
+	~CurveSet() {
+		JpmcdsFreeTCurve(curve);
+		JpmcdsFreeTCurve(curve_cs01);
+		JpmcdsFreeTCurve(curve_dv01);
+		for (auto key_rate_curve : key_rate_curves) {
+			JpmcdsFreeTCurve(key_rate_curve);
+		}
+		for (auto bucket_curve : bucket_curves) {
+			JpmcdsFreeTCurve(bucket_curve);
+		}
+	}
+};
+
+static std::map<int, std::shared_ptr<CurveSet> > curve_handles;
+static std::mutex curve_handles_mutex;
+static int next_curve_handle = 1;
+
+static int register_curve_handle(const std::shared_ptr<CurveSet>& curve_set)
+{
+	std::lock_guard<std::mutex> lock(curve_handles_mutex);
+	int handle = next_curve_handle++;
+	curve_handles[handle] = curve_set;
+	return handle;
+}
+
+static std::shared_ptr<CurveSet> find_curve_handle(int handle)
+{
+	std::lock_guard<std::mutex> lock(curve_handles_mutex);
+	std::map<int, std::shared_ptr<CurveSet> >::iterator it = curve_handles.find(handle);
+	if (it == curve_handles.end()) {
+		return std::shared_ptr<CurveSet>();
+	}
+	return it->second;
+}
+
+static int discount_curve_handle(
+	TDate value_date_jpm,					/* (I) date to value the cds */
+	vector<double> swap_rates, 				/* (I) swap rates */
+	vector<string> swap_tenors,				/* (I) swap tenors "1M", "2M" */
+	vector<long int> maturity,				/* (I) swap maturity dates */
+	int verbose
+) {
+
+	// used in risk calculations
+	double single_basis_point = 0.0001;
+
+	vector<char*> cstrings_expiries{};
+	vector<double> swap_rates_dv01;
+
+	std::shared_ptr<CurveSet> curve_set(new CurveSet());
+	curve_set->value_date = value_date_jpm;
+	curve_set->rates = swap_rates;
+	curve_set->swap_tenors = swap_tenors;
+	curve_set->dates = maturity;
+
+	for (int r = 0; r < static_cast<int>(swap_rates.size()); r++) {
+		swap_rates_dv01.push_back(swap_rates[r] + single_basis_point);
+	}
+
+	for (auto& string : swap_tenors) {
+		cstrings_expiries.push_back(&string.front());
+	}
+
+	// bootstrap discount curve
+	curve_set->curve = build_zero_interest_rate_curve2(curve_set->value_date
+		, swap_rates.data()
+		, cstrings_expiries.data()
+		, maturity.data()
+		, verbose);
+
+	curve_set->curve_dv01 = build_zero_interest_rate_curve2(curve_set->value_date
+		, swap_rates_dv01.data()
+		, cstrings_expiries.data()
+		, maturity.data()
+		, verbose);
+
+	if (curve_set->curve == NULL || curve_set->curve_dv01 == NULL) {
+		if (verbose) {
+			std::cout << "bad zerocurve" << std::endl;
+		}
+		return -1;
+	}
+
+	return register_curve_handle(curve_set);
+};
+
+int cds_discount_curve_handle(
+	string value_date,						/* (I) date to value the cds DD/MM/YYYY */
+	vector<double> swap_rates, 				/* (I) swap rates */
+	vector<string> swap_tenors,				/* (I) swap tenors "1M", "2M" */
+	vector<string> swap_maturities,			/* (I) swap maturity dates */
+	int verbose
+) {
+
+	vector<long int> maturity;
+
+	for (int r = 0; r < static_cast<int>(swap_maturities.size()); r++) {
+		maturity.push_back(parse_string_ddmmyyyy_to_jpmcdsdate(swap_maturities[r]));
+	}
+
+	return discount_curve_handle(parse_string_ddmmyyyy_to_jpmcdsdate(value_date)
+		, swap_rates
+		, swap_tenors
+		, maturity
+		, verbose);
+};
+
+int cds_discount_curve_handle_tdate(
+	int value_date,							/* (I) date to value the cds as TDate */
+	vector<double> swap_rates, 				/* (I) swap rates */
+	vector<string> swap_tenors,				/* (I) swap tenors "1M", "2M" */
+	vector<int> swap_maturities,			/* (I) swap maturity dates as TDate */
+	int verbose
+) {
+
+	return discount_curve_handle(value_date
+		, swap_rates
+		, swap_tenors
+		, to_jpmcdsdates(swap_maturities)
+		, verbose);
+};
+
+static int spread_curve_handle(
+	TDate value_date_jpm,					/* (I) date to value the cds */
+	TDate effective_date_jpm,				/* (I) effective date of cds */
+	double recovery_rate,					/* (I) recover rate of the curve in basis points */
+	int discount_curve_handle,				/* (I) handle from cds_discount_curve_handle */
+	vector<double> spread_rates,			/* (I) spread spreads */
+	vector<long int> tenors,				/* (I) imm dates */
+	int verbose
+) {
+
+	// turned on once for the three curve builds below
+	JpmcdsErrMsgOn();
+	JpmcdsErrMsgEnableRecord(20, 128); /* ie. 20 lines, each of max length 128 */
+
+	// used in risk calculations
+	double single_basis_point = 0.0001;
+
+	vector<double> spreads_cs01;
+
+	std::shared_ptr<CurveSet> discount = find_curve_handle(discount_curve_handle);
+	if (!discount || discount->discount) {
+		if (verbose) {
+			std::cout << "bad discount curve handle " << discount_curve_handle << std::endl;
+		}
+		return -1;
+	}
+
+	std::shared_ptr<CurveSet> curve_set(new CurveSet());
+	curve_set->value_date = value_date_jpm;
+	curve_set->recovery_rate = recovery_rate;
+	curve_set->discount = discount;
+	curve_set->rates = spread_rates;
+	curve_set->dates = tenors;
+	curve_set->effective_date = effective_date_jpm;
+
+	for (int r = 0; r < static_cast<int>(spread_rates.size()); r++) {
+		spreads_cs01.push_back(spread_rates[r] + single_basis_point);
+	}
+
+	// build base case spread curve
+	curve_set->curve = build_credit_spread_par_curve_with_conventions(
+		standard_cds_conventions()
+		, curve_set->value_date
+		, discount->curve
+		, effective_date_jpm
+		, spread_rates.data()
+		, tenors.data()
+		, recovery_rate
+		, static_cast<int>(tenors.size())
+		, verbose);
+
+	// build cs01 spread curve
+	curve_set->curve_cs01 = build_credit_spread_par_curve_with_conventions(
+		standard_cds_conventions()
+		, curve_set->value_date
+		, discount->curve
+		, effective_date_jpm
+		, spreads_cs01.data()
+		, tenors.data()
+		, recovery_rate
+		, static_cast<int>(tenors.size())
+		, verbose);
+
+	// build dv01 spread_curve
+	curve_set->curve_dv01 = build_credit_spread_par_curve_with_conventions(
+		standard_cds_conventions()
+		, curve_set->value_date
+		, discount->curve_dv01
+		, effective_date_jpm
+		, spread_rates.data()
+		, tenors.data()
+		, recovery_rate
+		, static_cast<int>(tenors.size())
+		, verbose);
+
+	if (curve_set->curve == NULL || curve_set->curve_cs01 == NULL || curve_set->curve_dv01 == NULL) {
+		if (verbose) {
+			std::cout << "bad spreadcurve" << std::endl;
+		}
+		return -1;
+	}
+
+	return register_curve_handle(curve_set);
+};
+
+int cds_spread_curve_handle(
+	string value_date,						/* (I) date to value the cds DD/MM/YYYY */
+	string effective_date,					/* (I) effective date of cds as DD/MM/YYYY */
+	double recovery_rate,					/* (I) recover rate of the curve in basis points */
+	int discount_curve_handle,				/* (I) handle from cds_discount_curve_handle */
+	vector<double> spread_rates,			/* (I) spread spreads */
+	vector<string> imm_dates,				/* (I) imm dates */
+	int verbose
+) {
+
+	vector<long int> tenors;
+
+	// parse imm dates into jpm string format
+	for (int r = 0; r < static_cast<int>(imm_dates.size()); r++) {
+		tenors.push_back(parse_string_ddmmyyyy_to_jpmcdsdate(imm_dates[r]));
+	}
+
+	return spread_curve_handle(parse_string_ddmmyyyy_to_jpmcdsdate(value_date)
+		, parse_string_ddmmyyyy_to_jpmcdsdate(effective_date)
+		, recovery_rate
+		, discount_curve_handle
+		, spread_rates
+		, tenors
+		, verbose);
+};
+
+int cds_spread_curve_handle_tdate(
+	int value_date,							/* (I) date to value the cds as TDate */
+	int effective_date,						/* (I) effective date of cds as TDate */
+	double recovery_rate,					/* (I) recover rate of the curve in basis points */
+	int discount_curve_handle,				/* (I) handle from cds_discount_curve_handle */
+	vector<double> spread_rates,			/* (I) spread spreads */
+	vector<int> imm_dates,					/* (I) imm dates as TDate */
+	int verbose
+) {
+
+	return spread_curve_handle(value_date
+		, effective_date
+		, recovery_rate
+		, discount_curve_handle
+		, spread_rates
+		, to_jpmcdsdates(imm_dates)
+		, verbose);
+};
+
+// bootstrap the key rate curves of a curve set once, later calls reuse them
+static bool build_key_rate_curves(CurveSet& curve_set, int verbose)
+{
+	// used in risk calculations
+	double single_basis_point = 0.0001;
+
+	std::lock_guard<std::mutex> lock(curve_set.key_rate_mutex);
+
+	if (!curve_set.key_rate_curves.empty()) {
+		return true;
+	}
+
+	vector<TCurve*> key_rate_curves;
+
+	if (curve_set.discount) {
+
+		// every spread curve is bootstrapped on the matching bumped discount curve
+		if (!build_key_rate_curves(*curve_set.discount, verbose)) {
+			return false;
+		}
+
+		for (auto discount_curve : curve_set.discount->key_rate_curves) {
+			key_rate_curves.push_back(build_credit_spread_par_curve_with_conventions(
+				standard_cds_conventions()
+				, curve_set.value_date
+				, discount_curve
+				, curve_set.effective_date
+				, curve_set.rates.data()
+				, curve_set.dates.data()
+				, curve_set.recovery_rate
+				, static_cast<int>(curve_set.dates.size())
+				, verbose));
+		}
+	} else {
+
+		vector<char*> cstrings_expiries{};
+		for (auto& string : curve_set.swap_tenors) {
+			cstrings_expiries.push_back(&string.front());
+		}
+
+		for (int k = 0; k < static_cast<int>(curve_set.rates.size()); k++) {
+			vector<double> swap_rates_dv01(curve_set.rates);
+			swap_rates_dv01[k] += single_basis_point;
+			key_rate_curves.push_back(build_zero_interest_rate_curve2(curve_set.value_date
+				, swap_rates_dv01.data()
+				, cstrings_expiries.data()
+				, curve_set.dates.data()
+				, verbose));
+		}
+	}
+
+	bool ok = !key_rate_curves.empty()
+		&& std::find(key_rate_curves.begin(), key_rate_curves.end(), static_cast<TCurve*>(NULL)) == key_rate_curves.end();
+
+	if (!ok) {
+		if (verbose) {
+			std::cout << "bad key rate curve" << std::endl;
+		}
+		for (auto key_rate_curve : key_rate_curves) {
+			JpmcdsFreeTCurve(key_rate_curve);
+		}
+		return false;
+	}
+
+	curve_set.key_rate_curves = key_rate_curves;
+	return true;
+}
+
+// bootstrap the single pillar bumped spread curves of a curve set once, later calls reuse them
+static bool build_bucket_curves(CurveSet& curve_set, int verbose)
+{
+	// used in risk calculations
+	double single_basis_point = 0.0001;
+
+	std::lock_guard<std::mutex> lock(curve_set.bucket_mutex);
+
+	if (!curve_set.bucket_curves.empty()) {
+		return true;
+	}
+
+	int pillars = static_cast<int>(curve_set.dates.size());
+	vector<TCurve*> bucket_curves(pillars, static_cast<TCurve*>(NULL));
+
+	// solved with newton, its base agrees with the handle's brent curve to the
+	// solver tolerance and is dropped
+	TCurve *base = pillars == 0 ? NULL : build_credit_spread_par_curve_buckets_with_conventions(
+		newton_cds_conventions()
+		, curve_set.value_date
+		, curve_set.discount->curve
+		, curve_set.effective_date
+		, curve_set.rates.data()
+		, curve_set.dates.data()
+		, curve_set.recovery_rate
+		, pillars
+		, single_basis_point
+		, bucket_curves.data()
+		, verbose);
+
+	if (base == NULL) {
+		if (verbose) {
+			std::cout << "bad bucketed spread curves" << std::endl;
+		}
+		return false;
+	}
+
+	JpmcdsFreeTCurve(base);
+	curve_set.bucket_curves = bucket_curves;
+	return true;
+}
+
+// implicit function sensitivities of a spread curve's rates to its spreads and discount rates
+static bool build_spread_curve_jacobian(CurveSet& curve_set, int verbose)
+{
+	std::lock_guard<std::mutex> lock(curve_set.jacobian_mutex);
+
+	if (!curve_set.rate_by_quote.empty()) {
+		return true;
+	}
+
+	int pillars = static_cast<int>(curve_set.dates.size());
+	vector<double> rate_by_quote(pillars * pillars, 0.0);
+	vector<double> rate_by_discount(pillars * curve_set.discount->curve->fNumItems, 0.0);
+
+	if (pillars == 0 || credit_spread_par_curve_jacobian_with_conventions(
+		standard_cds_conventions()
+		, curve_set.value_date
+		, curve_set.discount->curve
+		, curve_set.effective_date
+		, curve_set.rates.data()
+		, curve_set.dates.data()
+		, curve_set.recovery_rate
+		, pillars
+		, curve_set.curve
+		, rate_by_quote.data()
+		, rate_by_discount.data()
+		, verbose) != SUCCESS) {
+		if (verbose) {
+			std::cout << "bad spread curve jacobian" << std::endl;
+		}
+		return false;
+	}
+
+	curve_set.rate_by_discount = rate_by_discount;
+	curve_set.rate_by_quote = rate_by_quote;
+	return true;
+}
+
+// price a single trade against a spread curve set: dirty, clean, ai, cs01, dv01
+static void price_cds_curve_set(
+	const CurveSet& spread,
+	TDate maturity_date_jpm,
+	TDate accrual_start_date_jpm,
+	double coupon_rate,
+	double notional,
+	int is_buy_protection,
+	int verbose,
+	double *result
+) {
+
+	double coupon_rate_in_basis_points = coupon_rate / 10000.0;
+	double credit_risk_direction_scale_factor = is_buy_protection ? -1 : 1;
+
+	int is_dirty_price = 0;
+
+	TCdsTrade *trade = prepare_cds_trade_with_conventions(
+		standard_cds_conventions()
+		, spread.value_date
+		, maturity_date_jpm
+		, accrual_start_date_jpm
+		, coupon_rate_in_basis_points
+		, verbose);
+
+	double dirtypv = 0.0;
+	double cleanpv = 0.0;
+
+	// calculate dirty and clean price cds from one valuation of the legs
+	calculate_cds_trade_prices(trade
+		, spread.discount->curve
+		, spread.curve
+		, spread.recovery_rate
+		, &dirtypv
+		, &cleanpv
+		, verbose);
+	dirtypv = -dirtypv;
+	cleanpv = -cleanpv;
+
+	double dirtypv_cs01 = -calculate_cds_trade_price(trade
+		, spread.discount->curve
+		, spread.curve_cs01
+		, spread.recovery_rate
+		, is_dirty_price
+		, verbose);
+
+	double dirtypv_dv01 = -calculate_cds_trade_price(trade
+		, spread.discount->curve_dv01
+		, spread.curve_dv01
+		, spread.recovery_rate
+		, is_dirty_price
+		, verbose);
+
+	JpmcdsCdsTradeFree(trade);
+
+	result[0] = dirtypv * notional * credit_risk_direction_scale_factor;
+	result[1] = cleanpv * notional * credit_risk_direction_scale_factor;
+	result[2] = (dirtypv - cleanpv) * notional;
+	result[3] = (dirtypv_cs01 - dirtypv) * notional * credit_risk_direction_scale_factor;
+	result[4] = (dirtypv_dv01 - dirtypv) * notional * credit_risk_direction_scale_factor;
+}
+
+vector<double> cds_price_curve_handle_tdate(
+	int maturity_date,						/* (I) maturity date of cds as TDate */
+	int accrual_start_date,					/* (I) accrual start date of cds as TDate */
+	double coupon_rate,						/* (I) CouponRate (e.g. 0.05 = 5% = 500bp) */
+	double notional,						/* (I) Notional MM */
+	int is_buy_protection,					/* (I) direction of credit risk */
+	int spread_curve_handle,				/* (I) handle from cds_spread_curve_handle */
+	int verbose
+) {
+
+	int start_s = clock();
+
+	JpmcdsErrMsgEnableRecord(20, 128); /* ie. 20 lines, each of max length 128 */
+
+	vector<double> allinone;
+	double result[5] = { 0.0, 0.0, 0.0, 0.0, 0.0 };
+	int status = 1;
+
+	std::shared_ptr<CurveSet> spread = find_curve_handle(spread_curve_handle);
+
+	if (spread && spread->discount) {
+		price_cds_curve_set(*spread
+			, maturity_date
+			, accrual_start_date
+			, coupon_rate
+			, notional
+			, is_buy_protection
+			, verbose
+			, result);
+	} else {
+		if (verbose) {
+			std::cout << "bad spread curve handle " << spread_curve_handle << std::endl;
+		}
+		status = -1;
+	}
+
+	allinone.assign(result, result + 5);
+	allinone.push_back(status);
+	allinone.push_back((clock() - start_s));
+
+	return allinone;
+};
+
+vector<double> cds_price_curve_handle(
+	string maturity_date,					/* (I) maturity date of cds as DD/MM/YYYY */
+	string accrual_start_date,				/* (I) accrual start date of cds as DD/MM/YYYY */
+	double coupon_rate,						/* (I) CouponRate (e.g. 0.05 = 5% = 500bp) */
+	double notional,						/* (I) Notional MM */
+	int is_buy_protection,					/* (I) direction of credit risk */
+	int spread_curve_handle,				/* (I) handle from cds_spread_curve_handle */
+	int verbose
+) {
+
+	return cds_price_curve_handle_tdate(parse_string_ddmmyyyy_to_jpmcdsdate(maturity_date)
+		, parse_string_ddmmyyyy_to_jpmcdsdate(accrual_start_date)
+		, coupon_rate
+		, notional
+		, is_buy_protection
+		, spread_curve_handle
+		, verbose);
+};
+
+// books share a handful of imm maturities and accrual starts, so each distinct date is parsed once
+static vector<int> parse_book_dates(const vector<string>& dates, std::map<string, TDate>& parsed_dates)
+{
+	vector<int> jpm_dates;
+	jpm_dates.reserve(dates.size());
+	for (const string& s : dates) {
+		std::map<string, TDate>::iterator it = parsed_dates.find(s);
+		if (it == parsed_dates.end()) {
+			it = parsed_dates.insert(std::make_pair(s, parse_string_ddmmyyyy_to_jpmcdsdate(s))).first;
+		}
+		jpm_dates.push_back(static_cast<int>(it->second));
+	}
+	return jpm_dates;
+}
+
+vector< vector<double> > cds_portfolio_price_tdate(
+	vector<int> maturity_dates,				/* (I) maturity date per trade as TDate */
+	vector<int> accrual_start_dates,		/* (I) accrual start date per trade as TDate */
+	vector<double> coupon_rates,			/* (I) CouponRate per trade (e.g. 100 = 1%) */
+	vector<double> notionals,				/* (I) Notional MM per trade */
+	vector<int> is_buy_protection,			/* (I) direction of credit risk per trade */
+	vector<int> curve_indices,				/* (I) index into spread_curve_handles per trade */
+	vector<int> spread_curve_handles,		/* (I) handles from cds_spread_curve_handle */
+	int verbose
+) {
+
+	int start_s = clock();
+
+	JpmcdsErrMsgEnableRecord(20, 128); /* ie. 20 lines, each of max length 128 */
+
+	int n = static_cast<int>(maturity_dates.size());
+
+	// outer return vector, one contiguous column per measure
+	vector < vector<double> > allinone(6, vector<double>(n, 0.0));
+
+	vector< std::shared_ptr<CurveSet> > curves;
+	for (int c = 0; c < static_cast<int>(spread_curve_handles.size()); c++) {
+		curves.push_back(find_curve_handle(spread_curve_handles[c]));
+	}
+
+	bool columns_ok = static_cast<int>(accrual_start_dates.size()) == n
+		&& static_cast<int>(coupon_rates.size()) == n
+		&& static_cast<int>(notionals.size()) == n
+		&& static_cast<int>(is_buy_protection.size()) == n
+		&& static_cast<int>(curve_indices.size()) == n;
+
+	for (int t = 0; columns_ok && t < n; t++) {
+
+		int c = curve_indices[t];
+		if (c < 0 || c >= static_cast<int>(curves.size()) || !curves[c] || !curves[c]->discount) {
+			if (verbose) {
+				std::cout << "bad curve index " << c << " for trade " << t << std::endl;
+			}
+			allinone[5][t] = -1;
+			continue;
+		}
+
+		double result[5];
+		price_cds_curve_set(*curves[c]
+			, maturity_dates[t]
+			, accrual_start_dates[t]
+			, coupon_rates[t]
+			, notionals[t]
+			, is_buy_protection[t]
+			, verbose
+			, result);
+
+		for (int m = 0; m < 5; m++) {
+			allinone[m][t] = result[m];
+		}
+		allinone[5][t] = 1;
+	}
+
+	if (!columns_ok) {
+		if (verbose) {
+			std::cout << "trade columns must all have " << n << " entries" << std::endl;
+		}
+		std::fill(allinone[5].begin(), allinone[5].end(), -1);
+	}
+
+	vector <double> allinone_time;
+	allinone_time.push_back((clock() - start_s));
+	allinone.push_back(allinone_time);
+
+	return allinone;
+};
+
+vector< vector<double> > cds_portfolio_price(
+	vector<string> maturity_dates,			/* (I) maturity date per trade DD/MM/YYYY */
+	vector<string> accrual_start_dates,		/* (I) accrual start date per trade DD/MM/YYYY */
+	vector<double> coupon_rates,			/* (I) CouponRate per trade (e.g. 100 = 1%) */
+	vector<double> notionals,				/* (I) Notional MM per trade */
+	vector<int> is_buy_protection,			/* (I) direction of credit risk per trade */
+	vector<int> curve_indices,				/* (I) index into spread_curve_handles per trade */
+	vector<int> spread_curve_handles,		/* (I) handles from cds_spread_curve_handle */
+	int verbose
+) {
+
+	std::map<string, TDate> parsed_dates;
+
+	return cds_portfolio_price_tdate(parse_book_dates(maturity_dates, parsed_dates)
+		, parse_book_dates(accrual_start_dates, parsed_dates)
+		, coupon_rates
+		, notionals
+		, is_buy_protection
+		, curve_indices
+		, spread_curve_handles
+		, verbose);
+};
+
+vector< vector<double> > cds_bucketed_dv01_tdate(
+	vector<int> maturity_dates,				/* (I) maturity date per trade as TDate */
+	vector<int> accrual_start_dates,		/* (I) accrual start date per trade as TDate */
+	vector<double> coupon_rates,			/* (I) CouponRate per trade (e.g. 100 = 1%) */
+	vector<double> notionals,				/* (I) Notional MM per trade */
+	vector<int> is_buy_protection,			/* (I) direction of credit risk per trade */
+	int spread_curve_handle,				/* (I) handle from cds_spread_curve_handle */
+	int verbose
+) {
+
+	int start_s = clock();
+
+	JpmcdsErrMsgEnableRecord(20, 128); /* ie. 20 lines, each of max length 128 */
+
+	int is_dirty_price = 0;
+
+	int n = static_cast<int>(maturity_dates.size());
+
+	std::shared_ptr<CurveSet> spread = find_curve_handle(spread_curve_handle);
+
+	bool columns_ok = static_cast<int>(accrual_start_dates.size()) == n
+		&& static_cast<int>(coupon_rates.size()) == n
+		&& static_cast<int>(notionals.size()) == n
+		&& static_cast<int>(is_buy_protection.size()) == n;
+
+	// key rate curves are built by the first call on a handle and shared by every later book
+	bool curves_ok = spread && spread->discount && build_key_rate_curves(*spread, verbose);
+
+	int tenors = curves_ok ? static_cast<int>(spread->key_rate_curves.size()) : 0;
+
+	// outer return vector, one row of swap tenor dv01 per trade
+	vector < vector<double> > allinone(n, vector<double>(tenors, 0.0));
+	vector <double> allinone_status(n, -1);
+
+	if (!curves_ok) {
+		if (verbose) {
+			std::cout << "bad spread curve handle " << spread_curve_handle << std::endl;
+		}
+	} else if (!columns_ok) {
+		if (verbose) {
+			std::cout << "trade columns must all have " << n << " entries" << std::endl;
+		}
+	}
+
+	for (int t = 0; curves_ok && columns_ok && t < n; t++) {
+
+		double credit_risk_direction_scale_factor = is_buy_protection[t] ? -1 : 1;
+
+		TCdsTrade *trade = prepare_cds_trade_with_conventions(
+			standard_cds_conventions()
+			, spread->value_date
+			, maturity_dates[t]
+			, accrual_start_dates[t]
+			, coupon_rates[t] / 10000.0
+			, verbose);
+
+		double dirtypv = -calculate_cds_trade_price(trade
+			, spread->discount->curve
+			, spread->curve
+			, spread->recovery_rate
+			, is_dirty_price
+			, verbose);
+
+		for (int k = 0; k < tenors; k++) {
+			double dirtypv_dv01 = -calculate_cds_trade_price(trade
+				, spread->discount->key_rate_curves[k]
+				, spread->key_rate_curves[k]
+				, spread->recovery_rate
+				, is_dirty_price
+				, verbose);
+			allinone[t][k] = (dirtypv_dv01 - dirtypv) * notionals[t] * credit_risk_direction_scale_factor;
+		}
+
+		JpmcdsCdsTradeFree(trade);
+		allinone_status[t] = 1;
+	}
+
+	vector <double> allinone_time;
+	allinone_time.push_back((clock() - start_s));
+	allinone.push_back(allinone_status);
+	allinone.push_back(allinone_time);
+
+	return allinone;
+};
+
+vector< vector<double> > cds_bucketed_dv01(
+	vector<string> maturity_dates,			/* (I) maturity date per trade DD/MM/YYYY */
+	vector<string> accrual_start_dates,		/* (I) accrual start date per trade DD/MM/YYYY */
+	vector<double> coupon_rates,			/* (I) CouponRate per trade (e.g. 100 = 1%) */
+	vector<double> notionals,				/* (I) Notional MM per trade */
+	vector<int> is_buy_protection,			/* (I) direction of credit risk per trade */
+	int spread_curve_handle,				/* (I) handle from cds_spread_curve_handle */
+	int verbose
+) {
+
+	std::map<string, TDate> parsed_dates;
+
+	return cds_bucketed_dv01_tdate(parse_book_dates(maturity_dates, parsed_dates)
+		, parse_book_dates(accrual_start_dates, parsed_dates)
+		, coupon_rates
+		, notionals
+		, is_buy_protection
+		, spread_curve_handle
+		, verbose);
+};
+
+vector< vector<double> > cds_adjoint_risk_tdate(
+	vector<int> maturity_dates,				/* (I) maturity date per trade as TDate */
+	vector<int> accrual_start_dates,		/* (I) accrual start date per trade as TDate */
+	vector<double> coupon_rates,			/* (I) CouponRate per trade (e.g. 100 = 1%) */
+	vector<double> notionals,				/* (I) Notional MM per trade */
+	vector<int> is_buy_protection,			/* (I) direction of credit risk per trade */
+	int spread_curve_handle,				/* (I) handle from cds_spread_curve_handle */
+	int verbose
+) {
+
+	int start_s = clock();
+
+	JpmcdsErrMsgEnableRecord(20, 128); /* ie. 20 lines, each of max length 128 */
+
+	// used in risk calculations
+	double single_basis_point = 0.0001;
+	int is_dirty_price = 0;
+
+	int n = static_cast<int>(maturity_dates.size());
+
+	std::shared_ptr<CurveSet> spread = find_curve_handle(spread_curve_handle);
+
+	bool columns_ok = static_cast<int>(accrual_start_dates.size()) == n
+		&& static_cast<int>(coupon_rates.size()) == n
+		&& static_cast<int>(notionals.size()) == n
+		&& static_cast<int>(is_buy_protection.size()) == n;
+
+	// the curve jacobian is built by the first call on a handle and shared by every later book
+	bool curves_ok = spread && spread->discount && build_spread_curve_jacobian(*spread, verbose);
+
+	int pillars = curves_ok ? spread->curve->fNumItems : 0;
+	int points = curves_ok ? spread->discount->curve->fNumItems : 0;
+
+	// outer return vector, one row per trade of cs01 per spread pillar then dv01 per discount curve point
+	vector < vector<double> > allinone(n, vector<double>(pillars + points, 0.0));
+	vector <double> allinone_status(n, -1);
+
+	if (!curves_ok) {
+		if (verbose) {
+			std::cout << "bad spread curve handle " << spread_curve_handle << std::endl;
+		}
+	} else if (!columns_ok) {
+		if (verbose) {
+			std::cout << "trade columns must all have " << n << " entries" << std::endl;
+		}
+	}
+
+	for (int t = 0; curves_ok && columns_ok && t < n; t++) {
+
+		double credit_risk_direction_scale_factor = is_buy_protection[t] ? -1 : 1;
+
+		TCdsTrade *trade = prepare_cds_trade_with_conventions(
+			standard_cds_conventions()
+			, spread->value_date
+			, maturity_dates[t]
+			, accrual_start_dates[t]
+			, coupon_rates[t] / 10000.0
+			, verbose);
+
+		// one reverse sweep gives the price sensitivity to every curve rate
+		double price;
+		vector<double> disc_grad(points, 0.0);
+		vector<double> spread_grad(pillars, 0.0);
+
+		if (trade == NULL || JpmcdsCdsTradePriceRateGrad(trade
+			, spread->discount->curve
+			, spread->curve
+			, spread->recovery_rate
+			, is_dirty_price
+			, &price
+			, disc_grad.data()
+			, spread_grad.data()) != SUCCESS) {
+			JpmcdsCdsTradeFree(trade);
+			continue;
+		}
+
+		// chain through the bootstrap to the quoted spreads, the pv is minus the price
+		double scale = -single_basis_point * notionals[t] * credit_risk_direction_scale_factor;
+		for (int i = 0; i < pillars; i++) {
+			for (int k = 0; k < pillars; k++) {
+				allinone[t][k] += scale * spread_grad[i] * spread->rate_by_quote[i * pillars + k];
+			}
+			for (int m = 0; m < points; m++) {
+				disc_grad[m] += spread_grad[i] * spread->rate_by_discount[i * points + m];
+			}
+		}
+		for (int m = 0; m < points; m++) {
+			allinone[t][pillars + m] = scale * disc_grad[m];
+		}
+
+		JpmcdsCdsTradeFree(trade);
+		allinone_status[t] = 1;
+	}
+
+	vector <double> allinone_time;
+	allinone_time.push_back((clock() - start_s));
+	allinone.push_back(allinone_status);
+	allinone.push_back(allinone_time);
+
+	return allinone;
+};
+
+vector< vector<double> > cds_adjoint_risk(
+	vector<string> maturity_dates,			/* (I) maturity date per trade DD/MM/YYYY */
+	vector<string> accrual_start_dates,		/* (I) accrual start date per trade DD/MM/YYYY */
+	vector<double> coupon_rates,			/* (I) CouponRate per trade (e.g. 100 = 1%) */
+	vector<double> notionals,				/* (I) Notional MM per trade */
+	vector<int> is_buy_protection,			/* (I) direction of credit risk per trade */
+	int spread_curve_handle,				/* (I) handle from cds_spread_curve_handle */
+	int verbose
+) {
+
+	std::map<string, TDate> parsed_dates;
+
+	return cds_adjoint_risk_tdate(parse_book_dates(maturity_dates, parsed_dates)
+		, parse_book_dates(accrual_start_dates, parsed_dates)
+		, coupon_rates
+		, notionals
+		, is_buy_protection
+		, spread_curve_handle
+		, verbose);
+};
+
+vector< vector<double> > cds_bucketed_cs01_tdate(
+	vector<int> maturity_dates,				/* (I) maturity date per trade as TDate */
+	vector<int> accrual_start_dates,		/* (I) accrual start date per trade as TDate */
+	vector<double> coupon_rates,			/* (I) CouponRate per trade (e.g. 100 = 1%) */
+	vector<double> notionals,				/* (I) Notional MM per trade */
+	vector<int> is_buy_protection,			/* (I) direction of credit risk per trade */
+	int spread_curve_handle,				/* (I) handle from cds_spread_curve_handle */
+	int verbose
+) {
+
+	int start_s = clock();
+
+	JpmcdsErrMsgEnableRecord(20, 128); /* ie. 20 lines, each of max length 128 */
+
+	int is_dirty_price = 0;
+
+	int n = static_cast<int>(maturity_dates.size());
+
+	std::shared_ptr<CurveSet> spread = find_curve_handle(spread_curve_handle);
+
+	bool columns_ok = static_cast<int>(accrual_start_dates.size()) == n
+		&& static_cast<int>(coupon_rates.size()) == n
+		&& static_cast<int>(notionals.size()) == n
+		&& static_cast<int>(is_buy_protection.size()) == n;
+
+	// bumped curves are built by the first call on a handle and shared by every later book
+	bool curves_ok = spread && spread->discount && build_bucket_curves(*spread, verbose);
+
+	int pillars = curves_ok ? static_cast<int>(spread->bucket_curves.size()) : 0;
+
+	// outer return vector, one row of pillar cs01 per trade
+	vector < vector<double> > allinone(n, vector<double>(pillars, 0.0));
+	vector <double> allinone_status(n, -1);
+
+	if (!curves_ok) {
+		if (verbose) {
+			std::cout << "bad spread curve handle " << spread_curve_handle << std::endl;
+		}
+	} else if (!columns_ok) {
+		if (verbose) {
+			std::cout << "trade columns must all have " << n << " entries" << std::endl;
+		}
+	}
+
+	for (int t = 0; curves_ok && columns_ok && t < n; t++) {
+
+		double credit_risk_direction_scale_factor = is_buy_protection[t] ? -1 : 1;
+
+		TCdsTrade *trade = prepare_cds_trade_with_conventions(
+			standard_cds_conventions()
+			, spread->value_date
+			, maturity_dates[t]
+			, accrual_start_dates[t]
+			, coupon_rates[t] / 10000.0
+			, verbose);
+
+		double dirtypv = -calculate_cds_trade_price(trade
+			, spread->discount->curve
+			, spread->curve
+			, spread->recovery_rate
+			, is_dirty_price
+			, verbose);
+
+		for (int k = 0; k < pillars; k++) {
+			double dirtypv_cs01 = -calculate_cds_trade_price(trade
+				, spread->discount->curve
+				, spread->bucket_curves[k]
+				, spread->recovery_rate
+				, is_dirty_price
+				, verbose);
+			allinone[t][k] = (dirtypv_cs01 - dirtypv) * notionals[t] * credit_risk_direction_scale_factor;
+		}
+
+		JpmcdsCdsTradeFree(trade);
+		allinone_status[t] = 1;
+	}
+
+	vector <double> allinone_time;
+	allinone_time.push_back((clock() - start_s));
+	allinone.push_back(allinone_status);
+	allinone.push_back(allinone_time);
+
+	return allinone;
+};
+
+vector< vector<double> > cds_bucketed_cs01(
+	vector<string> maturity_dates,			/* (I) maturity date per trade DD/MM/YYYY */
+	vector<string> accrual_start_dates,		/* (I) accrual start date per trade DD/MM/YYYY */
+	vector<double> coupon_rates,			/* (I) CouponRate per trade (e.g. 100 = 1%) */
+	vector<double> notionals,				/* (I) Notional MM per trade */
+	vector<int> is_buy_protection,			/* (I) direction of credit risk per trade */
+	int spread_curve_handle,				/* (I) handle from cds_spread_curve_handle */
+	int verbose
+) {
+
+	std::map<string, TDate> parsed_dates;
+
+	return cds_bucketed_cs01_tdate(parse_book_dates(maturity_dates, parsed_dates)
+		, parse_book_dates(accrual_start_dates, parsed_dates)
+		, coupon_rates
+		, notionals
+		, is_buy_protection
+		, spread_curve_handle
+		, verbose);
+};
+
+// cds_scenario_roll_grid once its dates are TDates, shared by the string and TDate entry points
+static vector< vector<double> > scenario_roll_grid(
+	TDate value_date_jpm,					/* (I) date to value the cds */
+	TDate effective_date_jpm,				/* (I) effective date of cds */
+	TDate maturity_date_jpm,				/* (I) maturity date of cds */
+	TDate accrual_start_date_jpm,			/* (I) accrual start date of cds */
+	double recovery_rate,					/* (I) recover rate of the curve in basis points */
+	double coupon_rate,						/* (I) CouponRate (e.g. 100 = 1%) */
+	double notional,						/* (I) Notional MM */
+	int is_buy_protection,					/* (I) direction of credit risk */
+	int discount_curve_handle,				/* (I) handle from cds_discount_curve_handle */
+	vector<double> spread_rates,			/* (I) spread spreads */
+	vector<long int> tenors,				/* (I) imm dates */
+	vector<string> spread_roll_tenors,		/* (I) spread roll tenors */
+	vector<double> scenario_tenors,			/* (I) spread tenors -100, -90, -80, -70 ... */
+	int number_of_threads,					/* (I) worker threads, 0 uses every core */
+	int verbose
+) {
+
+	int start_s = clock();
+
+	JpmcdsErrMsgEnableRecord(20, 128); /* ie. 20 lines, each of max length 128 */
+
+	int scenarios = static_cast<int>(scenario_tenors.size());
+	int rolls = static_cast<int>(spread_roll_tenors.size());
+	int pillars = static_cast<int>(tenors.size());
+
+	double credit_risk_direction_scale_factor = is_buy_protection ? -1 : 1;
+
+	// dense (scenario, roll date, dirty/clean) cube, then its shape
+	vector < vector<double> > allinone;
+	vector <double> cube(scenarios * rolls * 2, 0.0);
+	vector <double> shape{ static_cast<double>(scenarios), static_cast<double>(rolls), 2.0 };
+	vector <double> allinone_status(scenarios, -1);
+
+	std::shared_ptr<CurveSet> discount = find_curve_handle(discount_curve_handle);
+
+	if (!discount || discount->discount || static_cast<int>(spread_rates.size()) != pillars) {
+		if (verbose) {
+			std::cout << "bad discount curve handle " << discount_curve_handle << " or spreads" << std::endl;
+		}
+	} else {
+
+		vector<char*> cstrings_spread_roll_expiries{};
+		for (auto& string : spread_roll_tenors) {
+			cstrings_spread_roll_expiries.push_back(&string.front());
+		}
+
+		TDate *pointer_roll_dates_jpm = calculate_cds_roll_dates(maturity_date_jpm,
+			cstrings_spread_roll_expiries.data(),
+			rolls,
+			verbose);
+
+		// the fee leg schedule of each roll date is built once for every scenario
+		vector<TCdsTrade*> roll_trades;
+		for (int r = 0; r < rolls; r++) {
+			roll_trades.push_back(prepare_cds_trade_with_conventions(
+				standard_cds_conventions()
+				, value_date_jpm
+				, pointer_roll_dates_jpm[r]
+				, accrual_start_date_jpm
+				, coupon_rate / 10000.0
+				, verbose));
+		}
+
+		// scenario curves are independent bootstraps, solved with newton
+		vector<TCurve*> scenario_curves(scenarios, static_cast<TCurve*>(NULL));
+		run_quote_workers(scenarios, number_of_threads, [&](int s) {
+
+			vector<double> spreads_scenario;
+			for (int r = 0; r < pillars; r++) {
+				spreads_scenario.push_back(spread_rates[r] + spread_rates[r] * scenario_tenors[s] / 100);
+			}
+
+			scenario_curves[s] = build_credit_spread_par_curve_with_conventions(
+				newton_cds_conventions()
+				, value_date_jpm
+				, discount->curve
+				, effective_date_jpm
+				, spreads_scenario.data()
+				, tenors.data()
+				, recovery_rate
+				, pillars
+				, verbose);
+		});
+
+		// a roll trade caches its timelines, so each one stays on a single worker and
+		// reuses them for every scenario curve, which all share the same dates
+		vector<char> priced(scenarios * rolls, 0);
+		run_quote_workers(rolls, number_of_threads, [&](int r) {
+
+			for (int s = 0; s < scenarios; s++) {
+
+				double roll_pvdirty;
+				double roll_pvclean;
+
+				if (scenario_curves[s] == NULL || roll_trades[r] == NULL
+					|| calculate_cds_trade_prices(roll_trades[r]
+						, discount->curve
+						, scenario_curves[s]
+						, recovery_rate
+						, &roll_pvdirty
+						, &roll_pvclean
+						, verbose) != 0) {
+					continue;
+				}
+
+				cube[(s * rolls + r) * 2] = -roll_pvdirty * notional * credit_risk_direction_scale_factor;
+				cube[(s * rolls + r) * 2 + 1] = -roll_pvclean * notional * credit_risk_direction_scale_factor;
+				priced[s * rolls + r] = 1;
+			}
+		});
+
+		for (int s = 0; s < scenarios; s++) {
+			bool scenario_ok = std::find(priced.begin() + s * rolls, priced.begin() + (s + 1) * rolls, 0)
+				== priced.begin() + (s + 1) * rolls;
+			allinone_status[s] = scenario_ok ? 1 : -1;
+			JpmcdsFreeTCurve(scenario_curves[s]);
+		}
+
+		for (auto roll_trade : roll_trades) {
+			JpmcdsCdsTradeFree(roll_trade);
+		}
+		FREE(pointer_roll_dates_jpm);
+	}
+
+	vector <double> allinone_time;
+	allinone_time.push_back((clock() - start_s));
+	allinone.push_back(cube);
+	allinone.push_back(shape);
+	allinone.push_back(allinone_status);
+	allinone.push_back(allinone_time);
+
+	return allinone;
+};
+
+vector< vector<double> > cds_scenario_roll_grid(
+	string value_date,						/* (I) date to value the cds DD/MM/YYYY */
+	string effective_date,					/* (I) effective date of cds as DD/MM/YYYY */
+	string maturity_date,					/* (I) maturity date of cds as DD/MM/YYYY */
+	string accrual_start_date,				/* (I) accrual start date of cds as DD/MM/YYYY */
+	double recovery_rate,					/* (I) recover rate of the curve in basis points */
+	double coupon_rate,						/* (I) CouponRate (e.g. 100 = 1%) */
+	double notional,						/* (I) Notional MM */
+	int is_buy_protection,					/* (I) direction of credit risk */
+	int discount_curve_handle,				/* (I) handle from cds_discount_curve_handle */
+	vector<double> spread_rates,			/* (I) spread spreads */
+	vector<string> imm_dates,				/* (I) imm dates */
+	vector<string> spread_roll_tenors,		/* (I) spread roll tenors */
+	vector<double> scenario_tenors,			/* (I) spread tenors -100, -90, -80, -70 ... */
+	int number_of_threads,					/* (I) worker threads, 0 uses every core */
+	int verbose
+) {
+
+	vector<long int> tenors;
+	for (int r = 0; r < static_cast<int>(imm_dates.size()); r++) {
+		tenors.push_back(parse_string_ddmmyyyy_to_jpmcdsdate(imm_dates[r]));
+	}
+
+	return scenario_roll_grid(parse_string_ddmmyyyy_to_jpmcdsdate(value_date)
+		, parse_string_ddmmyyyy_to_jpmcdsdate(effective_date)
+		, parse_string_ddmmyyyy_to_jpmcdsdate(maturity_date)
+		, parse_string_ddmmyyyy_to_jpmcdsdate(accrual_start_date)
+		, recovery_rate
+		, coupon_rate
+		, notional
+		, is_buy_protection
+		, discount_curve_handle
+		, spread_rates
+		, tenors
+		, spread_roll_tenors
+		, scenario_tenors
+		, number_of_threads
+		, verbose);
+};
+
+vector< vector<double> > cds_scenario_roll_grid_tdate(
+	int value_date,							/* (I) date to value the cds as TDate */
+	int effective_date,						/* (I) effective date of cds as TDate */
+	int maturity_date,						/* (I) maturity date of cds as TDate */
+	int accrual_start_date,					/* (I) accrual start date of cds as TDate */
+	double recovery_rate,					/* (I) recover rate of the curve in basis points */
+	double coupon_rate,						/* (I) CouponRate (e.g. 100 = 1%) */
+	double notional,						/* (I) Notional MM */
+	int is_buy_protection,					/* (I) direction of credit risk */
+	int discount_curve_handle,				/* (I) handle from cds_discount_curve_handle */
+	vector<double> spread_rates,			/* (I) spread spreads */
+	vector<int> imm_dates,					/* (I) imm dates as TDate */
+	vector<string> spread_roll_tenors,		/* (I) spread roll tenors */
+	vector<double> scenario_tenors,			/* (I) spread tenors -100, -90, -80, -70 ... */
+	int number_of_threads,					/* (I) worker threads, 0 uses every core */
+	int verbose
+) {
+
+	return scenario_roll_grid(value_date
+		, effective_date
+		, maturity_date
+		, accrual_start_date
+		, recovery_rate
+		, coupon_rate
+		, notional
+		, is_buy_protection
+		, discount_curve_handle
+		, spread_rates
+		, to_jpmcdsdates(imm_dates)
+		, spread_roll_tenors
+		, scenario_tenors
+		, number_of_threads
+		, verbose);
+};
+
+int cds_release_curve_handle(
+	int curve_handle						/* (I) handle to release */
+) {
+	std::lock_guard<std::mutex> lock(curve_handles_mutex);
+	// spread curves keep their discount curve alive until they are released too
+	return curve_handles.erase(curve_handle) == 1 ? 1 : -1;
+};
+
+vector<int> cds_parse_dates(
+	vector<string> dates					/* (I) dates as DD/MM/YYYY */
+) {
+	vector<int> jpm_dates(dates.size());
+	for (int r = 0; r < static_cast<int>(dates.size()); r++) {
+		jpm_dates[r] = static_cast<int>(parse_string_ddmmyyyy_to_jpmcdsdate(dates[r]));
+	}
+	return jpm_dates;
+};
+
+vector<int> cds_yyyymmdd_to_dates(
+	vector<int> dates						/* (I) dates as YYYYMMDD */
+) {
+	vector<int> jpm_dates(dates.size());
+	for (int r = 0; r < static_cast<int>(dates.size()); r++) {
+		jpm_dates[r] = static_cast<int>(JpmcdsDate(dates[r] / 10000, dates[r] / 100 % 100, dates[r] % 100));
+	}
+	return jpm_dates;
+};
+
+vector<int> cds_dates_to_yyyymmdd(
+	vector<int> dates						/* (I) dates as TDate */
+) {
+	vector<int> yyyymmdd(dates.size());
+	for (int r = 0; r < static_cast<int>(dates.size()); r++) {
+		yyyymmdd[r] = jpmcdsdate_to_yyyymmdd(dates[r]);
+	}
+	return yyyymmdd;
+};
+
+int cds_register_holidays(
+	string holiday_name,					/* (I) name used in place of a holiday filename */
+	vector<int> holiday_dates,				/* (I) holidays as YYYYMMDD in increasing order */
+	int weekends,							/* (I) weekend days as JPMCDS_WEEKEND_ flags, 96 is Sat and Sun */
+	int verbose
+) {
+	// up to 16010101 is skipped as in holiday files, which need it when they hold no holidays
+	vector<long int> dates;
+	for (int r = 0; r < static_cast<int>(holiday_dates.size()); r++) {
+		if (holiday_dates[r] > 16010101) {
+			dates.push_back(JpmcdsDate(holiday_dates[r] / 10000, holiday_dates[r] / 100 % 100, holiday_dates[r] % 100));
+		}
+	}
+
+	if (JpmcdsHolidayLoadFromDates(const_cast<char*>(holiday_name.c_str())
+		, static_cast<int>(dates.size())
+		, dates.data()
+		, weekends) != SUCCESS) {
+		if (verbose) {
+			std::cout << "cds_register_holidays: could not register " << holiday_name << std::endl;
+		}
+		return -1;
+	}
+	return 1;
+};
+
+int cds_evict_holidays(
+	string holiday_name,					/* (I) registered name or holiday filename */
+	int verbose
+) {
+	if (JpmcdsHolidayEvictFromCache(const_cast<char*>(holiday_name.c_str())) != SUCCESS) {
+		if (verbose) {
+			std::cout << "cds_evict_holidays: could not evict " << holiday_name << std::endl;
+		}
+		return -1;
+	}
+	return 1;
+};
+
+int cds_holiday_cache_limit(
+	int max_file_calendars					/* (I) holiday files kept, 0 keeps all, < 0 only reads it */
+) {
+	return static_cast<int>(JpmcdsHolidaySetCacheLimit(max_file_calendars));
+};
+
 
 vector<double> average (vector< vector<double> > i_matrix) {
 
@@ -31,6 +31,29 @@ std::vector< double >  calculate_spread_from_upfront_charge (
  int verbose
  );
 
+/* calculate_spread_from_upfront_charge on TDate dates */
+std::vector< double >  calculate_spread_from_upfront_charge_tdate (
+ int trade_date,									/* (I) trade date of cds as TDate */
+ int maturity_date,									/* (I) maturity date of cds as TDate */
+ int accrual_start_date,							/* (I) accrual start date of cds as TDate */
+ int settle_date,                                   /* (I) settle date of cds as TDate */
+ double recovery_rate,					            /* (I) recover rate of the curve in basis points */
+ double coupon_rate,							    /* (I) CouponRate (e.g. 0.05 = 5% = 500bp) */
+ double notional,								    /* (I) Notional MM */
+ int is_buy_protection,							    /* (I) direction of credit risk */
+ std::vector<double> swap_rates, 				    /* (I) swap rates */
+ std::vector<std::string> swap_tenors,			    /* (I) swap tenors "1M", "2M" */
+ double upfront_charge,                             /* (I) upfront charge */
+ int is_rofr,							            /* (I) rofr rates or libor */
+ int is_upfront_clean,						/* (I) is_upfront_clean = 0 means dirty is_upfront_clean = 1 means clean  */
+ std::string holiday_filename,                      /* (I) YYMMDD holiday.dat filename */
+ std::string swap_floating_day_count_convention,    /* (I) swap_floating_payment_frequency ACT/360 */
+ std::string swap_fixed_day_count_convention,       /* (I) swap_fixed_day_count_convention 30/360*/
+ std::string swap_fixed_payment_frequency,          /* (I) swap_fixed_payment_frequency 1Y */
+ std::string swap_floating_payment_frequency,       /* (I) swap_floating_payment_frequency 1Y */
+ int verbose
+);
+
 
 std::vector< double >  compute_isda_upfront(
  std::string trade_date,						    /* (I) trade date of cds as DD/MM/YYYY */
@@ -53,6 +76,116 @@ std::vector< double >  compute_isda_upfront(
  int verbose
  );
 
+/* compute_isda_upfront on TDate dates */
+std::vector< double >  compute_isda_upfront_tdate(
+ int trade_date,									/* (I) trade date of cds as TDate */
+ int maturity_date,									/* (I) maturity date of cds as TDate */
+ int accrual_start_date,							/* (I) accrual start date of cds as TDate */
+ int settle_date,                                   /* (I) settle date of cds as TDate */
+ double recovery_rate,					            /* (I) recover rate of the curve in basis points */
+ double coupon_rate,							    /* (I) CouponRate (e.g. 0.05 = 5% = 500bp) */
+ double notional,								    /* (I) Notional MM */
+ int is_buy_protection,							    /* (I) direction of credit risk */
+ std::vector<double> swap_rates, 				    /* (I) swap rates */
+ std::vector<std::string> swap_tenors,			    /* (I) swap tenors "1M", "2M" */
+ double par_spread,                                 /* (I) par spread */
+ int is_rofr,							            /* (I) rofr rates or libor */
+ std::string holiday_filename,                      /* (I) YYMMDD holiday.dat filename */
+ std::string swap_floating_day_count_convention,    /* (I) swap_floating_payment_frequency ACT/360 */
+ std::string swap_fixed_day_count_convention,       /* (I) swap_fixed_day_count_convention 30/360*/
+ std::string swap_fixed_payment_frequency,          /* (I) swap_fixed_payment_frequency 1Y */
+ std::string swap_floating_payment_frequency,       /* (I) swap_floating_payment_frequency 1Y */
+ int verbose
+);
+
+/* upfront per unit notional per quote against one discount curve: dirty, clean, ai and status columns, then time */
+std::vector< std::vector<double> > compute_isda_upfront_vector(
+ std::string trade_date,						    /* (I) trade date of cds as DD/MM/YYYY */
+ std::string accrual_start_date,				    /* (I) accrual start date of cds as DD/MM/YYYY */
+ std::string settle_date,                           /* (I) settlement date T+3 business days*/
+ std::vector<std::string> maturity_dates,		    /* (I) maturity date per quote DD/MM/YYYY */
+ std::vector<double> coupon_rates,				    /* (I) CouponRate per quote (e.g. 100 = 1%) */
+ std::vector<double> recovery_rates,			    /* (I) recovery rate per quote */
+ std::vector<double> par_spreads,				    /* (I) par spread per quote */
+ std::vector<double> swap_rates, 				    /* (I) swap rates */
+ std::vector<std::string> swap_tenors,			    /* (I) swap tenors "1M", "2M" */
+ int is_rofr,							            /* (I) rofr rates or libor */
+ std::string holiday_filename,                      /* (I) YYMMDD holiday.dat filename */
+ std::string swap_floating_day_count_convention,    /* (I) swap_floating_payment_frequency ACT/360 */
+ std::string swap_fixed_day_count_convention,       /* (I) swap_fixed_day_count_convention 30/360*/
+ std::string swap_fixed_payment_frequency,          /* (I) swap_fixed_payment_frequency 1Y */
+ std::string swap_floating_payment_frequency,       /* (I) swap_floating_payment_frequency 1Y */
+ int number_of_threads,							    /* (I) worker threads, 0 uses every core */
+ int verbose
+ );
+
+/* compute_isda_upfront_vector on TDate dates */
+std::vector< std::vector<double> > compute_isda_upfront_vector_tdate(
+ int trade_date,									/* (I) trade date of cds as TDate */
+ int accrual_start_date,							/* (I) accrual start date of cds as TDate */
+ int settle_date,                                   /* (I) settlement date T+3 business days as TDate */
+ std::vector<int> maturity_dates,					/* (I) maturity date per quote as TDate */
+ std::vector<double> coupon_rates,				    /* (I) CouponRate per quote (e.g. 100 = 1%) */
+ std::vector<double> recovery_rates,			    /* (I) recovery rate per quote */
+ std::vector<double> par_spreads,				    /* (I) par spread per quote */
+ std::vector<double> swap_rates, 				    /* (I) swap rates */
+ std::vector<std::string> swap_tenors,			    /* (I) swap tenors "1M", "2M" */
+ int is_rofr,							            /* (I) rofr rates or libor */
+ std::string holiday_filename,                      /* (I) YYMMDD holiday.dat filename */
+ std::string swap_floating_day_count_convention,    /* (I) swap_floating_payment_frequency ACT/360 */
+ std::string swap_fixed_day_count_convention,       /* (I) swap_fixed_day_count_convention 30/360*/
+ std::string swap_fixed_payment_frequency,          /* (I) swap_fixed_payment_frequency 1Y */
+ std::string swap_floating_payment_frequency,       /* (I) swap_floating_payment_frequency 1Y */
+ int number_of_threads,							    /* (I) worker threads, 0 uses every core */
+ int verbose
+);
+
+/* spread per quote against one discount curve: spread and status columns, then time */
+std::vector< std::vector<double> > calculate_spread_from_upfront_charge_vector(
+ std::string trade_date,						    /* (I) trade date of cds as DD/MM/YYYY */
+ std::string accrual_start_date,				    /* (I) accrual start date of cds as DD/MM/YYYY */
+ std::string settle_date,                           /* (I) settlement date T+3 business days*/
+ std::vector<std::string> maturity_dates,		    /* (I) maturity date per quote DD/MM/YYYY */
+ std::vector<double> coupon_rates,				    /* (I) CouponRate per quote (e.g. 100 = 1%) */
+ std::vector<double> recovery_rates,			    /* (I) recovery rate per quote */
+ std::vector<double> upfront_charges,			    /* (I) upfront charge per quote */
+ std::vector<double> spread_guesses,			    /* (I) starting spread per quote as returned, empty starts from the coupons */
+ int is_upfront_clean,						        /* (I) is_upfront_clean = 0 means dirty is_upfront_clean = 1 means clean  */
+ std::vector<double> swap_rates, 				    /* (I) swap rates */
+ std::vector<std::string> swap_tenors,			    /* (I) swap tenors "1M", "2M" */
+ int is_rofr,							            /* (I) rofr rates or libor */
+ std::string holiday_filename,                      /* (I) YYMMDD holiday.dat filename */
+ std::string swap_floating_day_count_convention,    /* (I) swap_floating_payment_frequency ACT/360 */
+ std::string swap_fixed_day_count_convention,       /* (I) swap_fixed_day_count_convention 30/360*/
+ std::string swap_fixed_payment_frequency,          /* (I) swap_fixed_payment_frequency 1Y */
+ std::string swap_floating_payment_frequency,       /* (I) swap_floating_payment_frequency 1Y */
+ int number_of_threads,							    /* (I) worker threads, 0 uses every core */
+ int verbose
+ );
+
+/* calculate_spread_from_upfront_charge_vector on TDate dates */
+std::vector< std::vector<double> > calculate_spread_from_upfront_charge_vector_tdate(
+ int trade_date,									/* (I) trade date of cds as TDate */
+ int accrual_start_date,							/* (I) accrual start date of cds as TDate */
+ int settle_date,                                   /* (I) settlement date T+3 business days as TDate */
+ std::vector<int> maturity_dates,					/* (I) maturity date per quote as TDate */
+ std::vector<double> coupon_rates,				    /* (I) CouponRate per quote (e.g. 100 = 1%) */
+ std::vector<double> recovery_rates,			    /* (I) recovery rate per quote */
+ std::vector<double> upfront_charges,			    /* (I) upfront charge per quote */
+ std::vector<double> spread_guesses,			    /* (I) starting spread per quote as returned, empty starts from the coupons */
+ int is_upfront_clean,						        /* (I) is_upfront_clean = 0 means dirty is_upfront_clean = 1 means clean  */
+ std::vector<double> swap_rates, 				    /* (I) swap rates */
+ std::vector<std::string> swap_tenors,			    /* (I) swap tenors "1M", "2M" */
+ int is_rofr,							            /* (I) rofr rates or libor */
+ std::string holiday_filename,                      /* (I) YYMMDD holiday.dat filename */
+ std::string swap_floating_day_count_convention,    /* (I) swap_floating_payment_frequency ACT/360 */
+ std::string swap_fixed_day_count_convention,       /* (I) swap_fixed_day_count_convention 30/360*/
+ std::string swap_fixed_payment_frequency,          /* (I) swap_fixed_payment_frequency 1Y */
+ std::string swap_floating_payment_frequency,       /* (I) swap_floating_payment_frequency 1Y */
+ int number_of_threads,							    /* (I) worker threads, 0 uses every core */
+ int verbose
+);
+
 std::vector<double> average (std::vector< std::vector<double> > i_matrix);
 
 std::vector< double > cds_discount_rate_ir_tenor_dates(
@@ -63,6 +196,15 @@ std::vector< double > cds_discount_rate_ir_tenor_dates(
 	int verbose
 );
 
+/* cds_discount_rate_ir_tenor_dates on TDate dates */
+std::vector< double > cds_discount_rate_ir_tenor_dates_tdate(
+ int value_date,								/* (I) date to value the cds as TDate */
+ std::vector<int> value_dates,					/* (I) input forward dates as TDate */
+	std::vector<double> swap_rates, 			/* (I) swap rates */
+	std::vector<std::string> swap_tenors,		/* (I) swap tenors "1M", "2M" */
+	int verbose
+);
+
 std::vector< std::vector<double> > cds_coupon_schedule(
     std::string accrual_start_date, /* (I) maturity date of cds as DD/MM/YYYY */
     std::string maturity_date, /* (I) maturity date of cds as DD/MM/YYYY */
@@ -75,6 +217,19 @@ std::vector< std::vector<double> > cds_coupon_schedule(
     int verbose
 );
 
+/* cds_coupon_schedule on TDate dates, payment dates are returned as TDate */
+std::vector< std::vector<double> > cds_coupon_schedule_tdate(
+    int accrual_start_date, /* (I) accrual start date of cds as TDate */
+    int maturity_date, /* (I) maturity date of cds as TDate */
+    std::string coupon_interval, /* (I) coupon interval Q, 1M, 2M */
+    std::string day_count_convention, /* (I) day_count_convention Act/360 */
+    std::string stub_method, /* (I) stub_method F/S/20 */
+    std::string holiday_filename, /* (I) YYMMDD holiday.dat filename */
+    double coupon_rate, /* (I) coupon_rate 1.0 1% */
+    double notional, /* (I) notional 1.0 MM */
+    int verbose
+);
+
 std::vector< std::vector<double> > cds_index_all_in_one (
  std::string trade_date,						    /* (I) trade date of cds as DD/MM/YYYY */
  std::string effective_date,					    /* (I) effective date of cds as DD/MM/YYYY */
@@ -96,6 +251,74 @@ std::vector< std::vector<double> > cds_index_all_in_one (
  int verbose
 );
 
+/* cds_index_all_in_one on TDate dates */
+std::vector< std::vector<double> > cds_index_all_in_one_tdate (
+ int trade_date,									/* (I) trade date of cds as TDate */
+ int effective_date,								/* (I) effective date of cds as TDate */
+ int maturity_date,									/* (I) maturity date of cds as TDate */
+ int value_date,									/* (I) date to value the cds as TDate */
+ int accrual_start_date,							/* (I) accrual start date of cds as TDate */
+ std::vector<double> recovery_rate,					    /* (I) recover rate of the curve in basis points */
+ double coupon_rate,							    /* (I) CouponRate (e.g. 0.05 = 5% = 500bp) */
+ double notional,								    /* (I) Notional MM */
+ int is_buy_protection,							    /* (I) direction of credit risk */
+ std::vector<double> swap_rates, 				    /* (I) swap rates */
+ std::vector<std::string> swap_tenors,			    /* (I) swap tenors "1M", "2M" */
+ std::vector<int> swap_maturities,					/* (I) swap maturity dates as TDate */
+ std::vector< std::vector<double> > spread_rates,	/* (I) spread spreads */
+ std::vector<std::string> spread_tenors,		    /* (I) spread tenors "6M", "1Y" */
+ std::vector<std::string> spread_roll_tenors, 	    /* (I) spread roll tenors */
+ std::vector<int> imm_dates,						/* (I) imm dates as TDate */
+ std::vector<double> scenario_tenors,			    /* (I) spread tenors -100, -90, -80, -70 ... */
+ int verbose
+);
+
+/* cds_index_all_in_one with constituents priced across worker threads */
+std::vector< std::vector<double> > cds_index_all_in_one_parallel (
+ std::string trade_date,						    /* (I) trade date of cds as DD/MM/YYYY */
+ std::string effective_date,					    /* (I) effective date of cds as DD/MM/YYYY */
+ std::string maturity_date,						    /* (I) maturity date of cds as DD/MM/YYYY */
+ std::string value_date,						    /* (I) date to value the cds DD/MM/YYYY */
+ std::string accrual_start_date,				    /* (I) maturity date of cds as DD/MM/YYYY */
+ std::vector<double> recovery_rate,					    /* (I) recover rate of the curve in basis points */
+ double coupon_rate,							    /* (I) CouponRate (e.g. 0.05 = 5% = 500bp) */
+ double notional,								    /* (I) Notional MM */
+ int is_buy_protection,							    /* (I) direction of credit risk */
+ std::vector<double> swap_rates, 				    /* (I) swap rates */
+ std::vector<std::string> swap_tenors,			    /* (I) swap tenors "1M", "2M" */
+ std::vector<std::string> swap_maturities,		    /* (I) swap maturity dates */
+ std::vector< std::vector<double> > spread_rates,	/* (I) spread spreads */
+ std::vector<std::string> spread_tenors,		    /* (I) spread tenors "6M", "1Y" */
+ std::vector<std::string> spread_roll_tenors, 	    /* (I) spread roll tenors */
+ std::vector<std::string> imm_dates,			    /* (I) imm dates */
+ std::vector<double> scenario_tenors,			    /* (I) spread tenors -100, -90, -80, -70 ... */
+ int number_of_threads,							    /* (I) worker threads, 0 uses every core */
+ int verbose
+);
+
+/* cds_index_all_in_one_parallel on TDate dates */
+std::vector< std::vector<double> > cds_index_all_in_one_parallel_tdate (
+ int trade_date,									/* (I) trade date of cds as TDate */
+ int effective_date,								/* (I) effective date of cds as TDate */
+ int maturity_date,									/* (I) maturity date of cds as TDate */
+ int value_date,									/* (I) date to value the cds as TDate */
+ int accrual_start_date,							/* (I) accrual start date of cds as TDate */
+ std::vector<double> recovery_rate,					    /* (I) recover rate of the curve in basis points */
+ double coupon_rate,							    /* (I) CouponRate (e.g. 0.05 = 5% = 500bp) */
+ double notional,								    /* (I) Notional MM */
+ int is_buy_protection,							    /* (I) direction of credit risk */
+ std::vector<double> swap_rates, 				    /* (I) swap rates */
+ std::vector<std::string> swap_tenors,			    /* (I) swap tenors "1M", "2M" */
+ std::vector<int> swap_maturities,					/* (I) swap maturity dates as TDate */
+ std::vector< std::vector<double> > spread_rates,	/* (I) spread spreads */
+ std::vector<std::string> spread_tenors,		    /* (I) spread tenors "6M", "1Y" */
+ std::vector<std::string> spread_roll_tenors, 	    /* (I) spread roll tenors */
+ std::vector<int> imm_dates,						/* (I) imm dates as TDate */
+ std::vector<double> scenario_tenors,			    /* (I) spread tenors -100, -90, -80, -70 ... */
+ int number_of_threads,							    /* (I) worker threads, 0 uses every core */
+ int verbose
+);
+
 std::vector< std::vector<double> > cds_all_in_one (
  std::string trade_date,						/* (I) trade date of cds as DD/MM/YYYY */
  std::string effective_date,					/* (I) effective date of cds as DD/MM/YYYY */
@@ -117,6 +340,28 @@ std::vector< std::vector<double> > cds_all_in_one (
  int verbose
 );
 
+/* cds_all_in_one on TDate dates, as returned by cds_parse_dates */
+std::vector< std::vector<double> > cds_all_in_one_tdate (
+ int trade_date,								/* (I) trade date of cds as TDate */
+ int effective_date,							/* (I) effective date of cds as TDate */
+ int maturity_date,								/* (I) maturity date of cds as TDate */
+ int value_date,								/* (I) date to value the cds as TDate */
+ int accrual_start_date,						/* (I) accrual start date of cds as TDate */
+ double	recovery_rate,							/* (I) recover rate of the curve in basis points */
+ double coupon_rate,							/* (I) CouponRate (e.g. 0.05 = 5% = 500bp) */
+ double notional,								/* (I) Notional MM */
+ int is_buy_protection,							/* (I) direction of credit risk */
+ std::vector<double> swap_rates, 				/* (I) swap rates */
+ std::vector<std::string> swap_tenors,			/* (I) swap tenors "1M", "2M" */
+ std::vector<int> swap_maturities,				/* (I) swap maturity dates as TDate */
+ std::vector<double> spread_rates,				/* (I) spread spreads */
+ std::vector<std::string> spread_tenors,		/* (I) spread tenors "6M", "1Y" */
+ std::vector<std::string> spread_roll_tenors, 	/* (I) spread roll tenors */
+ std::vector<int> imm_dates,					/* (I) imm dates as TDate */
+ std::vector<double> scenario_tenors,			/* (I) spread tenors -100, -90, -80, -70 ... */
+ int verbose
+);
+
 
 std::vector< std::vector<double> > cds_all_in_one_exclude_ir_tenor_dates (
  std::string trade_date,						/* (I) trade date of cds as DD/MM/YYYY */
@@ -138,6 +383,256 @@ std::vector< std::vector<double> > cds_all_in_one_exclude_ir_tenor_dates (
  int verbose
 );
 
+/* cds_all_in_one_exclude_ir_tenor_dates on TDate dates */
+std::vector< std::vector<double> > cds_all_in_one_exclude_ir_tenor_dates_tdate (
+ int trade_date,								/* (I) trade date of cds as TDate */
+ int effective_date,							/* (I) effective date of cds as TDate */
+ int maturity_date,								/* (I) maturity date of cds as TDate */
+ int value_date,								/* (I) date to value the cds as TDate */
+ int accrual_start_date,						/* (I) accrual start date of cds as TDate */
+ double	recovery_rate,							/* (I) recover rate of the curve in basis points */
+ double coupon_rate,							/*(I) CouponRate (e.g. 0.05 = 5% = 500bp) */
+ double notional,								/* (I) Notional MM */
+ int is_buy_protection,							/* (I) direction of credit risk */
+ std::vector<double> swap_rates, 				/* (I) swap rates */
+ std::vector<std::string> swap_tenors,			/* (I) swap tenors "1M", "2M" */
+ std::vector<double> spread_rates,				/* (I) spread spreads */
+ std::vector<std::string> spread_tenors,		/* (I) spread tenors "6M", "1Y" */
+ std::vector<std::string> spread_roll_tenors, 	/* (I) spread roll tenors */
+ std::vector<int> imm_dates,					/* (I) imm dates as TDate */
+ std::vector<double> scenario_tenors,			/* (I) spread tenors -100, -90, -80, -70 ... */ 
+ int verbose
+);
+
+/* build base and +1bp discount curves once, returns a handle or -1 */
+int cds_discount_curve_handle (
+ std::string value_date,						/* (I) date to value the cds DD/MM/YYYY */
+ std::vector<double> swap_rates, 				/* (I) swap rates */
+ std::vector<std::string> swap_tenors,			/* (I) swap tenors "1M", "2M" */
+ std::vector<std::string> swap_maturities,		/* (I) swap maturity dates */
+ int verbose
+);
+
+/* cds_discount_curve_handle on TDate dates */
+int cds_discount_curve_handle_tdate (
+ int value_date,								/* (I) date to value the cds as TDate */
+ std::vector<double> swap_rates, 				/* (I) swap rates */
+ std::vector<std::string> swap_tenors,			/* (I) swap tenors "1M", "2M" */
+ std::vector<int> swap_maturities,				/* (I) swap maturity dates as TDate */
+ int verbose
+);
+
+/* build base, cs01 and dv01 spread curves once, returns a handle or -1 */
+int cds_spread_curve_handle (
+ std::string value_date,						/* (I) date to value the cds DD/MM/YYYY */
+ std::string effective_date,					/* (I) effective date of cds as DD/MM/YYYY */
+ double	recovery_rate,							/* (I) recover rate of the curve in basis points */
+ int discount_curve_handle,						/* (I) handle from cds_discount_curve_handle */
+ std::vector<double> spread_rates,				/* (I) spread spreads */
+ std::vector<std::string> imm_dates,			/* (I) imm dates */
+ int verbose
+);
+
+/* cds_spread_curve_handle on TDate dates */
+int cds_spread_curve_handle_tdate (
+ int value_date,								/* (I) date to value the cds as TDate */
+ int effective_date,							/* (I) effective date of cds as TDate */
+ double	recovery_rate,							/* (I) recover rate of the curve in basis points */
+ int discount_curve_handle,						/* (I) handle from cds_discount_curve_handle */
+ std::vector<double> spread_rates,				/* (I) spread spreads */
+ std::vector<int> imm_dates,					/* (I) imm dates as TDate */
+ int verbose
+);
+
+/* price against a spread curve handle: dirty, clean, ai, cs01, dv01, status, time */
+std::vector< double > cds_price_curve_handle (
+ std::string maturity_date,						/* (I) maturity date of cds as DD/MM/YYYY */
+ std::string accrual_start_date,				/* (I) accrual start date of cds as DD/MM/YYYY */
+ double coupon_rate,							/* (I) CouponRate (e.g. 0.05 = 5% = 500bp) */
+ double notional,								/* (I) Notional MM */
+ int is_buy_protection,							/* (I) direction of credit risk */
+ int spread_curve_handle,						/* (I) handle from cds_spread_curve_handle */
+ int verbose
+);
+
+/* cds_price_curve_handle on TDate dates */
+std::vector< double > cds_price_curve_handle_tdate (
+ int maturity_date,								/* (I) maturity date of cds as TDate */
+ int accrual_start_date,						/* (I) accrual start date of cds as TDate */
+ double coupon_rate,							/* (I) CouponRate (e.g. 0.05 = 5% = 500bp) */
+ double notional,								/* (I) Notional MM */
+ int is_buy_protection,							/* (I) direction of credit risk */
+ int spread_curve_handle,						/* (I) handle from cds_spread_curve_handle */
+ int verbose
+);
+
+/* price a book in one call: dirty, clean, ai, cs01, dv01 and status columns, then time */
+std::vector< std::vector<double> > cds_portfolio_price (
+ std::vector<std::string> maturity_dates,		/* (I) maturity date per trade DD/MM/YYYY */
+ std::vector<std::string> accrual_start_dates,	/* (I) accrual start date per trade DD/MM/YYYY */
+ std::vector<double> coupon_rates,				/* (I) CouponRate per trade (e.g. 100 = 1%) */
+ std::vector<double> notionals,					/* (I) Notional MM per trade */
+ std::vector<int> is_buy_protection,			/* (I) direction of credit risk per trade */
+ std::vector<int> curve_indices,				/* (I) index into spread_curve_handles per trade */
+ std::vector<int> spread_curve_handles,			/* (I) handles from cds_spread_curve_handle */
+ int verbose
+);
+
+/* cds_portfolio_price on TDate dates */
+std::vector< std::vector<double> > cds_portfolio_price_tdate (
+ std::vector<int> maturity_dates,				/* (I) maturity date per trade as TDate */
+ std::vector<int> accrual_start_dates,			/* (I) accrual start date per trade as TDate */
+ std::vector<double> coupon_rates,				/* (I) CouponRate per trade (e.g. 100 = 1%) */
+ std::vector<double> notionals,					/* (I) Notional MM per trade */
+ std::vector<int> is_buy_protection,			/* (I) direction of credit risk per trade */
+ std::vector<int> curve_indices,				/* (I) index into spread_curve_handles per trade */
+ std::vector<int> spread_curve_handles,			/* (I) handles from cds_spread_curve_handle */
+ int verbose
+);
+
+/* dv01 per swap tenor, one row per trade then status and time rows; key rate curves are built once per handle */
+std::vector< std::vector<double> > cds_bucketed_dv01 (
+ std::vector<std::string> maturity_dates,		/* (I) maturity date per trade DD/MM/YYYY */
+ std::vector<std::string> accrual_start_dates,	/* (I) accrual start date per trade DD/MM/YYYY */
+ std::vector<double> coupon_rates,				/* (I) CouponRate per trade (e.g. 100 = 1%) */
+ std::vector<double> notionals,					/* (I) Notional MM per trade */
+ std::vector<int> is_buy_protection,			/* (I) direction of credit risk per trade */
+ int spread_curve_handle,						/* (I) handle from cds_spread_curve_handle */
+ int verbose
+);
+
+/* cds_bucketed_dv01 on TDate dates */
+std::vector< std::vector<double> > cds_bucketed_dv01_tdate (
+ std::vector<int> maturity_dates,				/* (I) maturity date per trade as TDate */
+ std::vector<int> accrual_start_dates,			/* (I) accrual start date per trade as TDate */
+ std::vector<double> coupon_rates,				/* (I) CouponRate per trade (e.g. 100 = 1%) */
+ std::vector<double> notionals,					/* (I) Notional MM per trade */
+ std::vector<int> is_buy_protection,			/* (I) direction of credit risk per trade */
+ int spread_curve_handle,						/* (I) handle from cds_spread_curve_handle */
+ int verbose
+);
+
+/* cs01 per spread pillar then dv01 per discount curve zero rate, one row per trade then status and time rows; from one reverse sweep per trade */
+std::vector< std::vector<double> > cds_adjoint_risk (
+ std::vector<std::string> maturity_dates,		/* (I) maturity date per trade DD/MM/YYYY */
+ std::vector<std::string> accrual_start_dates,	/* (I) accrual start date per trade DD/MM/YYYY */
+ std::vector<double> coupon_rates,				/* (I) CouponRate per trade (e.g. 100 = 1%) */
+ std::vector<double> notionals,					/* (I) Notional MM per trade */
+ std::vector<int> is_buy_protection,			/* (I) direction of credit risk per trade */
+ int spread_curve_handle,						/* (I) handle from cds_spread_curve_handle */
+ int verbose
+);
+
+/* cds_adjoint_risk on TDate dates */
+std::vector< std::vector<double> > cds_adjoint_risk_tdate (
+ std::vector<int> maturity_dates,				/* (I) maturity date per trade as TDate */
+ std::vector<int> accrual_start_dates,			/* (I) accrual start date per trade as TDate */
+ std::vector<double> coupon_rates,				/* (I) CouponRate per trade (e.g. 100 = 1%) */
+ std::vector<double> notionals,					/* (I) Notional MM per trade */
+ std::vector<int> is_buy_protection,			/* (I) direction of credit risk per trade */
+ int spread_curve_handle,						/* (I) handle from cds_spread_curve_handle */
+ int verbose
+);
+
+/* cs01 per spread pillar, one row per trade then status and time rows; bumped curves restart the bootstrap at their pillar and are built once per handle */
+std::vector< std::vector<double> > cds_bucketed_cs01 (
+ std::vector<std::string> maturity_dates,		/* (I) maturity date per trade DD/MM/YYYY */
+ std::vector<std::string> accrual_start_dates,	/* (I) accrual start date per trade DD/MM/YYYY */
+ std::vector<double> coupon_rates,				/* (I) CouponRate per trade (e.g. 100 = 1%) */
+ std::vector<double> notionals,					/* (I) Notional MM per trade */
+ std::vector<int> is_buy_protection,			/* (I) direction of credit risk per trade */
+ int spread_curve_handle,						/* (I) handle from cds_spread_curve_handle */
+ int verbose
+);
+
+/* cds_bucketed_cs01 on TDate dates */
+std::vector< std::vector<double> > cds_bucketed_cs01_tdate (
+ std::vector<int> maturity_dates,				/* (I) maturity date per trade as TDate */
+ std::vector<int> accrual_start_dates,			/* (I) accrual start date per trade as TDate */
+ std::vector<double> coupon_rates,				/* (I) CouponRate per trade (e.g. 100 = 1%) */
+ std::vector<double> notionals,					/* (I) Notional MM per trade */
+ std::vector<int> is_buy_protection,			/* (I) direction of credit risk per trade */
+ int spread_curve_handle,						/* (I) handle from cds_spread_curve_handle */
+ int verbose
+);
+
+/* dirty and clean pv per (scenario, roll date) as one dense row indexed (s * rolls + r) * 2 + k, then its shape, status per scenario and time rows */
+std::vector< std::vector<double> > cds_scenario_roll_grid (
+ std::string value_date,						/* (I) date to value the cds DD/MM/YYYY */
+ std::string effective_date,					/* (I) effective date of cds as DD/MM/YYYY */
+ std::string maturity_date,						/* (I) maturity date of cds as DD/MM/YYYY */
+ std::string accrual_start_date,				/* (I) accrual start date of cds as DD/MM/YYYY */
+ double	recovery_rate,							/* (I) recover rate of the curve in basis points */
+ double coupon_rate,							/* (I) CouponRate (e.g. 100 = 1%) */
+ double notional,								/* (I) Notional MM */
+ int is_buy_protection,							/* (I) direction of credit risk */
+ int discount_curve_handle,						/* (I) handle from cds_discount_curve_handle */
+ std::vector<double> spread_rates,				/* (I) spread spreads */
+ std::vector<std::string> imm_dates,			/* (I) imm dates */
+ std::vector<std::string> spread_roll_tenors,	/* (I) spread roll tenors */
+ std::vector<double> scenario_tenors,			/* (I) spread tenors -100, -90, -80, -70 ... */
+ int number_of_threads,							/* (I) worker threads, 0 uses every core */
+ int verbose
+);
+
+/* cds_scenario_roll_grid on TDate dates */
+std::vector< std::vector<double> > cds_scenario_roll_grid_tdate (
+ int value_date,								/* (I) date to value the cds as TDate */
+ int effective_date,							/* (I) effective date of cds as TDate */
+ int maturity_date,								/* (I) maturity date of cds as TDate */
+ int accrual_start_date,						/* (I) accrual start date of cds as TDate */
+ double	recovery_rate,							/* (I) recover rate of the curve in basis points */
+ double coupon_rate,							/* (I) CouponRate (e.g. 100 = 1%) */
+ double notional,								/* (I) Notional MM */
+ int is_buy_protection,							/* (I) direction of credit risk */
+ int discount_curve_handle,						/* (I) handle from cds_discount_curve_handle */
+ std::vector<double> spread_rates,				/* (I) spread spreads */
+ std::vector<int> imm_dates,					/* (I) imm dates as TDate */
+ std::vector<std::string> spread_roll_tenors,	/* (I) spread roll tenors */
+ std::vector<double> scenario_tenors,			/* (I) spread tenors -100, -90, -80, -70 ... */
+ int number_of_threads,							/* (I) worker threads, 0 uses every core */
+ int verbose
+);
+
+/* release a curve handle, returns 1 or -1 if the handle is unknown */
+int cds_release_curve_handle (
+ int curve_handle								/* (I) handle to release */
+);
+
+/* parse DD/MM/YYYY strings to TDate without sscanf, -1 where a date is invalid */
+std::vector<int> cds_parse_dates (
+ std::vector<std::string> dates					/* (I) dates as DD/MM/YYYY */
+);
+
+/* convert YYYYMMDD integers to TDate, -1 where a date is invalid */
+std::vector<int> cds_yyyymmdd_to_dates (
+ std::vector<int> dates							/* (I) dates as YYYYMMDD */
+);
+
+/* convert TDate to YYYYMMDD integers, -1 where a date is invalid */
+std::vector<int> cds_dates_to_yyyymmdd (
+ std::vector<int> dates							/* (I) dates as TDate */
+);
+
+/* register holidays in memory under a name usable wherever a holiday filename is taken, returns 1 or -1 */
+int cds_register_holidays (
+ std::string holiday_name,						/* (I) name used in place of a holiday filename */
+ std::vector<int> holiday_dates,				/* (I) holidays as YYYYMMDD in increasing order */
+ int weekends,									/* (I) weekend days as JPMCDS_WEEKEND_ flags, 96 is Sat and Sun */
+ int verbose
+);
+
+/* evict a registered or file loaded calendar from the holiday cache, returns 1 or -1 if it is not cached */
+int cds_evict_holidays (
+ std::string holiday_name,						/* (I) registered name or holiday filename */
+ int verbose
+);
+
+/* bound the holiday files kept in the cache, 0 keeps all; returns the previous bound, max_file_calendars < 0 only reads it */
+int cds_holiday_cache_limit (
+ int max_file_calendars							/* (I) holiday files kept, 0 keeps all, < 0 only reads it */
+);
+
 #endif
 
 class Callback{
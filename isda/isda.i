@@ -1,4 +1,4 @@
-%module isda
+%module(threads="1") isda
 %{
 
  #include "isda.h"
@@ -11,6 +11,9 @@
 %include "std_vector.i"
 %include "std_string.i"
 
+/* the containers convert python objects, they keep the GIL */
+%nothread;
+
 namespace std {
   /* On a side note, the names VecDouble and VecVecdouble can be changed, but the order of first the inner vector matters !*/
   %template(VecDouble) vector<double>;
@@ -23,6 +26,249 @@ namespace std {
   %template(VecVecString) vector< vector<string> >;
 }
 
+%{
+/*
+ * numpy arrays, array.array and any other C contiguous buffer of doubles or
+ * integers convert to std::vector with one copy from the buffer instead of
+ * one Python object per element; 2-d buffers convert to vectors of rows.
+ * Other sequences keep the element by element conversion.
+ *
+ * cds_buffered(function, *args) calls function(*args) with its vector results
+ * returned as array.array (or tuples of them for matrices). Each result is
+ * copied once from the std::vector into its array, which numpy.frombuffer
+ * then wraps without another copy. Other calls and threads keep tuples.
+ */
+static thread_local bool isda_buffer_results = false;
+
+namespace swig {
+
+  /* true if obj exposes a C contiguous buffer, which is then held in view */
+  SWIGINTERN bool isda_buffer_get(PyObject *obj, Py_buffer *view) {
+    if (!PyObject_CheckBuffer(obj)) {
+      return false;
+    }
+    if (PyObject_GetBuffer(obj, view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) != 0) {
+      PyErr_Clear();
+      return false;
+    }
+    return true;
+  }
+
+  /* the struct format character of a native buffer item, 0 if not native */
+  SWIGINTERN char isda_buffer_code(const Py_buffer& view) {
+    const char *format = view.format ? view.format : "B";
+    if (format[0] == '@' || format[0] == '=') {
+      format++;
+    }
+    return format[1] == '\0' ? format[0] : 0;
+  }
+
+  template <class T>
+  inline bool isda_buffer_item_ok(char code, Py_ssize_t itemsize);
+
+  SWIGINTERN bool isda_buffer_integer(char code, Py_ssize_t itemsize) {
+    return (code == 'i' || code == 'l' || code == 'q')
+      && (itemsize == sizeof(int) || itemsize == sizeof(long long));
+  }
+
+  template <>
+  inline bool isda_buffer_item_ok<double>(char code, Py_ssize_t itemsize) {
+    return (code == 'd' && itemsize == sizeof(double)) || (code == 'f' && itemsize == sizeof(float))
+      || isda_buffer_integer(code, itemsize);
+  }
+
+  template <>
+  inline bool isda_buffer_item_ok<int>(char code, Py_ssize_t itemsize) {
+    return isda_buffer_integer(code, itemsize);
+  }
+
+  SWIGINTERN bool isda_buffer_floating(char code) {
+    return code == 'd' || code == 'f';
+  }
+
+  template <class T>
+  inline bool isda_buffer_floating() {
+    return static_cast<T>(0.5) != 0;
+  }
+
+  /* copy count items of the buffer starting at item offset into out */
+  template <class T>
+  inline void isda_buffer_copy(const Py_buffer& view, Py_ssize_t offset, Py_ssize_t count, T *out) {
+    const char *p = static_cast<const char*>(view.buf) + offset * view.itemsize;
+    char code = isda_buffer_code(view);
+    if (view.itemsize == sizeof(T) && isda_buffer_floating(code) == isda_buffer_floating<T>()) {
+      if (count > 0) {
+        memcpy(out, p, count * sizeof(T));
+      }
+    } else if (code == 'f') {
+      for (Py_ssize_t i = 0; i < count; i++) {
+        out[i] = static_cast<T>(reinterpret_cast<const float*>(p)[i]);
+      }
+    } else if (view.itemsize == sizeof(long long)) {
+      for (Py_ssize_t i = 0; i < count; i++) {
+        out[i] = static_cast<T>(reinterpret_cast<const long long*>(p)[i]);
+      }
+    } else {
+      for (Py_ssize_t i = 0; i < count; i++) {
+        out[i] = static_cast<T>(reinterpret_cast<const int*>(p)[i]);
+      }
+    }
+  }
+
+  /* converts a 1-d buffer, returns 0 to fall back to the sequence conversion */
+  template <class T>
+  inline int isda_buffer_asptr(PyObject *obj, std::vector<T> **vec) {
+    Py_buffer view;
+    int res = 0;
+    if (!isda_buffer_get(obj, &view)) {
+      return 0;
+    }
+    if (view.ndim == 1 && isda_buffer_item_ok<T>(isda_buffer_code(view), view.itemsize)) {
+      if (vec) {
+        *vec = new std::vector<T>(view.shape[0]);
+        isda_buffer_copy(view, 0, view.shape[0], (*vec)->data());
+        res = SWIG_NEWOBJ;
+      } else {
+        res = SWIG_OK;
+      }
+    }
+    PyBuffer_Release(&view);
+    return res;
+  }
+
+  /* converts a 2-d buffer by rows, returns 0 to fall back to the sequence conversion */
+  template <class T>
+  inline int isda_buffer_asptr(PyObject *obj, std::vector< std::vector<T> > **vec) {
+    Py_buffer view;
+    int res = 0;
+    if (!isda_buffer_get(obj, &view)) {
+      return 0;
+    }
+    if (view.ndim == 2 && isda_buffer_item_ok<T>(isda_buffer_code(view), view.itemsize)) {
+      if (vec) {
+        Py_ssize_t rows = view.shape[0];
+        Py_ssize_t cols = view.shape[1];
+        *vec = new std::vector< std::vector<T> >(rows, std::vector<T>(cols));
+        for (Py_ssize_t r = 0; r < rows; r++) {
+          isda_buffer_copy(view, r * cols, cols, (**vec)[r].data());
+        }
+        res = SWIG_NEWOBJ;
+      } else {
+        res = SWIG_OK;
+      }
+    }
+    PyBuffer_Release(&view);
+    return res;
+  }
+
+  /* an array.array of the given type code filled from the data in one copy */
+  SWIGINTERN PyObject *isda_buffer_from(const char *typecode, const void *data, Py_ssize_t nbytes) {
+    static PyObject *array_type = 0;
+    if (!array_type) {
+      PyObject *module = PyImport_ImportModule("array");
+      if (!module) {
+        return NULL;
+      }
+      array_type = PyObject_GetAttrString(module, "array");
+      Py_DECREF(module);
+      if (!array_type) {
+        return NULL;
+      }
+    }
+    PyObject *array = PyObject_CallFunction(array_type, "s", typecode);
+    if (!array || nbytes == 0) {
+      return array;
+    }
+    /* frombytes copies straight from a view of the vector */
+    PyObject *view = PyMemoryView_FromMemory(static_cast<char*>(const_cast<void*>(data)), nbytes, PyBUF_READ);
+    PyObject *res = view ? PyObject_CallMethod(array, "frombytes", "O", view) : NULL;
+    Py_XDECREF(view);
+    if (!res) {
+      Py_DECREF(array);
+      return NULL;
+    }
+    Py_DECREF(res);
+    return array;
+  }
+
+  template <>
+  struct traits_asptr<std::vector<double> > {
+    static int asptr(PyObject *obj, std::vector<double> **vec) {
+      int res = isda_buffer_asptr(obj, vec);
+      return res ? res : traits_asptr_stdseq<std::vector<double> >::asptr(obj, vec);
+    }
+  };
+
+  template <>
+  struct traits_asptr<std::vector<int> > {
+    static int asptr(PyObject *obj, std::vector<int> **vec) {
+      int res = isda_buffer_asptr(obj, vec);
+      return res ? res : traits_asptr_stdseq<std::vector<int> >::asptr(obj, vec);
+    }
+  };
+
+  template <>
+  struct traits_asptr<std::vector< std::vector<double> > > {
+    static int asptr(PyObject *obj, std::vector< std::vector<double> > **vec) {
+      int res = isda_buffer_asptr(obj, vec);
+      return res ? res : traits_asptr_stdseq<std::vector< std::vector<double> > >::asptr(obj, vec);
+    }
+  };
+
+  template <>
+  struct traits_asptr<std::vector< std::vector<int> > > {
+    static int asptr(PyObject *obj, std::vector< std::vector<int> > **vec) {
+      int res = isda_buffer_asptr(obj, vec);
+      return res ? res : traits_asptr_stdseq<std::vector< std::vector<int> > >::asptr(obj, vec);
+    }
+  };
+
+  template <>
+  struct traits_from<std::vector<double> > {
+    static PyObject *from(const std::vector<double>& vec) {
+      if (isda_buffer_results) {
+        return isda_buffer_from("d", vec.data(), vec.size() * sizeof(double));
+      }
+      return traits_from_stdseq<std::vector<double> >::from(vec);
+    }
+  };
+
+  template <>
+  struct traits_from<std::vector<int> > {
+    static PyObject *from(const std::vector<int>& vec) {
+      if (isda_buffer_results) {
+        return isda_buffer_from("i", vec.data(), vec.size() * sizeof(int));
+      }
+      return traits_from_stdseq<std::vector<int> >::from(vec);
+    }
+  };
+}
+
+/* cds_buffered(function, *args), the flag only covers this call on this thread */
+SWIGINTERN PyObject *isda_buffered(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  Py_ssize_t n = PyTuple_Size(args);
+  if (n < 1 || !PyCallable_Check(PyTuple_GET_ITEM(args, 0))) {
+    PyErr_SetString(PyExc_TypeError, "cds_buffered takes a function followed by its arguments");
+    return NULL;
+  }
+  PyObject *call_args = PyTuple_GetSlice(args, 1, n);
+  if (!call_args) {
+    return NULL;
+  }
+  bool previous = isda_buffer_results;
+  isda_buffer_results = true;
+  PyObject *result = PyObject_Call(PyTuple_GET_ITEM(args, 0), call_args, NULL);
+  isda_buffer_results = previous;
+  Py_DECREF(call_args);
+  return result;
+}
+%}
+
+%native(cds_buffered) PyObject *isda_buffered(PyObject *self, PyObject *args);
+
+/* every other call releases the GIL while the C++ code runs */
+%thread;
+
 /* turn on director wrapping Callback */
 %feature("director") Callback;
 
@@ -774,30 +774,140 @@ class VecVecString(object):
 # Register VecVecString in _isda:
 _isda.VecVecString_swigregister(VecVecString)
 
+cds_buffered = _isda.cds_buffered
 
 def calculate_spread_from_upfront_charge(trade_date, maturity_date, accrual_start_date, settle_date, recovery_rate, coupon_rate, notional, is_buy_protection, swap_rates, swap_tenors, upfront_charge, is_rofr, is_upfront_clean, holiday_filename, swap_floating_day_count_convention, swap_fixed_day_count_convention, swap_fixed_payment_frequency, swap_floating_payment_frequency, verbose):
     return _isda.calculate_spread_from_upfront_charge(trade_date, maturity_date, accrual_start_date, settle_date, recovery_rate, coupon_rate, notional, is_buy_protection, swap_rates, swap_tenors, upfront_charge, is_rofr, is_upfront_clean, holiday_filename, swap_floating_day_count_convention, swap_fixed_day_count_convention, swap_fixed_payment_frequency, swap_floating_payment_frequency, verbose)
 
+def calculate_spread_from_upfront_charge_tdate(trade_date, maturity_date, accrual_start_date, settle_date, recovery_rate, coupon_rate, notional, is_buy_protection, swap_rates, swap_tenors, upfront_charge, is_rofr, is_upfront_clean, holiday_filename, swap_floating_day_count_convention, swap_fixed_day_count_convention, swap_fixed_payment_frequency, swap_floating_payment_frequency, verbose):
+    return _isda.calculate_spread_from_upfront_charge_tdate(trade_date, maturity_date, accrual_start_date, settle_date, recovery_rate, coupon_rate, notional, is_buy_protection, swap_rates, swap_tenors, upfront_charge, is_rofr, is_upfront_clean, holiday_filename, swap_floating_day_count_convention, swap_fixed_day_count_convention, swap_fixed_payment_frequency, swap_floating_payment_frequency, verbose)
+
 def compute_isda_upfront(trade_date, maturity_date, accrual_start_date, settle_date, recovery_rate, coupon_rate, notional, is_buy_protection, swap_rates, swap_tenors, par_spread, is_rofr, holiday_filename, swap_floating_day_count_convention, swap_fixed_day_count_convention, swap_fixed_payment_frequency, swap_floating_payment_frequency, verbose):
     return _isda.compute_isda_upfront(trade_date, maturity_date, accrual_start_date, settle_date, recovery_rate, coupon_rate, notional, is_buy_protection, swap_rates, swap_tenors, par_spread, is_rofr, holiday_filename, swap_floating_day_count_convention, swap_fixed_day_count_convention, swap_fixed_payment_frequency, swap_floating_payment_frequency, verbose)
 
+def compute_isda_upfront_tdate(trade_date, maturity_date, accrual_start_date, settle_date, recovery_rate, coupon_rate, notional, is_buy_protection, swap_rates, swap_tenors, par_spread, is_rofr, holiday_filename, swap_floating_day_count_convention, swap_fixed_day_count_convention, swap_fixed_payment_frequency, swap_floating_payment_frequency, verbose):
+    return _isda.compute_isda_upfront_tdate(trade_date, maturity_date, accrual_start_date, settle_date, recovery_rate, coupon_rate, notional, is_buy_protection, swap_rates, swap_tenors, par_spread, is_rofr, holiday_filename, swap_floating_day_count_convention, swap_fixed_day_count_convention, swap_fixed_payment_frequency, swap_floating_payment_frequency, verbose)
+
+def compute_isda_upfront_vector(trade_date, accrual_start_date, settle_date, maturity_dates, coupon_rates, recovery_rates, par_spreads, swap_rates, swap_tenors, is_rofr, holiday_filename, swap_floating_day_count_convention, swap_fixed_day_count_convention, swap_fixed_payment_frequency, swap_floating_payment_frequency, number_of_threads, verbose):
+    return _isda.compute_isda_upfront_vector(trade_date, accrual_start_date, settle_date, maturity_dates, coupon_rates, recovery_rates, par_spreads, swap_rates, swap_tenors, is_rofr, holiday_filename, swap_floating_day_count_convention, swap_fixed_day_count_convention, swap_fixed_payment_frequency, swap_floating_payment_frequency, number_of_threads, verbose)
+
+def compute_isda_upfront_vector_tdate(trade_date, accrual_start_date, settle_date, maturity_dates, coupon_rates, recovery_rates, par_spreads, swap_rates, swap_tenors, is_rofr, holiday_filename, swap_floating_day_count_convention, swap_fixed_day_count_convention, swap_fixed_payment_frequency, swap_floating_payment_frequency, number_of_threads, verbose):
+    return _isda.compute_isda_upfront_vector_tdate(trade_date, accrual_start_date, settle_date, maturity_dates, coupon_rates, recovery_rates, par_spreads, swap_rates, swap_tenors, is_rofr, holiday_filename, swap_floating_day_count_convention, swap_fixed_day_count_convention, swap_fixed_payment_frequency, swap_floating_payment_frequency, number_of_threads, verbose)
+
+def calculate_spread_from_upfront_charge_vector(trade_date, accrual_start_date, settle_date, maturity_dates, coupon_rates, recovery_rates, upfront_charges, spread_guesses, is_upfront_clean, swap_rates, swap_tenors, is_rofr, holiday_filename, swap_floating_day_count_convention, swap_fixed_day_count_convention, swap_fixed_payment_frequency, swap_floating_payment_frequency, number_of_threads, verbose):
+    return _isda.calculate_spread_from_upfront_charge_vector(trade_date, accrual_start_date, settle_date, maturity_dates, coupon_rates, recovery_rates, upfront_charges, spread_guesses, is_upfront_clean, swap_rates, swap_tenors, is_rofr, holiday_filename, swap_floating_day_count_convention, swap_fixed_day_count_convention, swap_fixed_payment_frequency, swap_floating_payment_frequency, number_of_threads, verbose)
+
+def calculate_spread_from_upfront_charge_vector_tdate(trade_date, accrual_start_date, settle_date, maturity_dates, coupon_rates, recovery_rates, upfront_charges, spread_guesses, is_upfront_clean, swap_rates, swap_tenors, is_rofr, holiday_filename, swap_floating_day_count_convention, swap_fixed_day_count_convention, swap_fixed_payment_frequency, swap_floating_payment_frequency, number_of_threads, verbose):
+    return _isda.calculate_spread_from_upfront_charge_vector_tdate(trade_date, accrual_start_date, settle_date, maturity_dates, coupon_rates, recovery_rates, upfront_charges, spread_guesses, is_upfront_clean, swap_rates, swap_tenors, is_rofr, holiday_filename, swap_floating_day_count_convention, swap_fixed_day_count_convention, swap_fixed_payment_frequency, swap_floating_payment_frequency, number_of_threads, verbose)
+
 def average(i_matrix):
     return _isda.average(i_matrix)
 
 def cds_discount_rate_ir_tenor_dates(value_date, value_dates, swap_rates, swap_tenors, verbose):
     return _isda.cds_discount_rate_ir_tenor_dates(value_date, value_dates, swap_rates, swap_tenors, verbose)
 
+def cds_discount_rate_ir_tenor_dates_tdate(value_date, value_dates, swap_rates, swap_tenors, verbose):
+    return _isda.cds_discount_rate_ir_tenor_dates_tdate(value_date, value_dates, swap_rates, swap_tenors, verbose)
+
 def cds_coupon_schedule(accrual_start_date, maturity_date, coupon_interval, day_count_convention, stub_method, holiday_filename, coupon_rate, notional, verbose):
     return _isda.cds_coupon_schedule(accrual_start_date, maturity_date, coupon_interval, day_count_convention, stub_method, holiday_filename, coupon_rate, notional, verbose)
 
+def cds_coupon_schedule_tdate(accrual_start_date, maturity_date, coupon_interval, day_count_convention, stub_method, holiday_filename, coupon_rate, notional, verbose):
+    return _isda.cds_coupon_schedule_tdate(accrual_start_date, maturity_date, coupon_interval, day_count_convention, stub_method, holiday_filename, coupon_rate, notional, verbose)
+
 def cds_index_all_in_one(trade_date, effective_date, maturity_date, value_date, accrual_start_date, recovery_rate, coupon_rate, notional, is_buy_protection, swap_rates, swap_tenors, swap_maturities, spread_rates, spread_tenors, spread_roll_tenors, imm_dates, scenario_tenors, verbose):
     return _isda.cds_index_all_in_one(trade_date, effective_date, maturity_date, value_date, accrual_start_date, recovery_rate, coupon_rate, notional, is_buy_protection, swap_rates, swap_tenors, swap_maturities, spread_rates, spread_tenors, spread_roll_tenors, imm_dates, scenario_tenors, verbose)
 
+def cds_index_all_in_one_tdate(trade_date, effective_date, maturity_date, value_date, accrual_start_date, recovery_rate, coupon_rate, notional, is_buy_protection, swap_rates, swap_tenors, swap_maturities, spread_rates, spread_tenors, spread_roll_tenors, imm_dates, scenario_tenors, verbose):
+    return _isda.cds_index_all_in_one_tdate(trade_date, effective_date, maturity_date, value_date, accrual_start_date, recovery_rate, coupon_rate, notional, is_buy_protection, swap_rates, swap_tenors, swap_maturities, spread_rates, spread_tenors, spread_roll_tenors, imm_dates, scenario_tenors, verbose)
+
+def cds_index_all_in_one_parallel(trade_date, effective_date, maturity_date, value_date, accrual_start_date, recovery_rate, coupon_rate, notional, is_buy_protection, swap_rates, swap_tenors, swap_maturities, spread_rates, spread_tenors, spread_roll_tenors, imm_dates, scenario_tenors, number_of_threads, verbose):
+    return _isda.cds_index_all_in_one_parallel(trade_date, effective_date, maturity_date, value_date, accrual_start_date, recovery_rate, coupon_rate, notional, is_buy_protection, swap_rates, swap_tenors, swap_maturities, spread_rates, spread_tenors, spread_roll_tenors, imm_dates, scenario_tenors, number_of_threads, verbose)
+
+def cds_index_all_in_one_parallel_tdate(trade_date, effective_date, maturity_date, value_date, accrual_start_date, recovery_rate, coupon_rate, notional, is_buy_protection, swap_rates, swap_tenors, swap_maturities, spread_rates, spread_tenors, spread_roll_tenors, imm_dates, scenario_tenors, number_of_threads, verbose):
+    return _isda.cds_index_all_in_one_parallel_tdate(trade_date, effective_date, maturity_date, value_date, accrual_start_date, recovery_rate, coupon_rate, notional, is_buy_protection, swap_rates, swap_tenors, swap_maturities, spread_rates, spread_tenors, spread_roll_tenors, imm_dates, scenario_tenors, number_of_threads, verbose)
+
 def cds_all_in_one(trade_date, effective_date, maturity_date, value_date, accrual_start_date, recovery_rate, coupon_rate, notional, is_buy_protection, swap_rates, swap_tenors, swap_maturities, spread_rates, spread_tenors, spread_roll_tenors, imm_dates, scenario_tenors, verbose):
     return _isda.cds_all_in_one(trade_date, effective_date, maturity_date, value_date, accrual_start_date, recovery_rate, coupon_rate, notional, is_buy_protection, swap_rates, swap_tenors, swap_maturities, spread_rates, spread_tenors, spread_roll_tenors, imm_dates, scenario_tenors, verbose)
 
+def cds_all_in_one_tdate(trade_date, effective_date, maturity_date, value_date, accrual_start_date, recovery_rate, coupon_rate, notional, is_buy_protection, swap_rates, swap_tenors, swap_maturities, spread_rates, spread_tenors, spread_roll_tenors, imm_dates, scenario_tenors, verbose):
+    return _isda.cds_all_in_one_tdate(trade_date, effective_date, maturity_date, value_date, accrual_start_date, recovery_rate, coupon_rate, notional, is_buy_protection, swap_rates, swap_tenors, swap_maturities, spread_rates, spread_tenors, spread_roll_tenors, imm_dates, scenario_tenors, verbose)
+
 def cds_all_in_one_exclude_ir_tenor_dates(trade_date, effective_date, maturity_date, value_date, accrual_start_date, recovery_rate, coupon_rate, notional, is_buy_protection, swap_rates, swap_tenors, spread_rates, spread_tenors, spread_roll_tenors, imm_dates, scenario_tenors, verbose):
     return _isda.cds_all_in_one_exclude_ir_tenor_dates(trade_date, effective_date, maturity_date, value_date, accrual_start_date, recovery_rate, coupon_rate, notional, is_buy_protection, swap_rates, swap_tenors, spread_rates, spread_tenors, spread_roll_tenors, imm_dates, scenario_tenors, verbose)
+
+def cds_all_in_one_exclude_ir_tenor_dates_tdate(trade_date, effective_date, maturity_date, value_date, accrual_start_date, recovery_rate, coupon_rate, notional, is_buy_protection, swap_rates, swap_tenors, spread_rates, spread_tenors, spread_roll_tenors, imm_dates, scenario_tenors, verbose):
+    return _isda.cds_all_in_one_exclude_ir_tenor_dates_tdate(trade_date, effective_date, maturity_date, value_date, accrual_start_date, recovery_rate, coupon_rate, notional, is_buy_protection, swap_rates, swap_tenors, spread_rates, spread_tenors, spread_roll_tenors, imm_dates, scenario_tenors, verbose)
+
+def cds_discount_curve_handle(value_date, swap_rates, swap_tenors, swap_maturities, verbose):
+    return _isda.cds_discount_curve_handle(value_date, swap_rates, swap_tenors, swap_maturities, verbose)
+
+def cds_discount_curve_handle_tdate(value_date, swap_rates, swap_tenors, swap_maturities, verbose):
+    return _isda.cds_discount_curve_handle_tdate(value_date, swap_rates, swap_tenors, swap_maturities, verbose)
+
+def cds_spread_curve_handle(value_date, effective_date, recovery_rate, discount_curve_handle, spread_rates, imm_dates, verbose):
+    return _isda.cds_spread_curve_handle(value_date, effective_date, recovery_rate, discount_curve_handle, spread_rates, imm_dates, verbose)
+
+def cds_spread_curve_handle_tdate(value_date, effective_date, recovery_rate, discount_curve_handle, spread_rates, imm_dates, verbose):
+    return _isda.cds_spread_curve_handle_tdate(value_date, effective_date, recovery_rate, discount_curve_handle, spread_rates, imm_dates, verbose)
+
+def cds_price_curve_handle(maturity_date, accrual_start_date, coupon_rate, notional, is_buy_protection, spread_curve_handle, verbose):
+    return _isda.cds_price_curve_handle(maturity_date, accrual_start_date, coupon_rate, notional, is_buy_protection, spread_curve_handle, verbose)
+
+def cds_price_curve_handle_tdate(maturity_date, accrual_start_date, coupon_rate, notional, is_buy_protection, spread_curve_handle, verbose):
+    return _isda.cds_price_curve_handle_tdate(maturity_date, accrual_start_date, coupon_rate, notional, is_buy_protection, spread_curve_handle, verbose)
+
+def cds_portfolio_price(maturity_dates, accrual_start_dates, coupon_rates, notionals, is_buy_protection, curve_indices, spread_curve_handles, verbose):
+    return _isda.cds_portfolio_price(maturity_dates, accrual_start_dates, coupon_rates, notionals, is_buy_protection, curve_indices, spread_curve_handles, verbose)
+
+def cds_portfolio_price_tdate(maturity_dates, accrual_start_dates, coupon_rates, notionals, is_buy_protection, curve_indices, spread_curve_handles, verbose):
+    return _isda.cds_portfolio_price_tdate(maturity_dates, accrual_start_dates, coupon_rates, notionals, is_buy_protection, curve_indices, spread_curve_handles, verbose)
+
+def cds_bucketed_dv01(maturity_dates, accrual_start_dates, coupon_rates, notionals, is_buy_protection, spread_curve_handle, verbose):
+    return _isda.cds_bucketed_dv01(maturity_dates, accrual_start_dates, coupon_rates, notionals, is_buy_protection, spread_curve_handle, verbose)
+
+def cds_bucketed_dv01_tdate(maturity_dates, accrual_start_dates, coupon_rates, notionals, is_buy_protection, spread_curve_handle, verbose):
+    return _isda.cds_bucketed_dv01_tdate(maturity_dates, accrual_start_dates, coupon_rates, notionals, is_buy_protection, spread_curve_handle, verbose)
+
+def cds_adjoint_risk(maturity_dates, accrual_start_dates, coupon_rates, notionals, is_buy_protection, spread_curve_handle, verbose):
+    return _isda.cds_adjoint_risk(maturity_dates, accrual_start_dates, coupon_rates, notionals, is_buy_protection, spread_curve_handle, verbose)
+
+def cds_adjoint_risk_tdate(maturity_dates, accrual_start_dates, coupon_rates, notionals, is_buy_protection, spread_curve_handle, verbose):
+    return _isda.cds_adjoint_risk_tdate(maturity_dates, accrual_start_dates, coupon_rates, notionals, is_buy_protection, spread_curve_handle, verbose)
+
+def cds_bucketed_cs01(maturity_dates, accrual_start_dates, coupon_rates, notionals, is_buy_protection, spread_curve_handle, verbose):
+    return _isda.cds_bucketed_cs01(maturity_dates, accrual_start_dates, coupon_rates, notionals, is_buy_protection, spread_curve_handle, verbose)
+
+def cds_bucketed_cs01_tdate(maturity_dates, accrual_start_dates, coupon_rates, notionals, is_buy_protection, spread_curve_handle, verbose):
+    return _isda.cds_bucketed_cs01_tdate(maturity_dates, accrual_start_dates, coupon_rates, notionals, is_buy_protection, spread_curve_handle, verbose)
+
+def cds_scenario_roll_grid(value_date, effective_date, maturity_date, accrual_start_date, recovery_rate, coupon_rate, notional, is_buy_protection, discount_curve_handle, spread_rates, imm_dates, spread_roll_tenors, scenario_tenors, number_of_threads, verbose):
+    return _isda.cds_scenario_roll_grid(value_date, effective_date, maturity_date, accrual_start_date, recovery_rate, coupon_rate, notional, is_buy_protection, discount_curve_handle, spread_rates, imm_dates, spread_roll_tenors, scenario_tenors, number_of_threads, verbose)
+
+def cds_scenario_roll_grid_tdate(value_date, effective_date, maturity_date, accrual_start_date, recovery_rate, coupon_rate, notional, is_buy_protection, discount_curve_handle, spread_rates, imm_dates, spread_roll_tenors, scenario_tenors, number_of_threads, verbose):
+    return _isda.cds_scenario_roll_grid_tdate(value_date, effective_date, maturity_date, accrual_start_date, recovery_rate, coupon_rate, notional, is_buy_protection, discount_curve_handle, spread_rates, imm_dates, spread_roll_tenors, scenario_tenors, number_of_threads, verbose)
+
+def cds_release_curve_handle(curve_handle):
+    return _isda.cds_release_curve_handle(curve_handle)
+
+
+def cds_parse_dates(dates):
+    return _isda.cds_parse_dates(dates)
+
+def cds_yyyymmdd_to_dates(dates):
+    return _isda.cds_yyyymmdd_to_dates(dates)
+
+def cds_dates_to_yyyymmdd(dates):
+    return _isda.cds_dates_to_yyyymmdd(dates)
+
+def cds_register_holidays(holiday_name, holiday_dates, weekends, verbose):
+    return _isda.cds_register_holidays(holiday_name, holiday_dates, weekends, verbose)
+
+def cds_evict_holidays(holiday_name, verbose):
+    return _isda.cds_evict_holidays(holiday_name, verbose)
+
+def cds_holiday_cache_limit(max_file_calendars):
+    return _isda.cds_holiday_cache_limit(max_file_calendars)
 class Callback(object):
     thisown = property(lambda x: x.this.own(), lambda x, v: x.this.own(v), doc="The membership flag")
     __repr__ = _swig_repr
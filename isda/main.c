@@ -24,8 +24,56 @@
 #include "stub.h"
 
 
-EXPORT double calculate_spread_from_upfront_charge
+/*
+***************************************************************************
+** Parses the conventions of the standard contract. The pricing functions
+** taking them do no string parsing and leave the error record alone, so
+** they can be called in loops once the caller has set both up.
+***************************************************************************
+*/
+EXPORT int make_cds_conventions(
+ TCdsConventions *conventions	/* (O) conventions of the standard contract */
+)
+{
+    static char  *routine = "make_cds_conventions";
+    int           status = 1;
+
+    if (conventions == NULL)
+    {
+        JpmcdsErrMsg("%s: NULL conventions passed\n", routine);
+        goto done;
+    }
+
+    if (JpmcdsStringToDateInterval("1D", routine, &conventions->stepinInterval) != SUCCESS)
+        goto done;
+
+    if (JpmcdsStringToDateInterval("3D", routine, &conventions->cashSettleInterval) != SUCCESS)
+        goto done;
+
+    if (JpmcdsStringToDateInterval("Q", routine, &conventions->couponInterval) != SUCCESS)
+        goto done;
+
+    if (JpmcdsStringToDayCountConv("Act/360", &conventions->paymentDcc) != SUCCESS)
+        goto done;
+
+    if (JpmcdsStringToStubMethod("F/S", &conventions->stubMethod) != SUCCESS)
+        goto done;
+
+    conventions->badDayConv      = JPMCDS_BAD_DAY_FOLLOW;
+    conventions->calendar        = "None";
+    conventions->payAccOnDefault = TRUE;
+    conventions->bootstrapSolver = JPMCDS_BOOTSTRAP_BRENT;
+
+    status = 0;
+
+done:
+    return status;
+}
+
+
+EXPORT double calculate_spread_from_upfront_charge_with_conventions
 (
+ TCdsConventions *conventions,	/* (I) parsed once by make_cds_conventions */
  TDate baseDate,				/* (I) base start date  */
  TDate maturityDate,			/* (I) cds scheduled termination date  */
  TDate effectiveDate,			/* (I) accrual from start date  */
@@ -37,6 +85,7 @@ EXPORT double calculate_spread_from_upfront_charge
  double notional,               /* (I) notional */
  char* holiday_filename,        /* (I) holiday file pointer */
  int isPriceClean,              /* (I) is clean price upfront */
+ double guess,                  /* (I) starting spread, 0 starts from the coupon */
  int verbose				    /* (I) used to toggle echo info output */
 )
 {
@@ -48,18 +97,12 @@ EXPORT double calculate_spread_from_upfront_charge
     TDate         stepInDate;
     /*TDate         settleDate;*/
     TDate         endDate;
-    TBoolean      payAccOnDefault = 1;
-    TDateInterval ivl;
-    TDateInterval ivl2;
-    TDateInterval  ivlCashSettle;
-    TStubMethod   stub;
-    long          dcc;
     TBoolean      isPriceCleanInner = FALSE;
     double        result = -1.0;
 
-    if (curve == NULL)
+    if (curve == NULL || conventions == NULL)
     {
-        JpmcdsErrMsg("CalcUpfrontCharge: NULL IR zero curve passed\n");
+        JpmcdsErrMsg("%s: NULL IR zero curve passed\n", routine);
         goto done;
     }
 
@@ -69,24 +112,7 @@ EXPORT double calculate_spread_from_upfront_charge
         isPriceCleanInner = TRUE;
     }
 
-    if (JpmcdsStringToDayCountConv("Act/360", &dcc) != SUCCESS)
-        goto done;
-
-    if (JpmcdsStringToDateInterval("Q", routine, &ivl) != SUCCESS)
-        goto done;
-
-    if (JpmcdsStringToDateInterval("1D", routine, &ivl2) != SUCCESS)
-        goto done;
-
-    if (JpmcdsStringToDateInterval("3D", routine, &ivlCashSettle) != SUCCESS)
-	{
-		goto done;
-	}
-
-    if (JpmcdsStringToStubMethod("f/s", &stub) != SUCCESS)
-        goto done;
-
-    if (JpmcdsDateFwdThenAdjust(baseDate, &ivl2, JPMCDS_BAD_DAY_NONE, "None", &stepInDate) != SUCCESS)
+    if (JpmcdsDateFwdThenAdjust(baseDate, &conventions->stepinInterval, JPMCDS_BAD_DAY_NONE, "None", &stepInDate) != SUCCESS)
 	{
 		goto done;
 	}
@@ -134,23 +160,24 @@ EXPORT double calculate_spread_from_upfront_charge
 	 double         *upfrontCharge)
        */
 
-    if (JpmcdsCdsoneSpread(baseDate,
+    if (JpmcdsCdsoneSpreadFlatHazard(baseDate,
                                   settleDate,
                                   effectiveDate,
                                   stepInDate,
                                   effectiveDate,
                                   maturityDate,
                                   coupon_rate ,
-                                  payAccOnDefault,
-                                  &ivl,
-                                  &stub,
-                                  dcc,
-                                  'F',
+                                  conventions->payAccOnDefault,
+                                  &conventions->couponInterval,
+                                  &conventions->stubMethod,
+                                  conventions->paymentDcc,
+                                  conventions->badDayConv,
                                   holiday_filename,
                                   curve,
                                   upfront_charge ,
                                   recovery_rate,
                                   isPriceCleanInner,
+                                  guess,
                                   &result) != SUCCESS) goto done;
 
 
@@ -199,62 +226,84 @@ done:
     return result;
 }
 
+EXPORT double calculate_spread_from_upfront_charge
+(
+ TDate baseDate,				/* (I) base start date  */
+ TDate maturityDate,			/* (I) cds scheduled termination date  */
+ TDate effectiveDate,			/* (I) accrual from start date  */
+ TDate settleDate,              /* (I) settlementDate 3 business days forward of baseDate */
+ TCurve* curve, 		        /* (I) interest rate curve */
+ double coupon_rate, 		    /* (I) fixed coupon payable in bps */
+ double upfront_charge,         /* (I) upfront_charge */
+ double recovery_rate,          /* (I) recover rate as decimal 0.4 */
+ double notional,               /* (I) notional */
+ char* holiday_filename,        /* (I) holiday file pointer */
+ int isPriceClean,              /* (I) is clean price upfront */
+ int verbose				    /* (I) used to toggle echo info output */
+)
+{
+    TCdsConventions conventions;
+
+    if (make_cds_conventions(&conventions) != 0)
+        return -1.0;
+
+    return calculate_spread_from_upfront_charge_with_conventions
+        (&conventions,
+         baseDate,
+         maturityDate,
+         effectiveDate,
+         settleDate,
+         curve,
+         coupon_rate,
+         upfront_charge,
+         recovery_rate,
+         notional,
+         holiday_filename,
+         isPriceClean,
+         0.0, /* start from the coupon */
+         verbose);
+}
+
 
-EXPORT TCurve* build_credit_spread_par_curve(
+/*
+***************************************************************************
+** Build the par spread curve and, when bumpedCurves is given, one curve
+** per imm date with only that spread bumped, for bucketed CS01. The base
+** curve is the same with or without the bumped curves; while the
+** bootstrap fails the recovery rate is lowered by 1% and it is retried.
+***************************************************************************
+*/
+
+EXPORT TCurve* build_credit_spread_par_curve_buckets_with_conventions(
+ TCdsConventions *conventions,	/* (I) parsed once by make_cds_conventions */
  TDate baseDate,				/* (I) base start date  */
  TCurve *discountCurve, 		/* (I) interest rate curve */
  TDate 	tradeDate,				/* (I) trade start date  */
  double *rates,					/* (I) raw credit swap rates */
  long int *dates,				/* (I) imm dates */
  double recoveryRate,			/* (I) recover rate in basis points */
- int n,							/* (I) number of benchmarm imm dates */
+ int n,							/* (I) number of benchmark imm dates */
+ double bump,					/* (I) added to one spread per bumped curve */
+ TCurve **bumpedCurves,			/* (O) n curves, curve k with spread k bumped, can be NULL */
  int verbose					/* (I) determine if we want to echo info */
 )
 {
-
-    static char    *routine = "build_credit_spread_par_curve";
     TCurve         *sc = NULL;
-    int            payAccruedOnDefault = 1;
     char           **lines = NULL;
-    TDateInterval  ivl;
     int            i=0;
-    TDateInterval  ivlCashSettle;
-    TDateInterval  couponInterval;
-    long int       mmDCC=0;
-    TDate          startDate;
     TDate          stepInDate;
     TDate          cashSettleDate;
-    TStubMethod    stubMethod;
-    int includes[8] = {1,1,1,1,1,1,1,1};
     int            status = 1;
-    int 			nbDate = 8;
 
-	JpmcdsErrMsgOn();
-
-    if (JpmcdsErrMsgEnableRecord(20, 128) != SUCCESS) /* ie. 20 lines, each of max length 128 */
+    if (conventions == NULL || discountCurve == NULL || rates == NULL || dates == NULL || n < 1)
         goto done;
 
-	if (JpmcdsStringToDateInterval("1D", routine, &ivl) != SUCCESS)
-	{
-		goto done;
-	}
-
-	if (JpmcdsStringToDateInterval("3D", routine, &ivlCashSettle) != SUCCESS)
-	{
-		goto done;
-	}
-
-	if (JpmcdsDateFwdThenAdjust(tradeDate, &ivl, JPMCDS_BAD_DAY_NONE, "None", &startDate) != SUCCESS)
-	{
-		goto done;
-	}
-
 	if(verbose){
 	  printf("today = %d\n", (int)baseDate);
 	  printf("startDate = %d\n", (int)tradeDate);
 	}
 
-	if (JpmcdsDateFwdThenAdjust(baseDate, &ivl, JPMCDS_BAD_DAY_NONE, "None", &stepInDate) != SUCCESS)
+	if (JpmcdsDateFwdThenAdjust(baseDate, &conventions->stepinInterval, JPMCDS_BAD_DAY_NONE, "None", &stepInDate) != SUCCESS)
 	{
 		goto done;
 	}
@@ -262,7 +311,7 @@ EXPORT TCurve* build_credit_spread_par_curve(
 		printf("stepInDate = %d\n", (int)stepInDate);
 	}
 
-	if (JpmcdsDateFwdThenAdjust(baseDate, &ivlCashSettle, JPMCDS_BAD_DAY_MODIFIED, "None", &cashSettleDate) != SUCCESS)
+	if (JpmcdsDateFwdThenAdjust(baseDate, &conventions->cashSettleInterval, JPMCDS_BAD_DAY_MODIFIED, "None", &cashSettleDate) != SUCCESS)
 	{
 		goto done;
 	}
@@ -270,70 +319,66 @@ EXPORT TCurve* build_credit_spread_par_curve(
 		printf("cashSettleDate = %d\n", (int)cashSettleDate);
 	}
 
-    if (JpmcdsStringToDayCountConv("Act/360", &mmDCC) != SUCCESS)
-        goto done;
-
-    if (JpmcdsStringToDateInterval("Q", routine, &couponInterval) != SUCCESS)
-        goto done;
-
-    if (JpmcdsStringToStubMethod("F/S", &stubMethod)  != SUCCESS)
-        goto done;
-
- /*
-    EXPORT TCurve* JpmcdsCleanSpreadCurve
-(TDate              today,            (I) Used as credit curve base date
- TCurve            *discountCurve,    (I) Risk-free discount curve
- TDate              startDate,        (I) Start of CDS for accrual and risk
- TDate              stepinDate,       (I) Stepin date
- TDate              cashSettleDate,   (I) Pay date
- long               nbDate,           (I) Number of benchmark dates
- TDate             *endDates,         (I) Maturity dates of CDS to bootstrap
- double            *couponRates,      (I) CouponRates (e.g. 0.05 = 5% = 500bp)
- TBoolean          *includes,         (I) Include this date. Can be NULL if
-                                        all are included.
- double             recoveryRate,     (I) Recovery rate
- TBoolean           payAccOnDefault,  (I) Pay accrued on default
- TDateInterval     *couponInterval,   (I) Interval between fee payments
- long               paymentDCC,       (I) DCC for fee payments and accrual
- TStubMethod       *stubType,         (I) Stub type for fee leg
- long               badDayConv,
- char              *calendar
-)
-
-*/
-
 	if(verbose){
-		printf("calling JpmcdsBuildCleanSpreadCurve...\n");
+		printf(bumpedCurves == NULL ? "calling JpmcdsBuildCleanSpreadCurve...\n"
+		                            : "calling JpmcdsCleanSpreadCurveBuckets...\n");
 	}
-	
+
 	do {
-	
-	    sc = JpmcdsCleanSpreadCurve
-		    (baseDate,
-		     discountCurve,
-		     tradeDate,
-		     stepInDate,
-		     cashSettleDate,
-		     nbDate,
-		     dates,
-		     rates,
-		     includes,
-		     recoveryRate,
-		     payAccruedOnDefault,
-		     &couponInterval,
-		     mmDCC,
-		     &stubMethod,
-		     'F',
-		     "None"
-		    );
-		    
+
+		if (bumpedCurves == NULL)
+		{
+		    sc = JpmcdsCleanSpreadCurveSolver
+			    (baseDate,
+			     discountCurve,
+			     tradeDate,
+			     stepInDate,
+			     cashSettleDate,
+			     n,
+			     dates,
+			     rates,
+			     NULL,
+			     recoveryRate,
+			     conventions->payAccOnDefault,
+			     &conventions->couponInterval,
+			     conventions->paymentDcc,
+			     &conventions->stubMethod,
+			     conventions->badDayConv,
+			     conventions->calendar,
+			     conventions->bootstrapSolver
+			    );
+		}
+		else
+		{
+		    sc = JpmcdsCleanSpreadCurveBuckets
+			    (baseDate,
+			     discountCurve,
+			     tradeDate,
+			     stepInDate,
+			     cashSettleDate,
+			     n,
+			     dates,
+			     rates,
+			     recoveryRate,
+			     conventions->payAccOnDefault,
+			     &conventions->couponInterval,
+			     conventions->paymentDcc,
+			     &conventions->stubMethod,
+			     conventions->badDayConv,
+			     conventions->calendar,
+			     conventions->bootstrapSolver,
+			     bump,
+			     bumpedCurves
+			    );
+		}
+
 		  recoveryRate -= 0.01;
-		  if(verbose){  
+		  if(verbose){
 		    printf("shiftedRecoveryRate = %f\n", recoveryRate);
 		  }
-            
+
 	}while(sc == NULL);
-	
+
 	status = 0;
 
 done:
@@ -362,6 +407,210 @@ done:
     return sc;
 }
 
+
+EXPORT TCurve* build_credit_spread_par_curve_with_conventions(
+ TCdsConventions *conventions,	/* (I) parsed once by make_cds_conventions */
+ TDate baseDate,				/* (I) base start date  */
+ TCurve *discountCurve, 		/* (I) interest rate curve */
+ TDate 	tradeDate,				/* (I) trade start date  */
+ double *rates,					/* (I) raw credit swap rates */
+ long int *dates,				/* (I) imm dates */
+ double recoveryRate,			/* (I) recover rate in basis points */
+ int n,							/* (I) number of benchmarm imm dates */
+ int verbose					/* (I) determine if we want to echo info */
+)
+{
+    return build_credit_spread_par_curve_buckets_with_conventions
+        (conventions,
+         baseDate,
+         discountCurve,
+         tradeDate,
+         rates,
+         dates,
+         recoveryRate,
+         n,
+         0.0,
+         NULL,
+         verbose);
+}
+
+
+EXPORT TCurve* build_credit_spread_par_curve(
+ TDate baseDate,				/* (I) base start date  */
+ TCurve *discountCurve, 		/* (I) interest rate curve */
+ TDate 	tradeDate,				/* (I) trade start date  */
+ double *rates,					/* (I) raw credit swap rates */
+ long int *dates,				/* (I) imm dates */
+ double recoveryRate,			/* (I) recover rate in basis points */
+ int n,							/* (I) number of benchmarm imm dates */
+ int verbose					/* (I) determine if we want to echo info */
+)
+{
+    TCdsConventions  conventions;
+    TCdsConventions *pConventions = NULL;
+
+	JpmcdsErrMsgOn();
+
+    if (JpmcdsErrMsgEnableRecord(20, 128) == SUCCESS && /* ie. 20 lines, each of max length 128 */
+        make_cds_conventions(&conventions) == 0)
+        pConventions = &conventions;
+
+    return build_credit_spread_par_curve_with_conventions
+        (pConventions,
+         baseDate,
+         discountCurve,
+         tradeDate,
+         rates,
+         dates,
+         recoveryRate,
+         n,
+         verbose);
+}
+
+
+EXPORT TCurve* build_credit_spread_par_curve_buckets(
+ TDate baseDate,				/* (I) base start date  */
+ TCurve *discountCurve, 		/* (I) interest rate curve */
+ TDate 	tradeDate,				/* (I) trade start date  */
+ double *rates,					/* (I) raw credit swap rates */
+ long int *dates,				/* (I) imm dates */
+ double recoveryRate,			/* (I) recover rate in basis points */
+ int n,							/* (I) number of benchmark imm dates */
+ double bump,					/* (I) added to one spread per bumped curve */
+ TCurve **bumpedCurves,			/* (O) n curves, curve k with spread k bumped */
+ int verbose					/* (I) determine if we want to echo info */
+)
+{
+    TCdsConventions  conventions;
+    TCdsConventions *pConventions = NULL;
+
+	JpmcdsErrMsgOn();
+
+    if (JpmcdsErrMsgEnableRecord(20, 128) == SUCCESS && /* ie. 20 lines, each of max length 128 */
+        make_cds_conventions(&conventions) == 0)
+        pConventions = &conventions;
+
+    return build_credit_spread_par_curve_buckets_with_conventions
+        (pConventions,
+         baseDate,
+         discountCurve,
+         tradeDate,
+         rates,
+         dates,
+         recoveryRate,
+         n,
+         bump,
+         bumpedCurves,
+         verbose);
+}
+
+/*
+***************************************************************************
+** Sensitivities of the rates of a par spread curve built by
+** build_credit_spread_par_curve to its spreads and to the discount curve
+** rates, using the same benchmark conventions.
+***************************************************************************
+*/
+
+EXPORT int credit_spread_par_curve_jacobian_with_conventions(
+ TCdsConventions *conventions,	/* (I) parsed once by make_cds_conventions */
+ TDate baseDate,				/* (I) base start date  */
+ TCurve *discountCurve, 		/* (I) interest rate curve */
+ TDate 	tradeDate,				/* (I) trade start date  */
+ double *rates,					/* (I) raw credit swap rates */
+ long int *dates,				/* (I) imm dates */
+ double recoveryRate,			/* (I) recover rate in basis points */
+ int n,							/* (I) number of benchmark imm dates */
+ TCurve *spreadCurve,			/* (I) curve bootstrapped from the above */
+ double *rateByQuote,			/* (O) n x n curve rate by spread */
+ double *rateByDiscount,		/* (O) n x discount points, can be NULL */
+ int verbose					/* (I) determine if we want to echo info */
+)
+{
+    static char    *routine = "credit_spread_par_curve_jacobian";
+    int            status = FAILURE;
+    TDate          stepInDate;
+    TDate          cashSettleDate;
+
+    if (conventions == NULL)
+    {
+        JpmcdsErrMsg("%s: NULL conventions passed\n", routine);
+        goto done;
+    }
+
+	if (JpmcdsDateFwdThenAdjust(baseDate, &conventions->stepinInterval, JPMCDS_BAD_DAY_NONE, "None", &stepInDate) != SUCCESS)
+		goto done;
+
+	if (JpmcdsDateFwdThenAdjust(baseDate, &conventions->cashSettleInterval, JPMCDS_BAD_DAY_MODIFIED, "None", &cashSettleDate) != SUCCESS)
+		goto done;
+
+	if(verbose){
+		printf("calling JpmcdsCleanSpreadCurveJacobian...\n");
+	}
+
+	status = JpmcdsCleanSpreadCurveJacobian
+	    (baseDate,
+	     discountCurve,
+	     tradeDate,
+	     stepInDate,
+	     cashSettleDate,
+	     n,
+	     dates,
+	     rates,
+	     recoveryRate,
+	     conventions->payAccOnDefault,
+	     &conventions->couponInterval,
+	     conventions->paymentDcc,
+	     &conventions->stubMethod,
+	     conventions->badDayConv,
+	     conventions->calendar,
+	     spreadCurve,
+	     rateByQuote,
+	     rateByDiscount);
+
+done:
+
+    if (status != SUCCESS && verbose){
+        printf("%s: could not differentiate the spread curve\n", routine);
+    }
+
+    return status;
+}
+
+EXPORT int credit_spread_par_curve_jacobian(
+ TDate baseDate,				/* (I) base start date  */
+ TCurve *discountCurve, 		/* (I) interest rate curve */
+ TDate 	tradeDate,				/* (I) trade start date  */
+ double *rates,					/* (I) raw credit swap rates */
+ long int *dates,				/* (I) imm dates */
+ double recoveryRate,			/* (I) recover rate in basis points */
+ int n,							/* (I) number of benchmark imm dates */
+ TCurve *spreadCurve,			/* (I) curve bootstrapped from the above */
+ double *rateByQuote,			/* (O) n x n curve rate by spread */
+ double *rateByDiscount,		/* (O) n x discount points, can be NULL */
+ int verbose					/* (I) determine if we want to echo info */
+)
+{
+    TCdsConventions conventions;
+
+    if (make_cds_conventions(&conventions) != 0)
+        return FAILURE;
+
+    return credit_spread_par_curve_jacobian_with_conventions
+        (&conventions,
+         baseDate,
+         discountCurve,
+         tradeDate,
+         rates,
+         dates,
+         recoveryRate,
+         n,
+         spreadCurve,
+         rateByQuote,
+         rateByDiscount,
+         verbose);
+}
+
 /*
 ***************************************************************************
 ** Build IR zero curve.
@@ -815,8 +1064,9 @@ done:
 ** Calculate upfront charge.
 ***************************************************************************
 */
-EXPORT double calculate_upfront_charge
+EXPORT double calculate_upfront_charge_with_conventions
 (
+ TCdsConventions *conventions,	/* (I) parsed once by make_cds_conventions */
  TDate baseDate,				/* (I) base start date  */
  TDate maturityDate,			/* (I) cds scheduled termination date  */
  TDate effectiveDate,			/* (I) accrual from start date  */
@@ -839,40 +1089,17 @@ EXPORT double calculate_upfront_charge
     TDate         stepInDate;
     /*TDate         settleDate;*/
     TDate         endDate;
-    TBoolean      payAccOnDefault = 1;
-    TDateInterval ivl;
-    TDateInterval ivl2;
-    TDateInterval  ivlCashSettle;
-    TStubMethod   stub;
-    long          dcc;
     /*TBoolean      isPriceClean = FALSE;*/
     double        result = -1.0;
 
-    if (curve == NULL)
+    if (curve == NULL || conventions == NULL)
     {
-        JpmcdsErrMsg("CalcUpfrontCharge: NULL IR zero curve passed\n");
+        JpmcdsErrMsg("%s: NULL IR zero curve passed\n", routine);
         goto done;
     }
 
 
-    if (JpmcdsStringToDayCountConv("Act/360", &dcc) != SUCCESS)
-        goto done;
-
-    if (JpmcdsStringToDateInterval("Q", routine, &ivl) != SUCCESS)
-        goto done;
-
-    if (JpmcdsStringToDateInterval("1D", routine, &ivl2) != SUCCESS)
-        goto done;
-
-    if (JpmcdsStringToDateInterval("3D", routine, &ivlCashSettle) != SUCCESS)
-	{
-		goto done;
-	}
-
-    if (JpmcdsStringToStubMethod("f/s", &stub) != SUCCESS)
-        goto done;
-
-    if (JpmcdsDateFwdThenAdjust(baseDate, &ivl2, JPMCDS_BAD_DAY_NONE, "None", &stepInDate) != SUCCESS)
+    if (JpmcdsDateFwdThenAdjust(baseDate, &conventions->stepinInterval, JPMCDS_BAD_DAY_NONE, "None", &stepInDate) != SUCCESS)
 	{
 		goto done;
 	}
@@ -926,11 +1153,11 @@ EXPORT double calculate_upfront_charge
                                   effectiveDate,
                                   maturityDate,
                                   coupon_rate ,
-                                  payAccOnDefault,
-                                  &ivl,
-                                  &stub,
-                                  dcc,
-                                  'F',
+                                  conventions->payAccOnDefault,
+                                  &conventions->couponInterval,
+                                  &conventions->stubMethod,
+                                  conventions->paymentDcc,
+                                  conventions->badDayConv,
                                   holiday_filename,
                                   curve,
                                   par_spread ,
@@ -984,7 +1211,45 @@ done:
     return result * notional;
 }
 
-EXPORT double calculate_cds_price(
+EXPORT double calculate_upfront_charge
+(
+ TDate baseDate,				/* (I) base start date  */
+ TDate maturityDate,			/* (I) cds scheduled termination date  */
+ TDate effectiveDate,			/* (I) accrual from start date  */
+ TDate settleDate,              /* (I) settlementDate 3 business days forward of baseDate */
+ TCurve* curve, 		        /* (I) interest rate curve */
+ double coupon_rate, 		    /* (I) fixed coupon payable in bps */
+ double par_spread,             /* (I) par spread in bps */
+ double recovery_rate,          /* (I) recover rate as decimal 0.4 */
+ double notional,               /* (I) notional */
+ char* holiday_filename,        /* (I) holiday file pointer */
+ int isPriceClean,              /* (I) is clean price upfront */
+ int verbose				    /* (I) used to toggle echo info output */
+)
+{
+    TCdsConventions conventions;
+
+    if (make_cds_conventions(&conventions) != 0)
+        return -1.0;
+
+    return calculate_upfront_charge_with_conventions
+        (&conventions,
+         baseDate,
+         maturityDate,
+         effectiveDate,
+         settleDate,
+         curve,
+         coupon_rate,
+         par_spread,
+         recovery_rate,
+         notional,
+         holiday_filename,
+         isPriceClean,
+         verbose);
+}
+
+EXPORT double calculate_cds_price_with_conventions(
+ TCdsConventions *conventions,	/* (I) parsed once by make_cds_conventions */
  TDate baseDate,				/* (I) base start date  */
  TDate maturityDate,			/* (I) cds scheduled termination date  */
  TCurve *discountCurve, 		/* (I) interest rate curve */
@@ -998,30 +1263,17 @@ EXPORT double calculate_cds_price(
 {
     static char    *routine = "calculate_cds_price";
     int            status = 1;
-    int            payAccruedOnDefault = 1;
     char           **lines = NULL;
-    TDateInterval  ivl;
-    TDateInterval  ivlCashSettle;
-    TDateInterval  couponInterval;
     int            i=0;
-    long int       paymentDcc=0;
     TDate          stepInDate;
     TDate          settleDate;
-    TStubMethod    stubMethod;
     double         price;
 
-    if (JpmcdsErrMsgEnableRecord(20, 128) != SUCCESS) /* ie. 20 lines, each of max length 128 */
+    if (conventions == NULL)
+    {
+        JpmcdsErrMsg("%s: NULL conventions passed\n", routine);
         goto done;
-
-	if (JpmcdsStringToDateInterval("1D", routine, &ivl) != SUCCESS)
-	{
-		goto done;
-	}
-
-	if (JpmcdsStringToDateInterval("3D", routine, &ivlCashSettle) != SUCCESS)
-	{
-		goto done;
-	}
+    }
 
 	//if (JpmcdsDateFwdThenAdjust(effectiveDate, &ivl, JPMCDS_BAD_DAY_NONE, "None", &startDate) != SUCCESS)
 	//{
@@ -1031,12 +1283,12 @@ EXPORT double calculate_cds_price(
 	//	printf("startDate = %d\n", (int)startDate);
 	//}
 
-	if (JpmcdsDateFwdThenAdjust(baseDate, &ivl, JPMCDS_BAD_DAY_NONE, "None", &stepInDate) != SUCCESS)
+	if (JpmcdsDateFwdThenAdjust(baseDate, &conventions->stepinInterval, JPMCDS_BAD_DAY_NONE, "None", &stepInDate) != SUCCESS)
 	{
 		goto done;
 	}	
 
-	if (JpmcdsDateFwdThenAdjust(baseDate, &ivlCashSettle, JPMCDS_BAD_DAY_MODIFIED, "None", &settleDate) != SUCCESS)
+	if (JpmcdsDateFwdThenAdjust(baseDate, &conventions->cashSettleInterval, JPMCDS_BAD_DAY_MODIFIED, "None", &settleDate) != SUCCESS)
 	{
 		goto done;
 	}
@@ -1052,15 +1304,6 @@ EXPORT double calculate_cds_price(
 		printf("recoveryRate = %f\n", recoveryRate);
 	}
 	
-    if (JpmcdsStringToDayCountConv("Act/360", &paymentDcc) != SUCCESS)
-        goto done;
-
-    if (JpmcdsStringToDateInterval("Q", routine, &couponInterval) != SUCCESS)
-        goto done;
-
-    if (JpmcdsStringToStubMethod("F", &stubMethod)  != SUCCESS)
-        goto done;
-
     //printf("calling JpmcdsCdsContingentLegPV...\n");
 
 	/*if (JpmcdsCdsContingentLegPV(baseDate,
@@ -1107,12 +1350,12 @@ EXPORT double calculate_cds_price(
 			 effectiveDate,
 			 maturityDate,
 			 couponRate,
-			 payAccruedOnDefault,
-			 &couponInterval,
-			 &stubMethod,
-			 paymentDcc,
-			 'F',
-			 "None",
+			 conventions->payAccOnDefault,
+			 &conventions->couponInterval,
+			 &conventions->stubMethod,
+			 conventions->paymentDcc,
+			 conventions->badDayConv,
+			 conventions->calendar,
 			 discountCurve,
 			 spreadCurve,
 			 recoveryRate,
@@ -1152,6 +1395,365 @@ done:
 
 }
 
+EXPORT double calculate_cds_price(
+ TDate baseDate,				/* (I) base start date  */
+ TDate maturityDate,			/* (I) cds scheduled termination date  */
+ TCurve *discountCurve, 		/* (I) interest rate curve */
+ TCurve *spreadCurve, 			/* (I) spread rate curve */
+ TDate effectiveDate,			/* (I) accrual from start date  */
+ double recoveryRate,			/* (I) recover rate in basis points */
+ double couponRate,				/* (I) couple rate */
+ int isPriceClean,				/* (I) clean = 1, dirty = 0 */
+ int verbose					/* (I) used to toggle info output */
+)
+{
+    TCdsConventions  conventions;
+    TCdsConventions *pConventions = NULL;
+
+    if (JpmcdsErrMsgEnableRecord(20, 128) == SUCCESS && /* ie. 20 lines, each of max length 128 */
+        make_cds_conventions(&conventions) == 0)
+        pConventions = &conventions;
+
+    return calculate_cds_price_with_conventions
+        (pConventions,
+         baseDate,
+         maturityDate,
+         discountCurve,
+         spreadCurve,
+         effectiveDate,
+         recoveryRate,
+         couponRate,
+         isPriceClean,
+         verbose);
+}
+
+EXPORT int calculate_cds_risky_annuities_with_conventions(
+ TCdsConventions *conventions,	/* (I) parsed once by make_cds_conventions */
+ TDate baseDate,				/* (I) base start date  */
+ TDate *maturityDates,			/* (I) cds scheduled termination dates  */
+ int n,							/* (I) number of maturity dates */
+ TCurve *discountCurve, 		/* (I) interest rate curve */
+ TCurve *spreadCurve, 			/* (I) spread rate curve */
+ TDate effectiveDate,			/* (I) accrual from start date  */
+ int isPriceClean,				/* (I) clean = 1, dirty = 0 */
+ double *annuities,				/* (O) fee leg pv at unit coupon per maturity */
+ int verbose					/* (I) used to toggle info output */
+)
+{
+    static char    *routine = "calculate_cds_risky_annuities";
+    int            status = 1;
+    char           **lines = NULL;
+    int            i=0;
+    TDate          stepInDate;
+    TDate          settleDate;
+
+    if (conventions == NULL)
+    {
+        JpmcdsErrMsg("%s: NULL conventions passed\n", routine);
+        goto done;
+    }
+
+	if (JpmcdsDateFwdThenAdjust(baseDate, &conventions->stepinInterval, JPMCDS_BAD_DAY_NONE, "None", &stepInDate) != SUCCESS)
+		goto done;
+
+	if (JpmcdsDateFwdThenAdjust(baseDate, &conventions->cashSettleInterval, JPMCDS_BAD_DAY_MODIFIED, "None", &settleDate) != SUCCESS)
+		goto done;
+
+	if(verbose){
+		printf("calling JpmcdsCdsRiskyAnnuities...\n");
+	}
+
+	// same conventions as calculate_cds_price, so the annuities are its pvbp per unit coupon
+	if (JpmcdsCdsRiskyAnnuities
+		(baseDate,
+		 settleDate,
+		 stepInDate,
+		 effectiveDate,
+		 n,
+		 maturityDates,
+		 conventions->payAccOnDefault,
+		 &conventions->couponInterval,
+		 &conventions->stubMethod,
+		 conventions->paymentDcc,
+		 conventions->badDayConv,
+		 conventions->calendar,
+		 discountCurve,
+		 spreadCurve,
+		 isPriceClean,
+		 annuities) != SUCCESS){
+
+		 goto done;
+
+		 }
+
+	status = 0;
+
+done:
+
+	if (status != 0){
+		printf("\n");
+		printf("Error log contains:\n");
+		printf("------------------:\n");
+
+		lines = JpmcdsErrGetMsgRecord();
+		if (lines == NULL)
+			printf("(no log contents)\n");
+		else
+		{
+			for(i = 0; lines[i] != NULL; i++)
+			{
+				if (strcmp(lines[i],"") != 0)
+					printf("%s\n", lines[i]);
+			}
+		}
+    }
+	return status;
+}
+
+EXPORT int calculate_cds_risky_annuities(
+ TDate baseDate,				/* (I) base start date  */
+ TDate *maturityDates,			/* (I) cds scheduled termination dates  */
+ int n,							/* (I) number of maturity dates */
+ TCurve *discountCurve, 		/* (I) interest rate curve */
+ TCurve *spreadCurve, 			/* (I) spread rate curve */
+ TDate effectiveDate,			/* (I) accrual from start date  */
+ int isPriceClean,				/* (I) clean = 1, dirty = 0 */
+ double *annuities,				/* (O) fee leg pv at unit coupon per maturity */
+ int verbose					/* (I) used to toggle info output */
+)
+{
+    TCdsConventions  conventions;
+    TCdsConventions *pConventions = NULL;
+
+    if (JpmcdsErrMsgEnableRecord(20, 128) == SUCCESS && /* ie. 20 lines, each of max length 128 */
+        make_cds_conventions(&conventions) == 0)
+        pConventions = &conventions;
+
+    return calculate_cds_risky_annuities_with_conventions
+        (pConventions,
+         baseDate,
+         maturityDates,
+         n,
+         discountCurve,
+         spreadCurve,
+         effectiveDate,
+         isPriceClean,
+         annuities,
+         verbose);
+}
+
+EXPORT TCdsTrade* prepare_cds_trade_with_conventions(
+ TCdsConventions *conventions,	/* (I) parsed once by make_cds_conventions */
+ TDate baseDate,				/* (I) base start date  */
+ TDate maturityDate,			/* (I) cds scheduled termination date  */
+ TDate effectiveDate,			/* (I) accrual from start date  */
+ double couponRate,				/* (I) couple rate */
+ int verbose					/* (I) used to toggle info output */
+)
+{
+    static char    *routine = "prepare_cds_trade";
+    TDate          stepInDate;
+    TDate          settleDate;
+    TCdsTrade      *trade = NULL;
+    int            status = 1;
+    char           **lines = NULL;
+    int            i=0;
+
+    if (conventions == NULL)
+    {
+        JpmcdsErrMsg("%s: NULL conventions passed\n", routine);
+        goto done;
+    }
+
+	if (JpmcdsDateFwdThenAdjust(baseDate, &conventions->stepinInterval, JPMCDS_BAD_DAY_NONE, "None", &stepInDate) != SUCCESS)
+		goto done;
+
+	if (JpmcdsDateFwdThenAdjust(baseDate, &conventions->cashSettleInterval, JPMCDS_BAD_DAY_MODIFIED, "None", &settleDate) != SUCCESS)
+		goto done;
+
+	if(verbose){
+		printf("calling JpmcdsCdsTradeMake...\n");
+	}
+
+	trade = JpmcdsCdsTradeMake(baseDate,
+			 settleDate,
+			 stepInDate,
+			 effectiveDate,
+			 maturityDate,
+			 couponRate,
+			 conventions->payAccOnDefault,
+			 &conventions->couponInterval,
+			 &conventions->stubMethod,
+			 conventions->paymentDcc,
+			 conventions->badDayConv,
+			 conventions->calendar);
+
+	if (trade == NULL)
+		goto done;
+
+	status = 0;
+
+done:
+
+	if (status != 0){
+		printf("\n");
+		printf("Error log contains:\n");
+		printf("------------------:\n");
+
+		lines = JpmcdsErrGetMsgRecord();
+		if (lines == NULL)
+			printf("(no log contents)\n");
+		else
+		{
+			for(i = 0; lines[i] != NULL; i++)
+			{
+				if (strcmp(lines[i],"") != 0)
+					printf("%s\n", lines[i]);
+			}
+		}
+    }
+	return trade;
+}
+
+EXPORT TCdsTrade* prepare_cds_trade(
+ TDate baseDate,				/* (I) base start date  */
+ TDate maturityDate,			/* (I) cds scheduled termination date  */
+ TDate effectiveDate,			/* (I) accrual from start date  */
+ double couponRate,				/* (I) couple rate */
+ int verbose					/* (I) used to toggle info output */
+)
+{
+    TCdsConventions  conventions;
+    TCdsConventions *pConventions = NULL;
+
+    if (JpmcdsErrMsgEnableRecord(20, 128) == SUCCESS && /* ie. 20 lines, each of max length 128 */
+        make_cds_conventions(&conventions) == 0)
+        pConventions = &conventions;
+
+    return prepare_cds_trade_with_conventions
+        (pConventions,
+         baseDate,
+         maturityDate,
+         effectiveDate,
+         couponRate,
+         verbose);
+}
+
+/*
+***************************************************************************
+** Price a trade from prepare_cds_trade. The error record is left alone,
+** the caller enables it once before pricing trades in a loop.
+***************************************************************************
+*/
+EXPORT double calculate_cds_trade_price(
+ TCdsTrade *trade,				/* (I) trade from prepare_cds_trade */
+ TCurve *discountCurve, 		/* (I) interest rate curve */
+ TCurve *spreadCurve, 			/* (I) spread rate curve */
+ double recoveryRate,			/* (I) recover rate in basis points */
+ int isPriceClean,				/* (I) clean = 1, dirty = 0 */
+ int verbose					/* (I) used to toggle info output */
+)
+{
+    int            status = 1;
+    char           **lines = NULL;
+    int            i=0;
+    double         price = 0.0;
+
+	if (JpmcdsCdsTradePrice(trade,
+			 discountCurve,
+			 spreadCurve,
+			 recoveryRate,
+			 isPriceClean,
+			 &price) != SUCCESS){
+
+			 goto done;
+
+			 }
+
+	if(verbose){
+		printf("calling JpmcdsCdsTradePrice = %.15f\n", price);
+	}
+
+	status = 0;
+
+done:
+
+	if (status != 0){
+		printf("\n");
+		printf("Error log contains:\n");
+		printf("------------------:\n");
+
+		lines = JpmcdsErrGetMsgRecord();
+		if (lines == NULL)
+			printf("(no log contents)\n");
+		else
+		{
+			for(i = 0; lines[i] != NULL; i++)
+			{
+				if (strcmp(lines[i],"") != 0)
+					printf("%s\n", lines[i]);
+			}
+		}
+    }
+	return price;
+}
+
+EXPORT int calculate_cds_trade_prices(
+ TCdsTrade *trade,				/* (I) trade from prepare_cds_trade */
+ TCurve *discountCurve, 		/* (I) interest rate curve */
+ TCurve *spreadCurve, 			/* (I) spread rate curve */
+ double recoveryRate,			/* (I) recover rate in basis points */
+ double *dirtyPrice,			/* (O) dirty price */
+ double *cleanPrice,			/* (O) clean price */
+ int verbose					/* (I) used to toggle info output */
+)
+{
+    int            status = 1;
+    char           **lines = NULL;
+    int            i=0;
+
+	if (JpmcdsCdsTradePriceAll(trade,
+			 discountCurve,
+			 spreadCurve,
+			 recoveryRate,
+			 NULL,
+			 NULL,
+			 NULL,
+			 dirtyPrice,
+			 cleanPrice) != SUCCESS){
+
+			 goto done;
+
+			 }
+
+	if(verbose){
+		printf("calling JpmcdsCdsTradePriceAll = %.15f %.15f\n", *dirtyPrice, *cleanPrice);
+	}
+
+	status = 0;
+
+done:
+
+	if (status != 0){
+		printf("\n");
+		printf("Error log contains:\n");
+		printf("------------------:\n");
+
+		lines = JpmcdsErrGetMsgRecord();
+		if (lines == NULL)
+			printf("(no log contents)\n");
+		else
+		{
+			for(i = 0; lines[i] != NULL; i++)
+			{
+				if (strcmp(lines[i],"") != 0)
+					printf("%s\n", lines[i]);
+			}
+		}
+    }
+	return status;
+}
+
 EXPORT TDate* calculate_cds_roll_dates(
  TDate baseDate,		/* (I) integer base start date JpmCdsDate */
  char **rollExpiries,	/* (I) array of char* of tenor strings "1M", "2M", "3M", "6M", "9M", "1Y", "2Y", "3Y", "4Y", "5Y", "6Y", "7Y", "8Y", "9Y" */
@@ -1216,7 +1818,8 @@ done:
 
 }
 
-EXPORT double* calculate_cds_par_spread(
+EXPORT double* calculate_cds_par_spread_with_conventions(
+ TCdsConventions *conventions,	/* (I) parsed once by make_cds_conventions */
  TDate baseDate,				/* (I) base start date  */
  TDate maturityDate,			/* (I) cds scheduled termination date  */
  TCurve *discountCurve, 		/* (I) interest rate curve */
@@ -1232,38 +1835,22 @@ EXPORT double* calculate_cds_par_spread(
 {
     static char    *routine = "calculate_cds_par_spread";
     int            status = 1;
-    int            payAccruedOnDefault = 1;
     char           **lines = NULL;
     TDate          *endDates = NULL;
-    TDateInterval  ivl;
-    TDateInterval  ivlCashSettle;
-    TDateInterval  couponInterval;
     int            i=0;
-    long int       paymentDcc=0;
     TDate          stepInDate;
     TDate          settleDate;
-    TStubMethod    stubMethod;
     double         *parSpread = NULL;
 
-    if (JpmcdsErrMsgEnableRecord(20, 128) != SUCCESS) /* ie. 20 lines, each of max length 128 */
+    if (conventions == NULL)
         goto done;
 
-	if (JpmcdsStringToDateInterval("1D", routine, &ivl) != SUCCESS)
-	{
-		goto done;
-	}
-
-	if (JpmcdsStringToDateInterval("3D", routine, &ivlCashSettle) != SUCCESS)
-	{
-		goto done;
-	}
-
-	if (JpmcdsDateFwdThenAdjust(baseDate, &ivl, JPMCDS_BAD_DAY_NONE, "None", &stepInDate) != SUCCESS)
+	if (JpmcdsDateFwdThenAdjust(baseDate, &conventions->stepinInterval, JPMCDS_BAD_DAY_NONE, "None", &stepInDate) != SUCCESS)
 	{
 		goto done;
 	}	
 
-	if (JpmcdsDateFwdThenAdjust(baseDate, &ivlCashSettle, JPMCDS_BAD_DAY_MODIFIED, "None", &settleDate) != SUCCESS)
+	if (JpmcdsDateFwdThenAdjust(baseDate, &conventions->cashSettleInterval, JPMCDS_BAD_DAY_MODIFIED, "None", &settleDate) != SUCCESS)
 	{
 		goto done;
 	}
@@ -1280,15 +1867,6 @@ EXPORT double* calculate_cds_par_spread(
 		printf("nbEndDates = %d\n", nbEndDates);
 	}
 	
-    if (JpmcdsStringToDayCountConv("Act/360", &paymentDcc) != SUCCESS)
-        goto done;
-
-    if (JpmcdsStringToDateInterval("Q", routine, &couponInterval) != SUCCESS)
-        goto done;
-
-    if (JpmcdsStringToStubMethod("F", &stubMethod)  != SUCCESS)
-        goto done;
-
 	if(verbose){
 		printf("calling JpmcdsCdsPrice...\n");
 	}
@@ -1356,12 +1934,12 @@ EXPORT double* calculate_cds_par_spread(
 			 effectiveDate,
 			 nbEndDates,
 			 endDates,
-			 payAccruedOnDefault,
-			 &couponInterval,
-			 &stubMethod,
-			 paymentDcc,
-			 'F',
-			 "None",
+			 conventions->payAccOnDefault,
+			 &conventions->couponInterval,
+			 &conventions->stubMethod,
+			 conventions->paymentDcc,
+			 conventions->badDayConv,
+			 conventions->calendar,
 			 discountCurve,
 			 spreadCurve,
 			 recoveryRate,
@@ -1399,7 +1977,44 @@ done:
 			}
 		}
     }
+	FREE(endDates);
 	return parSpread;
 
 }
 
+EXPORT double* calculate_cds_par_spread(
+ TDate baseDate,				/* (I) base start date  */
+ TDate maturityDate,			/* (I) cds scheduled termination date  */
+ TCurve *discountCurve, 		/* (I) interest rate curve */
+ TCurve *spreadCurve, 			/* (I) spread rate curve */
+ TDate effectiveDate,			/* (I) accrual from start date  */
+ double recoveryRate,			/* (I) recover rate in basis points */
+ double couponRate,				/* (I) couple rate */
+ int isPriceClean,				/* (I) clean = 1, dirty = 0 */
+ int verbose,					/* (I) used to toggle info output */
+ char **endDateTenors,	        /* (I) array of char* of tenor strings "1M", "2M", "3M", "6M", "9M", "1Y", "2Y", "3Y", "4Y", "5Y", "6Y", "7Y", "8Y", "9Y" */
+ int nbEndDates                 /* (I) input count of roll expires */
+)
+{
+    TCdsConventions  conventions;
+    TCdsConventions *pConventions = NULL;
+
+    if (JpmcdsErrMsgEnableRecord(20, 128) == SUCCESS && /* ie. 20 lines, each of max length 128 */
+        make_cds_conventions(&conventions) == 0)
+        pConventions = &conventions;
+
+    return calculate_cds_par_spread_with_conventions
+        (pConventions,
+         baseDate,
+         maturityDate,
+         discountCurve,
+         spreadCurve,
+         effectiveDate,
+         recoveryRate,
+         couponRate,
+         isPriceClean,
+         verbose,
+         endDateTenors,
+         nbEndDates);
+}
+
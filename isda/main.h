@@ -9,6 +9,26 @@
  */
 
 #include "cx.h"
+#include "cds.h"
+
+extern "C" int make_cds_conventions(
+ TCdsConventions *conventions
+);
+
+extern "C" double* calculate_cds_par_spread_with_conventions(
+ TCdsConventions *conventions,
+ TDate baseDate,
+ TDate maturityDate,
+ TCurve *discountCurve,
+ TCurve *spreadCurve,
+ TDate effectiveDate,
+ double recoveryRate,
+ double couponRate,
+ int isPriceClean,
+ int verbose,
+ char **endDateTenors,
+ int nbEndDates
+);
 
 extern "C" double* calculate_cds_par_spread(
  TDate baseDate,				
@@ -43,6 +63,80 @@ extern "C" double calculate_cds_price(
  int verbose
 );
 
+extern "C" double calculate_cds_price_with_conventions(
+ TCdsConventions *conventions,
+ TDate baseDate,
+ TDate maturityDate,
+ TCurve *discountCurve,
+ TCurve *spreadCurve,
+ TDate 	tradeDate,
+ double recoveryRate,
+ double couponRate,
+ int isPriceClean,
+ int verbose
+);
+
+extern "C" int calculate_cds_risky_annuities(
+ TDate baseDate,
+ TDate *maturityDates,
+ int n,
+ TCurve *discountCurve,
+ TCurve *spreadCurve,
+ TDate effectiveDate,
+ int isPriceClean,
+ double *annuities,
+ int verbose
+);
+
+extern "C" int calculate_cds_risky_annuities_with_conventions(
+ TCdsConventions *conventions,
+ TDate baseDate,
+ TDate *maturityDates,
+ int n,
+ TCurve *discountCurve,
+ TCurve *spreadCurve,
+ TDate effectiveDate,
+ int isPriceClean,
+ double *annuities,
+ int verbose
+);
+
+extern "C" TCdsTrade* prepare_cds_trade(
+ TDate baseDate,
+ TDate maturityDate,
+ TDate tradeDate,
+ double couponRate,
+ int verbose
+);
+
+extern "C" TCdsTrade* prepare_cds_trade_with_conventions(
+ TCdsConventions *conventions,
+ TDate baseDate,
+ TDate maturityDate,
+ TDate tradeDate,
+ double couponRate,
+ int verbose
+);
+
+extern "C" double calculate_cds_trade_price(
+ TCdsTrade *trade,
+ TCurve *discountCurve,
+ TCurve *spreadCurve,
+ double recoveryRate,
+ int isPriceClean,
+ int verbose
+);
+
+extern "C" int calculate_cds_trade_prices(
+ TCdsTrade *trade,
+ TCurve *discountCurve,
+ TCurve *spreadCurve,
+ double recoveryRate,
+ double *dirtyPrice,
+ double *cleanPrice,
+ int verbose
+);
+
 extern "C" TCurve* build_zero_interest_rate_curve_rofr(
  TDate baseDate,
  double *rates,
@@ -83,6 +177,74 @@ extern "C" TCurve* build_credit_spread_par_curve(
  int verbose
 );
 
+extern "C" TCurve* build_credit_spread_par_curve_with_conventions(
+ TCdsConventions *conventions,
+ TDate baseDate,
+ TCurve* discountCurve,
+ TDate 	tradeDate,
+ double *rates,
+ long int *dates,
+ double recoveryRate,
+ int n,
+ int verbose
+);
+
+extern "C" TCurve* build_credit_spread_par_curve_buckets(
+ TDate baseDate,
+ TCurve* discountCurve,
+ TDate 	tradeDate,
+ double *rates,
+ long int *dates,
+ double recoveryRate,
+ int n,
+ double bump,
+ TCurve **bumpedCurves,
+ int verbose
+);
+
+extern "C" TCurve* build_credit_spread_par_curve_buckets_with_conventions(
+ TCdsConventions *conventions,
+ TDate baseDate,
+ TCurve* discountCurve,
+ TDate 	tradeDate,
+ double *rates,
+ long int *dates,
+ double recoveryRate,
+ int n,
+ double bump,
+ TCurve **bumpedCurves,
+ int verbose
+);
+
+extern "C" int credit_spread_par_curve_jacobian(
+ TDate baseDate,
+ TCurve* discountCurve,
+ TDate 	tradeDate,
+ double *rates,
+ long int *dates,
+ double recoveryRate,
+ int n,
+ TCurve *spreadCurve,
+ double *rateByQuote,
+ double *rateByDiscount,
+ int verbose
+);
+
+extern "C" int credit_spread_par_curve_jacobian_with_conventions(
+ TCdsConventions *conventions,
+ TDate baseDate,
+ TCurve* discountCurve,
+ TDate 	tradeDate,
+ double *rates,
+ long int *dates,
+ double recoveryRate,
+ int n,
+ TCurve *spreadCurve,
+ double *rateByQuote,
+ double *rateByDiscount,
+ int verbose
+);
+
 extern "C" double calculate_upfront_charge(
  TDate baseDate,				/* (I) base start date  */
  TDate maturityDate,			/* (I) cds scheduled termination date  */
@@ -99,6 +261,23 @@ extern "C" double calculate_upfront_charge(
  );
 
 
+extern "C" double calculate_upfront_charge_with_conventions(
+ TCdsConventions *conventions,	/* (I) parsed once by make_cds_conventions */
+ TDate baseDate,				/* (I) base start date  */
+ TDate maturityDate,			/* (I) cds scheduled termination date  */
+ TDate effectiveDate,			/* (I) accrual from start date  */
+ TDate settleDate,              /* (I) settlementDate 3 business days forward of baseDate */
+ TCurve* curve, 		        /* (I) interest rate curve */
+ double coupon_rate, 		    /* (I) fixed coupon payable in bps */
+ double par_spread,             /* (I) par spread in bps*/
+ double recovery_rate,          /* (I) recover rate as decimal 0.4 */
+ double notional,               /* (I) notional */
+ char* holiday_filename,        /* (I) holiday file pointer */
+ int isPriceClean,              /* (I) is clean price upfront */
+ int verbose				    /* (I) used to toggle echo info output */
+ );
+
+
 extern "C" double calculate_spread_from_upfront_charge
 (
  TDate baseDate,				/* (I) base start date  */
@@ -113,4 +292,22 @@ extern "C" double calculate_spread_from_upfront_charge
  char* holiday_filename,        /* (I) holiday file pointer */
  int isPriceClean,              /* (I) is clean price upfront */
  int verbose				    /* (I) used to toggle echo info output */
-);
\ No newline at end of file
+);
+
+extern "C" double calculate_spread_from_upfront_charge_with_conventions
+(
+ TCdsConventions *conventions,	/* (I) parsed once by make_cds_conventions */
+ TDate baseDate,				/* (I) base start date  */
+ TDate maturityDate,			/* (I) cds scheduled termination date  */
+ TDate effectiveDate,			/* (I) accrual from start date  */
+ TDate settleDate,              /* (I) settlementDate 3 business days forward of baseDate */
+ TCurve* curve, 		        /* (I) interest rate curve */
+ double coupon_rate, 		    /* (I) fixed coupon payable in bps */
+ double upfront_charge,         /* (I) upfront_charge */
+ double recovery_rate,          /* (I) recover rate as decimal 0.4 */
+ double notional,               /* (I) notional */
+ char* holiday_filename,        /* (I) holiday file pointer */
+ int isPriceClean,              /* (I) is clean price upfront */
+ double guess,                  /* (I) starting spread, 0 starts from the coupon */
+ int verbose				    /* (I) used to toggle echo info output */
+);
@@ -35,6 +35,16 @@ static int checkTCurve(
     char   *routine);          /* (I) For error messages. */
 
 
+/*
+** Curves released while pooling is on for the thread. The array of each
+** pooled curve holds at least fNumItems points.
+*/
+static JPMCDS_THREAD_LOCAL TCurve **poolCurves = NULL;
+static JPMCDS_THREAD_LOCAL int      poolSize   = 0;
+static JPMCDS_THREAD_LOCAL int      poolUsed   = 0;
+static JPMCDS_THREAD_LOCAL int      poolDepth  = 0;
+
+
 /*
 ***************************************************************************
 ** Allocates and sets a TCurve.
@@ -72,6 +82,25 @@ TCurve* JpmcdsNewTCurve
         goto done;
     }
 
+    /* Reuse a pooled TCurve with an array of the same size.
+    */
+    if (poolUsed > 0 && numPts > 0)
+    {
+        int i;
+        for (i = poolUsed - 1; i >= 0; --i)
+        {
+            if (poolCurves[i]->fNumItems == numPts)
+            {
+                tc = poolCurves[i];
+                poolCurves[i] = poolCurves[--poolUsed];
+                tc->fDayCountConv = dayCountConv;
+                tc->fBasis = basis;
+                tc->fBaseDate = baseDate;
+                return tc;
+            }
+        }
+    }
+
     /* Allocate the TCurve and set parameters.
     */
     tc = NEW(TCurve);
@@ -360,12 +389,80 @@ void JpmcdsFreeTCurve(TCurve *theCurve)
 {
     if (theCurve != (TCurve *)NULL)
     {
+        if (poolUsed < poolSize && theCurve->fNumItems > 0 &&
+            theCurve->fArray != NULL)
+        {
+            poolCurves[poolUsed++] = theCurve;
+            return;
+        }
         FREE(theCurve->fArray);
         FREE(theCurve);
     }
 }
 
 
+/*
+***************************************************************************
+** Starts pooling of TCurves on the calling thread.
+***************************************************************************
+*/
+int JpmcdsTCurvePoolStart(int maxCurves)
+{
+    static char routine[] = "JpmcdsTCurvePoolStart";
+    int         status    = FAILURE;
+
+    if (maxCurves < 1)
+    {
+        JpmcdsErrMsg ("%s: Pool size %d must be at least 1.\n",
+                      routine, maxCurves);
+        goto done;
+    }
+
+    if (poolDepth == 0)
+    {
+        poolCurves = NEW_ARRAY(TCurve*, maxCurves);
+        if (poolCurves == NULL)
+            goto done;
+        poolSize = maxCurves;
+        poolUsed = 0;
+    }
+    ++poolDepth;
+
+    status = SUCCESS;
+
+ done:
+
+    if (status != SUCCESS)
+        JpmcdsErrMsg ("%s: Failed.\n", routine);
+
+    return status;
+}
+
+
+/*
+***************************************************************************
+** Stops pooling of TCurves on the calling thread.
+***************************************************************************
+*/
+void JpmcdsTCurvePoolStop(void)
+{
+    TCurve **curves = poolCurves;
+    int      used   = poolUsed;
+    int      i;
+
+    if (poolDepth == 0 || --poolDepth > 0)
+        return;
+
+    poolCurves = NULL;
+    poolSize   = 0;
+    poolUsed   = 0;
+
+    for (i = 0; i < used; ++i)
+        JpmcdsFreeTCurve(curves[i]);
+    FREE(curves);
+}
+
+
 /*
 ***************************************************************************
 ** Creates a copy of the curve.
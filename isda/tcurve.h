@@ -119,6 +119,30 @@ void JpmcdsFreeTCurve
     (TCurve *);                    /* (I) TCurve to be deallocated */
 
 
+/*f
+***************************************************************************
+** Starts pooling of TCurves on the calling thread.
+**
+** Until the matching JpmcdsTCurvePoolStop, up to maxCurves curves freed
+** by JpmcdsFreeTCurve on this thread are kept and handed out again by
+** JpmcdsNewTCurve for curves with the same number of points. The rates
+** and dates of a reused curve are not cleared. Calls can be nested, in
+** which case the outermost call sets the size of the pool.
+***************************************************************************
+*/
+int JpmcdsTCurvePoolStart
+    (int maxCurves);               /* (I) Number of curves kept */
+
+
+/*f
+***************************************************************************
+** Stops pooling of TCurves on the calling thread. The pooled curves are
+** freed when the outermost pooling stops.
+***************************************************************************
+*/
+void JpmcdsTCurvePoolStop(void);
+
+
 /*f
 ***************************************************************************
 ** Creates a copy of the curve.
@@ -0,0 +1,134 @@
+import unittest
+import datetime
+
+from isda.isda import cds_discount_curve_handle, cds_spread_curve_handle, cds_release_curve_handle, \
+    cds_price_curve_handle, cds_bucketed_cs01, cds_adjoint_risk
+from isda.imm import imm_date_vector
+
+
+class MyTestCase(unittest.TestCase):
+    """
+        Testcase that reconciles the reverse sweep sensitivities of a book with
+        the bumped bootstrap: cs01 per spread pillar must agree with
+        cds_bucketed_cs01 to first order and the dv01 per discount curve point
+        must add up to about the parallel dv01.
+
+    """
+
+    __name__ = "MyTestCase"
+
+    def setUp(self):
+
+        # available from markit swap feed
+        self.swap_rates = [-0.00369, -0.00340, -0.00329, -0.00271, -0.00219, -0.00187, -0.00149, 0.000040, 0.00159,
+                           0.00303, 0.00435, 0.00559, 0.00675, 0.00785, 0.00887]
+        self.swap_tenors = ['1M', '2M', '3M', '6M', '9M', '1Y', '2Y', '3Y', '4Y', '5Y', '6Y', '7Y', '8Y', '9Y', '10Y']
+        self.swap_maturity_dates = ['12/2/2018', '12/3/2018', '10/4/2018', '10/07/2018', '10/10/2018', '10/1/2019'
+            , '10/01/2020', '10/1/2021', '10/1/2022', '10/1/2023', '10/1/2024', '10/1/2025', '10/1/2026', '10/01/2027'
+            , '10/01/2028']
+
+        # upward sloping spread curve
+        self.credit_spreads = [0.0010, 0.0012, 0.0015, 0.0020, 0.0024, 0.0028, 0.0033, 0.0038]
+
+        self.recovery_rate = 0.40000
+        self.effective_date = '09/01/2018'
+        self.verbose = 0
+
+        self.sdate = datetime.datetime(2018, 1, 8)
+        self.value_date = self.sdate.strftime('%d/%m/%Y')
+        self.imm_dates = [f[1] for f in imm_date_vector(
+            start_date=self.sdate, tenor_list=[0.5, 1, 2, 3, 4, 5, 7, 10])]
+
+        # book of trades
+        self.maturity_dates = ['20/12/2019', '20/06/2021', '20/12/2022', '20/12/2027']
+        self.accrual_start_dates = ['20/12/2017'] * 4
+        self.coupons = [100, 100, 500, 100]
+        self.notionals = [10.0, 10.0, 5.0, 7.0]
+        self.is_buy_protection = [1, 0, 1, 1]
+
+        self.discount_handle = cds_discount_curve_handle(self.value_date,
+                                                         self.swap_rates,
+                                                         self.swap_tenors,
+                                                         self.swap_maturity_dates,
+                                                         self.verbose)
+
+        self.spread_handle = cds_spread_curve_handle(self.value_date,
+                                                     self.effective_date,
+                                                     self.recovery_rate,
+                                                     self.discount_handle,
+                                                     self.credit_spreads,
+                                                     self.imm_dates,
+                                                     self.verbose)
+
+    def tearDown(self):
+        cds_release_curve_handle(self.spread_handle)
+        cds_release_curve_handle(self.discount_handle)
+
+    def test_reconcile_bucketed_cs01(self):
+        """ method to test adjoint cs01 per pillar against the bumped bootstrap """
+
+        adjoint = cds_adjoint_risk(self.maturity_dates,
+                                   self.accrual_start_dates,
+                                   self.coupons,
+                                   self.notionals,
+                                   self.is_buy_protection,
+                                   self.spread_handle,
+                                   self.verbose)
+
+        bumped = cds_bucketed_cs01(self.maturity_dates,
+                                   self.accrual_start_dates,
+                                   self.coupons,
+                                   self.notionals,
+                                   self.is_buy_protection,
+                                   self.spread_handle,
+                                   self.verbose)
+
+        pillars = len(self.credit_spreads)
+        self.assertEqual([1.0] * len(self.maturity_dates), list(adjoint[-2]))
+
+        for t in range(len(self.maturity_dates)):
+            self.assertGreater(len(adjoint[t]), pillars)
+            for expected, actual in zip(bumped[t], adjoint[t][:pillars]):
+                # a 1bp bump only adds a second order term
+                self.assertAlmostEqual(expected, actual, delta=1.0e-3 * max(abs(x) for x in bumped[t]))
+
+    def test_dv01_adds_up(self):
+        """ method to test dv01 per discount curve point adds up to the parallel dv01 """
+
+        adjoint = cds_adjoint_risk(self.maturity_dates,
+                                   self.accrual_start_dates,
+                                   self.coupons,
+                                   self.notionals,
+                                   self.is_buy_protection,
+                                   self.spread_handle,
+                                   self.verbose)
+
+        pillars = len(self.credit_spreads)
+        for t in range(len(self.maturity_dates)):
+            dv01 = cds_price_curve_handle(self.maturity_dates[t],
+                                          self.accrual_start_dates[t],
+                                          self.coupons[t],
+                                          self.notionals[t],
+                                          self.is_buy_protection[t],
+                                          self.spread_handle,
+                                          self.verbose)[4]
+
+            # zero rates and swap rates do not move one for one
+            self.assertAlmostEqual(dv01, sum(adjoint[t][pillars:]), delta=0.02 * abs(dv01))
+
+    def test_bad_handle(self):
+        """ method to test an unknown handle is reported through status """
+
+        adjoint = cds_adjoint_risk(self.maturity_dates,
+                                   self.accrual_start_dates,
+                                   self.coupons,
+                                   self.notionals,
+                                   self.is_buy_protection,
+                                   -1,
+                                   self.verbose)
+
+        self.assertEqual([-1] * len(self.maturity_dates), list(adjoint[-2]))
+
+
+if __name__ == '__main__':
+    unittest.main()
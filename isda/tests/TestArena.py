@@ -0,0 +1,194 @@
+import ctypes
+import threading
+import unittest
+
+from isda import isda
+
+JPMCDS_ARENA_SIZE = 4 * 1024 * 1024
+
+# a request of 20000 bytes is given a block of the 32KB size class
+REQUEST = 20000
+BLOCK = 32768
+
+
+class MallInfo(ctypes.Structure):
+    _fields_ = [(name, ctypes.c_size_t) for name in
+                ['arena', 'ordblks', 'smblks', 'hblks', 'hblkhd', 'usmblks', 'fsmblks', 'uordblks', 'fordblks',
+                 'keepcost']]
+
+
+HAS_MALLINFO2 = hasattr(ctypes.CDLL(None), 'mallinfo2')
+
+
+class MyTestCase(unittest.TestCase):
+    """
+        Testcase that checks the blocks kept by the allocation arena of
+        JpmcdsMallocSafe and JpmcdsFreeSafe, called directly from the
+        extension library. Whether a block was kept or returned to the heap
+        is read from the heap in use reported by glibc.
+
+    """
+
+    __name__ = "MyTestCase"
+
+    def setUp(self):
+
+        self.lib = ctypes.CDLL(isda._isda.__file__)
+        self.lib.JpmcdsMallocSafe.restype = ctypes.c_void_p
+        self.lib.JpmcdsMallocSafe.argtypes = [ctypes.c_size_t]
+        self.lib.JpmcdsFreeSafe.argtypes = [ctypes.c_void_p]
+        self.lib.JpmcdsArenaStart.argtypes = [ctypes.c_size_t]
+        self.lib.JpmcdsArenaStop.argtypes = []
+
+        if HAS_MALLINFO2:
+            self.mallinfo2 = ctypes.CDLL(None).mallinfo2
+            self.mallinfo2.restype = MallInfo
+
+    def malloc(self, size=REQUEST):
+
+        ptr = self.lib.JpmcdsMallocSafe(size)
+        self.assertTrue(ptr)
+        self.assertEqual(0, ptr % 16)
+        return ptr
+
+    def kept(self, action):
+        """ whether the heap in use is unchanged by an action which releases a block """
+
+        heap_in_use = self.mallinfo2().uordblks
+        action()
+
+        # less than a block, as the first free of a thread sets up its glibc cache
+        return heap_in_use - self.mallinfo2().uordblks < REQUEST / 2
+
+    def free_is_kept(self, ptr):
+
+        return self.kept(lambda: self.lib.JpmcdsFreeSafe(ptr))
+
+    def test_blocks_recycled(self):
+        """ method to test a released block is handed out cleared to the next request of its size class """
+
+        self.lib.JpmcdsArenaStart(JPMCDS_ARENA_SIZE)
+        try:
+            ptr = self.malloc()
+            ctypes.memset(ptr, 0xff, REQUEST)
+            self.lib.JpmcdsFreeSafe(ptr)
+
+            small = self.malloc(100)
+            self.assertNotEqual(ptr, small)
+            again = self.malloc(BLOCK)
+            self.assertEqual(ptr, again)
+            self.assertEqual(b'\0' * BLOCK, ctypes.string_at(again, BLOCK))
+            self.lib.JpmcdsFreeSafe(small)
+            self.lib.JpmcdsFreeSafe(again)
+        finally:
+            self.lib.JpmcdsArenaStop()
+
+    @unittest.skipUnless(HAS_MALLINFO2, 'needs glibc mallinfo2')
+    def test_blocks_not_kept(self):
+        """ method to test blocks over 64KB and blocks from before the arena go back to the heap """
+
+        before = self.malloc()
+        self.lib.JpmcdsArenaStart(JPMCDS_ARENA_SIZE)
+        try:
+            self.assertFalse(self.free_is_kept(before))
+            self.assertFalse(self.free_is_kept(self.malloc(65537)))
+            self.assertTrue(self.free_is_kept(self.malloc(65536)))
+        finally:
+            self.lib.JpmcdsArenaStop()
+
+    @unittest.skipUnless(HAS_MALLINFO2, 'needs glibc mallinfo2')
+    def test_free_after_stop(self):
+        """ method to test blocks outlive their arena and the kept blocks are freed when it stops """
+
+        self.lib.JpmcdsArenaStart(JPMCDS_ARENA_SIZE)
+        outliving = self.malloc()
+        self.assertTrue(self.free_is_kept(self.malloc()))
+        self.assertFalse(self.kept(self.lib.JpmcdsArenaStop))
+
+        self.assertFalse(self.free_is_kept(outliving))
+
+        # a block from an earlier arena is kept by the next one
+        self.lib.JpmcdsArenaStart(JPMCDS_ARENA_SIZE)
+        outliving = self.malloc()
+        self.lib.JpmcdsArenaStop()
+        self.lib.JpmcdsArenaStart(JPMCDS_ARENA_SIZE)
+        try:
+            self.assertTrue(self.free_is_kept(outliving))
+            self.assertEqual(outliving, self.malloc())
+            self.lib.JpmcdsFreeSafe(outliving)
+        finally:
+            self.lib.JpmcdsArenaStop()
+
+    @unittest.skipUnless(HAS_MALLINFO2, 'needs glibc mallinfo2')
+    def test_free_on_another_thread(self):
+        """ method to test blocks released on a thread without an arena, or with its own one """
+
+        results = []
+
+        def free_without_arena(ptr):
+            results.append(self.free_is_kept(ptr))
+
+        def free_with_arena(ptr):
+            self.lib.JpmcdsArenaStart(JPMCDS_ARENA_SIZE)
+            results.append(self.free_is_kept(ptr))
+            results.append(self.lib.JpmcdsMallocSafe(REQUEST) == ptr)
+            self.lib.JpmcdsFreeSafe(ptr)
+            results.append(self.kept(self.lib.JpmcdsArenaStop))
+
+        self.lib.JpmcdsArenaStart(JPMCDS_ARENA_SIZE)
+        for target in [free_without_arena, free_with_arena]:
+            thread = threading.Thread(target=target, args=(self.malloc(),))
+            thread.start()
+            thread.join()
+
+        # the blocks went to the other threads, none is kept by this one
+        self.assertTrue(self.kept(self.lib.JpmcdsArenaStop))
+        self.assertEqual([False, True, True, False], results)
+
+    @unittest.skipUnless(HAS_MALLINFO2, 'needs glibc mallinfo2')
+    def test_nested_arenas(self):
+        """ method to test nested arenas keep the blocks and the size limit of the outermost one """
+
+        self.lib.JpmcdsArenaStart(JPMCDS_ARENA_SIZE)
+        self.lib.JpmcdsArenaStart(0)
+        ptr = self.malloc()
+        self.assertTrue(self.free_is_kept(ptr))
+        self.assertEqual(ptr, self.malloc())
+
+        # stopping the inner arena keeps the blocks of the outer one
+        self.lib.JpmcdsArenaStop()
+        self.assertTrue(self.free_is_kept(ptr))
+        self.assertEqual(ptr, self.malloc())
+        self.assertTrue(self.free_is_kept(ptr))
+        self.assertFalse(self.kept(self.lib.JpmcdsArenaStop))
+
+        # an unmatched stop is ignored
+        self.lib.JpmcdsArenaStop()
+        self.lib.JpmcdsArenaStart(0)
+        self.lib.JpmcdsArenaStart(JPMCDS_ARENA_SIZE)
+        try:
+            self.assertFalse(self.free_is_kept(self.malloc()))
+        finally:
+            self.lib.JpmcdsArenaStop()
+            self.lib.JpmcdsArenaStop()
+
+    @unittest.skipUnless(HAS_MALLINFO2, 'needs glibc mallinfo2')
+    def test_max_bytes(self):
+        """ method to test the arena keeps blocks up to its size limit and frees the rest """
+
+        self.lib.JpmcdsArenaStart(2 * BLOCK)
+        try:
+            blocks = [self.malloc() for _ in range(4)]
+            self.assertEqual([True, True, False, False], [self.free_is_kept(ptr) for ptr in blocks])
+
+            # the last block kept is handed out first
+            again = [self.malloc(), self.malloc()]
+            self.assertEqual([blocks[1], blocks[0]], again)
+            for ptr in again:
+                self.lib.JpmcdsFreeSafe(ptr)
+        finally:
+            self.lib.JpmcdsArenaStop()
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,110 @@
+import ctypes
+import unittest
+
+from isda import isda
+from isda.isda import cds_yyyymmdd_to_dates
+
+JPMCDS_ACT_365F = 2
+JPMCDS_ACT_360 = 3
+JPMCDS_BOOTSTRAP_BRENT = 0
+JPMCDS_BOOTSTRAP_NEWTON = 1
+
+
+class TRatePt(ctypes.Structure):
+    _fields_ = [('fDate', ctypes.c_long), ('fRate', ctypes.c_double)]
+
+
+class TCurve(ctypes.Structure):
+    _fields_ = [('fNumItems', ctypes.c_int), ('fArray', ctypes.POINTER(TRatePt)), ('fBaseDate', ctypes.c_long),
+                ('fBasis', ctypes.c_double), ('fDayCountConv', ctypes.c_long)]
+
+
+class TStubMethod(ctypes.Structure):
+    _fields_ = [('stubAtEnd', ctypes.c_int), ('longStub', ctypes.c_int)]
+
+
+class MyTestCase(unittest.TestCase):
+    """
+        Testcase that bootstraps the same spread curves with the brent and
+        the newton root finder of JpmcdsCleanSpreadCurveSolver, called
+        directly from the extension library.
+
+    """
+
+    __name__ = "MyTestCase"
+
+    def setUp(self):
+
+        self.lib = ctypes.CDLL(isda._isda.__file__)
+        self.lib.JpmcdsMakeTCurve.restype = ctypes.POINTER(TCurve)
+        self.lib.JpmcdsMakeTCurve.argtypes = [ctypes.c_long, ctypes.POINTER(ctypes.c_long),
+                                              ctypes.POINTER(ctypes.c_double), ctypes.c_int, ctypes.c_double,
+                                              ctypes.c_long]
+        self.lib.JpmcdsCleanSpreadCurveSolver.restype = ctypes.POINTER(TCurve)
+        self.lib.JpmcdsCleanSpreadCurveSolver.argtypes = [ctypes.c_long, ctypes.POINTER(TCurve), ctypes.c_long,
+                                                          ctypes.c_long, ctypes.c_long, ctypes.c_long,
+                                                          ctypes.POINTER(ctypes.c_long),
+                                                          ctypes.POINTER(ctypes.c_double), ctypes.c_void_p,
+                                                          ctypes.c_double, ctypes.c_int, ctypes.c_void_p,
+                                                          ctypes.c_long, ctypes.POINTER(TStubMethod), ctypes.c_long,
+                                                          ctypes.c_char_p, ctypes.c_int]
+        self.lib.JpmcdsFreeTCurve.argtypes = [ctypes.POINTER(TCurve)]
+
+        self.today = cds_yyyymmdd_to_dates([20180108])[0]
+        zero_dates = cds_yyyymmdd_to_dates([20190108, 20200108, 20230108, 20280108])
+        zero_rates = [0.01, 0.012, 0.015, 0.02]
+        self.discount_curve = self.lib.JpmcdsMakeTCurve(self.today, (ctypes.c_long * 4)(*zero_dates),
+                                                        (ctypes.c_double * 4)(*zero_rates), 4, 1.0,
+                                                        JPMCDS_ACT_365F)
+
+        # imm maturities of the 6M to 10Y benchmarks
+        self.end_dates = cds_yyyymmdd_to_dates([20180620, 20181220, 20191220, 20201220, 20211220, 20221220,
+                                                20241220, 20271220])
+
+    def tearDown(self):
+
+        self.lib.JpmcdsFreeTCurve(self.discount_curve)
+
+    def bootstrap(self, spreads, recovery_rate, solver):
+
+        n = len(self.end_dates)
+        stub = TStubMethod(0, 0)
+        curve = self.lib.JpmcdsCleanSpreadCurveSolver(self.today, self.discount_curve, self.today + 1,
+                                                      self.today + 1, self.today + 3, n,
+                                                      (ctypes.c_long * n)(*self.end_dates),
+                                                      (ctypes.c_double * n)(*spreads), None, recovery_rate, 1,
+                                                      None, JPMCDS_ACT_360, ctypes.byref(stub), ord('F'), b'None',
+                                                      solver)
+        self.assertTrue(curve)
+        rates = [curve.contents.fArray[i].fRate for i in range(curve.contents.fNumItems)]
+        self.lib.JpmcdsFreeTCurve(curve)
+        return rates
+
+    def test_newton_matches_brent(self):
+        """ method to test newton curves against brent over a grid of levels, slopes and recoveries """
+
+        for level in [0.0025, 0.01, 0.03, 0.06]:
+            for slope in [-0.02, 0.0, 0.05]:
+                for recovery_rate in [0.25, 0.4]:
+                    spreads = [level * (1 + slope) ** i for i in range(len(self.end_dates))]
+                    brent = self.bootstrap(spreads, recovery_rate, JPMCDS_BOOTSTRAP_BRENT)
+                    newton = self.bootstrap(spreads, recovery_rate, JPMCDS_BOOTSTRAP_NEWTON)
+                    self.assertEqual(len(brent), len(newton))
+                    for b, n in zip(brent, newton):
+                        self.assertAlmostEqual(b, n, delta=1e-10)
+
+    def test_newton_falls_back_to_brent(self):
+        """ method to test an inverted curve where newton leaves its bounds on the last two benchmarks """
+
+        # from the flat guess the newton step of the 7Y and 10Y benchmarks goes
+        # below zero, so those two are solved by brent and the curve still builds
+        spreads = [0.7 * 0.965 ** i for i in range(len(self.end_dates))]
+        brent = self.bootstrap(spreads, 0.4, JPMCDS_BOOTSTRAP_BRENT)
+        newton = self.bootstrap(spreads, 0.4, JPMCDS_BOOTSTRAP_NEWTON)
+        self.assertEqual(len(brent), len(newton))
+        for b, n in zip(brent, newton):
+            self.assertAlmostEqual(b, n, delta=1e-10)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,110 @@
+import unittest
+import datetime
+
+from isda.isda import cds_discount_curve_handle, cds_spread_curve_handle, cds_price_curve_handle, \
+    cds_release_curve_handle, cds_bucketed_dv01
+from isda.imm import imm_date_vector
+
+
+class MyTestCase(unittest.TestCase):
+    """
+        Testcase that bucketed dv01 reconciles with repricing against curves
+        bootstrapped with a single swap rate bumped, and adds up to the parallel dv01.
+
+    """
+
+    __name__ = "MyTestCase"
+
+    def setUp(self):
+
+        # available from markit swap feed
+        self.swap_rates = [-0.00369, -0.00340, -0.00329, -0.00271, -0.00219, -0.00187, -0.00149, 0.000040, 0.00159,
+                           0.00303, 0.00435, 0.00559, 0.00675, 0.00785, 0.00887]
+        self.swap_tenors = ['1M', '2M', '3M', '6M', '9M', '1Y', '2Y', '3Y', '4Y', '5Y', '6Y', '7Y', '8Y', '9Y', '10Y']
+        self.swap_maturity_dates = ['12/2/2018', '12/3/2018', '10/4/2018', '10/07/2018', '10/10/2018', '10/1/2019'
+            , '10/01/2020', '10/1/2021', '10/1/2022', '10/1/2023', '10/1/2024', '10/1/2025', '10/1/2026', '10/01/2027'
+            , '10/01/2028']
+
+        # upward sloping spread curve
+        self.credit_spreads = [0.0040, 0.0045, 0.0055, 0.0065, 0.0075, 0.0085, 0.0095, 0.0100]
+
+        # economics of trade
+        self.recovery_rate = 0.40000
+        self.effective_date = '09/01/2018'
+        self.maturity_dates = ['20/12/2019', '20/06/2022', '20/12/2027']
+        self.accrual_start_dates = ['20/12/2017'] * 3
+        self.coupons = [100.0, 500.0, 100.0]
+        self.notionals = [10.0] * 3
+        self.is_buy_protection = [1, 0, 1]
+        self.verbose = 0
+
+        self.sdate = datetime.datetime(2018, 1, 8)
+        self.value_date = self.sdate.strftime('%d/%m/%Y')
+        self.imm_dates = [f[1] for f in imm_date_vector(
+            start_date=self.sdate, tenor_list=[0.5, 1, 2, 3, 4, 5, 7, 10])]
+
+        self.discount_handle, self.spread_handle = self.curve_handles(self.swap_rates)
+
+    def tearDown(self):
+        cds_release_curve_handle(self.spread_handle)
+        cds_release_curve_handle(self.discount_handle)
+
+    def curve_handles(self, swap_rates):
+        discount = cds_discount_curve_handle(self.value_date, swap_rates, self.swap_tenors,
+                                             self.swap_maturity_dates, self.verbose)
+        spread = cds_spread_curve_handle(self.value_date, self.effective_date, self.recovery_rate, discount,
+                                         self.credit_spreads, self.imm_dates, self.verbose)
+        return discount, spread
+
+    def bucketed_dv01(self):
+        return cds_bucketed_dv01(self.maturity_dates, self.accrual_start_dates, self.coupons, self.notionals,
+                                 self.is_buy_protection, self.spread_handle, self.verbose)
+
+    def price(self, spread_handle, t):
+        return cds_price_curve_handle(self.maturity_dates[t], self.accrual_start_dates[t], self.coupons[t],
+                                      self.notionals[t], self.is_buy_protection[t], spread_handle, self.verbose)
+
+    def test_single_tenor_bumps(self):
+        """ method to test each bucket against curves bootstrapped with that swap rate bumped """
+
+        f = self.bucketed_dv01()
+        self.assertEqual(len(self.maturity_dates) + 2, len(f))
+        self.assertEqual([1, 1, 1], list(f[-2]))
+        self.assertEqual(len(self.swap_rates), len(f[0]))
+
+        for k in [0, 5, 6, 9, 14]:
+            swap_rates = list(self.swap_rates)
+            swap_rates[k] += 0.0001
+            discount, spread = self.curve_handles(swap_rates)
+            for t in range(len(self.maturity_dates)):
+                self.assertAlmostEqual(self.price(spread, t)[0] - self.price(self.spread_handle, t)[0], f[t][k],
+                                       places=9)
+            cds_release_curve_handle(spread)
+            cds_release_curve_handle(discount)
+
+        # buckets add up to the parallel dv01 up to second order terms
+        for t in range(len(self.maturity_dates)):
+            parallel = self.price(self.spread_handle, t)[4]
+            self.assertAlmostEqual(1.0, sum(f[t]) / parallel, places=2)
+
+    def test_reuse(self):
+        """ method to test a second book on the same handle reuses the key rate curves """
+
+        f = self.bucketed_dv01()
+        g = cds_bucketed_dv01(self.maturity_dates[1:], self.accrual_start_dates[1:], self.coupons[1:],
+                              self.notionals[1:], self.is_buy_protection[1:], self.spread_handle, self.verbose)
+        self.assertEqual([list(r) for r in f[1:3]], [list(r) for r in g[:2]])
+
+    def test_bad_inputs(self):
+        """ method to test discount handles and ragged columns are reported through status """
+
+        f = cds_bucketed_dv01(self.maturity_dates, self.accrual_start_dates, self.coupons, self.notionals,
+                              self.is_buy_protection, self.discount_handle, self.verbose)
+        self.assertEqual([-1, -1, -1], list(f[-2]))
+
+        self.coupons = self.coupons[:2]
+        self.assertEqual([-1, -1, -1], list(self.bucketed_dv01()[-2]))
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,130 @@
+import array
+import datetime
+import threading
+import unittest
+
+from isda.isda import cds_index_all_in_one_parallel, cds_buffered, average
+from isda.imm import imm_date_vector
+
+try:
+    import numpy
+except ImportError:
+    numpy = None
+
+
+class MyTestCase(unittest.TestCase):
+    """
+        Testcase that passes rate vectors and spread matrices as buffers
+        (numpy arrays, array.array) instead of lists; results must be
+        identical to the list inputs, and buffer results asked for by one call
+        must hold the same values as the tuples returned by default.
+
+    """
+
+    __name__ = "MyTestCase"
+
+    def setUp(self):
+
+        # available from markit swap feed
+        self.swap_rates = [-0.00369, -0.00340, -0.00329, -0.00271, -0.00219, -0.00187, -0.00149, 0.000040, 0.00159,
+                           0.00303, 0.00435, 0.00559, 0.00675, 0.00785, 0.00887]
+        self.swap_tenors = ['1M', '2M', '3M', '6M', '9M', '1Y', '2Y', '3Y', '4Y', '5Y', '6Y', '7Y', '8Y', '9Y', '10Y']
+        self.swap_maturity_dates = ['12/02/2018', '12/03/2018', '10/04/2018', '10/07/2018', '10/10/2018', '10/01/2019'
+            , '10/01/2020', '10/01/2021', '10/01/2022', '10/01/2023', '10/01/2024', '10/01/2025', '10/01/2026'
+            , '10/01/2027', '10/01/2028']
+
+        # spread curve download from markit, 125 distinct names
+        self.credit_spreads = [0.84054, 0.58931, 0.40310, 0.33168, 0.30398, 0.28037, 0.25337, 0.23090]
+        self.credit_spread_list = [[s * (1.0 + i / 125.0) for s in self.credit_spreads] for i in range(125)]
+        self.credit_spread_tenors = ['6M', '1Y', '2Y', '3Y', '4Y', '5Y', '7Y', '10Y']
+        self.recovery_rate_list = [0.55] * 125
+
+        # economics of trade
+        self.coupon = 100.0
+        self.trade_date = '12/12/2014'
+        self.effective_date = '13/12/2014'
+        self.accrual_start_date = '20/9/2014'
+        self.maturity_date = '20/12/2019'
+        self.notional = 70.0
+        self.is_buy_protection = 0
+        self.verbose = 0
+
+        self.value_date = datetime.datetime(2018, 1, 8).strftime('%d/%m/%Y')
+        self.imm_dates = [f[1] for f in imm_date_vector(
+            start_date=datetime.datetime(2018, 1, 8), tenor_list=[0.5, 1, 2, 3, 4, 5, 7, 10])]
+
+    def price_index(self, recovery_rates, swap_rates, credit_spreads, call=lambda function, *args: function(*args)):
+        return call(cds_index_all_in_one_parallel, self.trade_date, self.effective_date, self.maturity_date,
+                                             self.value_date, self.accrual_start_date, recovery_rates, self.coupon,
+                                             self.notional, self.is_buy_protection, swap_rates, self.swap_tenors,
+                                             self.swap_maturity_dates, credit_spreads, self.credit_spread_tenors,
+                                             [], self.imm_dates, [], 1, self.verbose)
+
+    def test_numpy_inputs(self):
+        """ method to test numpy vectors and matrices price exactly like lists """
+
+        if numpy is None:
+            self.skipTest("numpy is not installed")
+
+        f = self.price_index(self.recovery_rate_list, self.swap_rates, self.credit_spread_list)
+        g = self.price_index(numpy.array(self.recovery_rate_list), numpy.array(self.swap_rates),
+                             numpy.array(self.credit_spread_list))
+
+        self.assertEqual(list(f[0]), list(g[0]))
+        self.assertEqual(list(f[1][:3]), list(g[1][:3]))
+
+        # strided views are not contiguous and convert element by element
+        h = self.price_index(self.recovery_rate_list, numpy.repeat(self.swap_rates, 2)[::2],
+                             numpy.repeat(self.credit_spread_list, 2, axis=1)[:, ::2])
+        self.assertEqual(list(f[0]), list(h[0]))
+
+    def test_array_inputs(self):
+        """ method to test array.array vectors price exactly like lists """
+
+        f = self.price_index(self.recovery_rate_list, self.swap_rates, self.credit_spread_list)
+        g = self.price_index(array.array('d', self.recovery_rate_list), array.array('d', self.swap_rates),
+                             [array.array('d', row) for row in self.credit_spread_list])
+
+        self.assertEqual(list(f[0]), list(g[0]))
+        self.assertEqual(list(f[1][:3]), list(g[1][:3]))
+
+    def test_buffer_results(self):
+        """ method to test buffer results hold the values of the default tuples """
+
+        f = self.price_index(self.recovery_rate_list, self.swap_rates, self.credit_spread_list)
+        g = self.price_index(self.recovery_rate_list, self.swap_rates, self.credit_spread_list, cds_buffered)
+
+        self.assertIsInstance(f[0], tuple)
+        self.assertIsInstance(g[0], array.array)
+        self.assertEqual(list(f[0]), g[0].tolist())
+        self.assertEqual(list(f[1][:3]), g[1].tolist()[:3])
+        self.assertEqual(array.array('d', [1.5, 3.5]), cds_buffered(average, [[1.0, 2.0], [3.0, 4.0]]))
+        self.assertEqual(array.array('d'), cds_buffered(average, []))
+
+        # only the buffered call itself returns arrays
+        self.assertIsInstance(average([[1.0, 2.0]]), tuple)
+        with self.assertRaises(TypeError):
+            cds_buffered()
+
+    def test_buffer_results_per_thread(self):
+        """ method to test a buffered call on one thread leaves calls on other threads returning tuples """
+
+        results = {}
+
+        def price(key, call):
+            results[key] = [type(self.price_index(self.recovery_rate_list, self.swap_rates,
+                                                  self.credit_spread_list, call)[0]) for _ in range(5)]
+
+        threads = [threading.Thread(target=price, args=('tuple', lambda function, *args: function(*args))),
+                   threading.Thread(target=price, args=('buffer', cds_buffered))]
+        for thread in threads:
+            thread.start()
+        for thread in threads:
+            thread.join()
+
+        self.assertEqual([tuple] * 5, results['tuple'])
+        self.assertEqual([array.array] * 5, results['buffer'])
+
+
+if __name__ == '__main__':
+    unittest.main()
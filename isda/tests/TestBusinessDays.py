@@ -0,0 +1,141 @@
+import ctypes
+import unittest
+
+from isda import isda
+from isda.isda import cds_yyyymmdd_to_dates
+
+SUCCESS = 0
+JPMCDS_WEEKEND_MONDAY = 0x0001
+JPMCDS_WEEKEND_FRIDAY = 0x0010
+JPMCDS_WEEKEND_SATURDAY = 0x0020
+JPMCDS_WEEKEND_SUNDAY = 0x0040
+JPMCDS_WEEKEND_NO_WEEKENDS = 0x0000
+JPMCDS_WEEKEND_STANDARD = JPMCDS_WEEKEND_SATURDAY | JPMCDS_WEEKEND_SUNDAY
+
+
+class TDateList(ctypes.Structure):
+    _fields_ = [('fNumItems', ctypes.c_int), ('fArray', ctypes.POINTER(ctypes.c_long))]
+
+
+class THolidayList(ctypes.Structure):
+    _fields_ = [('dateList', ctypes.POINTER(TDateList)), ('weekends', ctypes.c_long), ('busDays', ctypes.c_void_p),
+                ('nbRefs', ctypes.c_long)]
+
+
+class MyTestCase(unittest.TestCase):
+    """
+        Testcase that checks the compiled business day calendar of a holiday
+        list against the date list it was compiled from: every function is
+        called with the list and with a copy of it that has no calendar.
+
+    """
+
+    __name__ = "MyTestCase"
+
+    def setUp(self):
+
+        self.lib = ctypes.CDLL(isda._isda.__file__)
+        holiday_list = ctypes.POINTER(THolidayList)
+        self.lib.JpmcdsNewDateListFromDates.restype = ctypes.POINTER(TDateList)
+        self.lib.JpmcdsNewDateListFromDates.argtypes = [ctypes.POINTER(ctypes.c_long), ctypes.c_int]
+        self.lib.JpmcdsFreeDateList.argtypes = [ctypes.POINTER(TDateList)]
+        self.lib.JpmcdsHolidayListNewGeneral.restype = holiday_list
+        self.lib.JpmcdsHolidayListNewGeneral.argtypes = [ctypes.POINTER(TDateList), ctypes.c_long]
+        self.lib.JpmcdsHolidayListDelete.argtypes = [holiday_list]
+        self.lib.JpmcdsHolidayListIsBusinessDay.argtypes = [ctypes.c_long, holiday_list,
+                                                            ctypes.POINTER(ctypes.c_int)]
+        for name in ['JpmcdsHolidayListBusinessDay', 'JpmcdsHolidayListBusinessDaysDiff',
+                     'JpmcdsHolidayListAddBusinessDays']:
+            getattr(self.lib, name).argtypes = [ctypes.c_long, ctypes.c_long, holiday_list,
+                                                ctypes.POINTER(ctypes.c_long)]
+
+        # the calendar covers 1950 to 2150, and the second list extends it to
+        # its first and last holidays; dates it does not cover use the date list
+        self.holiday_sets = [cds_yyyymmdd_to_dates([19500102, 19500103, 20180101, 20180102, 20180330, 21501230,
+                                                    21501231]),
+                             cds_yyyymmdd_to_dates([19451225, 19491230, 19500102, 19500103, 20180101, 20180102,
+                                                    20180330, 21501230, 21501231, 21510102, 21600104])]
+        self.centres = cds_yyyymmdd_to_dates([19300101, 19451225, 19500101, 20180101, 21501231, 21600104,
+                                              21700101])
+
+        self.weekends = [JPMCDS_WEEKEND_STANDARD, JPMCDS_WEEKEND_NO_WEEKENDS,
+                         JPMCDS_WEEKEND_FRIDAY | JPMCDS_WEEKEND_SATURDAY, JPMCDS_WEEKEND_SUNDAY,
+                         JPMCDS_WEEKEND_FRIDAY, JPMCDS_WEEKEND_MONDAY | JPMCDS_WEEKEND_SATURDAY]
+
+    def holiday_lists(self):
+        """ the compiled holiday lists and copies of them that only have the date list """
+
+        for holidays in self.holiday_sets:
+            for weekends in self.weekends:
+                yield self.holiday_list(holidays, weekends)
+
+    def holiday_list(self, holidays, weekends):
+
+        dates = self.lib.JpmcdsNewDateListFromDates((ctypes.c_long * len(holidays))(*holidays), len(holidays))
+        compiled = self.lib.JpmcdsHolidayListNewGeneral(dates, weekends)
+        self.lib.JpmcdsFreeDateList(dates)
+        self.assertTrue(compiled)
+        self.assertTrue(compiled.contents.busDays)
+        self.addCleanup(self.lib.JpmcdsHolidayListDelete, compiled)
+
+        date_list = THolidayList(compiled.contents.dateList, compiled.contents.weekends, None, 1)
+        return compiled, ctypes.pointer(date_list)
+
+    def call(self, name, *args):
+
+        result = ctypes.c_long()
+        status = getattr(self.lib, name)(*args, ctypes.byref(result))
+        return status, result.value
+
+    def is_business_day(self, date, hl):
+
+        result = ctypes.c_int()
+        status = self.lib.JpmcdsHolidayListIsBusinessDay(date, hl, ctypes.byref(result))
+        return status, result.value
+
+    def test_is_business_day(self):
+        """ method to test business days and the next and previous business days """
+
+        for compiled, date_list in self.holiday_lists():
+            for centre in self.centres:
+                for date in range(centre - 20, centre + 21):
+                    expected = self.is_business_day(date, date_list)
+                    self.assertEqual(SUCCESS, expected[0])
+                    self.assertEqual(expected, self.is_business_day(date, compiled))
+                    for bad_day_conv in [b'F', b'P', b'M']:
+                        expected = self.call('JpmcdsHolidayListBusinessDay', date, ord(bad_day_conv), date_list)
+                        self.assertEqual(SUCCESS, expected[0])
+                        self.assertEqual(expected,
+                                         self.call('JpmcdsHolidayListBusinessDay', date, ord(bad_day_conv),
+                                                   compiled))
+
+    def test_business_days_diff(self):
+        """ method to test business days between dates on either side of the calendar edges """
+
+        for compiled, date_list in self.holiday_lists():
+            for centre in self.centres:
+                for from_date in range(centre - 20, centre + 21):
+                    for to_date in range(centre - 25, centre + 26, 3):
+                        expected = self.call('JpmcdsHolidayListBusinessDaysDiff', from_date, to_date, date_list)
+                        self.assertEqual(SUCCESS, expected[0])
+                        self.assertEqual(expected,
+                                         self.call('JpmcdsHolidayListBusinessDaysDiff', from_date, to_date,
+                                                   compiled))
+
+    def test_add_business_days(self):
+        """ method to test positive and negative business day offsets across the calendar edges """
+
+        offsets = list(range(-12, 13)) + [-40, 40, -300, 300]
+        for compiled, date_list in self.holiday_lists():
+            for centre in self.centres:
+                for from_date in range(centre - 20, centre + 21):
+                    for offset in offsets:
+                        expected = self.call('JpmcdsHolidayListAddBusinessDays', from_date, offset, date_list)
+                        self.assertEqual(SUCCESS, expected[0])
+                        self.assertEqual(expected,
+                                         self.call('JpmcdsHolidayListAddBusinessDays', from_date, offset,
+                                                   compiled))
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -1,7 +1,7 @@
 import unittest
 import datetime
 
-from isda.isda import cds_index_all_in_one, average
+from isda.isda import cds_index_all_in_one, cds_index_all_in_one_parallel, average
 from isda.imm import imm_date_vector
 
 class MyTestCase(unittest.TestCase):
@@ -98,6 +98,32 @@ class MyTestCase(unittest.TestCase):
         a = [wall_time_list]
         print("average execution {0}".format(average(a)))
 
+    def test_sell_protection_index_parallel(self):
+        """ method to test threaded constituent pricing matches the serial index exactly """
+
+        self.sdate = datetime.datetime(2018, 1, 8)
+        self.value_date = self.sdate.strftime('%d/%m/%Y')
+        self.is_buy_protection = 0
+
+        # simulate an index with 125 distinct names
+        self.credit_spread_list = [[s * (1.0 + i / 125.0) for s in self.credit_spreads] for i in range(125)]
+        self.recovery_rate_list = [self.recovery_rate]*125
+
+        self.imm_dates = [f[1] for f in imm_date_vector(
+            start_date=self.sdate, tenor_list=self.tenor_list)]
+
+        args = [self.trade_date, self.effective_date, self.maturity_date, self.value_date, self.accrual_start_date,
+                self.recovery_rate_list, self.coupon, self.notional, self.is_buy_protection, self.swap_rates,
+                self.swap_tenors, self.swap_maturity_dates, self.credit_spread_list, self.credit_spread_tenors,
+                self.spread_roll_tenors, self.imm_dates, self.scenario_shifts]
+
+        f = cds_index_all_in_one(*(args + [self.verbose]))
+
+        for number_of_threads in [1, 2, 4, 0]:
+            g = cds_index_all_in_one_parallel(*(args + [number_of_threads, self.verbose]))
+            self.assertEqual(list(f[0]), list(g[0]))
+            self.assertEqual(list(f[1][:3]), list(g[1][:3]))
+
 
 if __name__ == '__main__':
     unittest.main()
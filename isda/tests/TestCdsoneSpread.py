@@ -0,0 +1,135 @@
+import ctypes
+import unittest
+
+from isda import isda
+from isda.isda import cds_yyyymmdd_to_dates
+
+JPMCDS_ACT_365F = 2
+JPMCDS_ACT_360 = 3
+SUCCESS = 0
+
+
+class TRatePt(ctypes.Structure):
+    _fields_ = [('fDate', ctypes.c_long), ('fRate', ctypes.c_double)]
+
+
+class TCurve(ctypes.Structure):
+    _fields_ = [('fNumItems', ctypes.c_int), ('fArray', ctypes.POINTER(TRatePt)), ('fBaseDate', ctypes.c_long),
+                ('fBasis', ctypes.c_double), ('fDayCountConv', ctypes.c_long)]
+
+
+class TStubMethod(ctypes.Structure):
+    _fields_ = [('stubAtEnd', ctypes.c_int), ('longStub', ctypes.c_int)]
+
+
+class TDateInterval(ctypes.Structure):
+    _fields_ = [('prd', ctypes.c_int), ('prd_typ', ctypes.c_char), ('flag', ctypes.c_int)]
+
+
+class MyTestCase(unittest.TestCase):
+    """
+        Testcase that solves the flat spread of an upfront charge with the
+        flat hazard root-find of JpmcdsCdsoneSpreadFlatHazard and with the
+        original JpmcdsCdsoneSpread, called directly from the extension
+        library.
+
+    """
+
+    __name__ = "MyTestCase"
+
+    def setUp(self):
+
+        self.lib = ctypes.CDLL(isda._isda.__file__)
+        self.lib.JpmcdsMakeTCurve.restype = ctypes.POINTER(TCurve)
+        self.lib.JpmcdsMakeTCurve.argtypes = [ctypes.c_long, ctypes.POINTER(ctypes.c_long),
+                                              ctypes.POINTER(ctypes.c_double), ctypes.c_int, ctypes.c_double,
+                                              ctypes.c_long]
+        self.lib.JpmcdsFreeTCurve.argtypes = [ctypes.POINTER(TCurve)]
+
+        trade_args = [ctypes.c_long, ctypes.c_long, ctypes.c_long, ctypes.c_long, ctypes.c_long, ctypes.c_long,
+                      ctypes.c_double, ctypes.c_int, ctypes.POINTER(TDateInterval), ctypes.POINTER(TStubMethod),
+                      ctypes.c_long, ctypes.c_long, ctypes.c_char_p, ctypes.POINTER(TCurve), ctypes.c_double,
+                      ctypes.c_double, ctypes.c_int]
+        self.lib.JpmcdsCdsoneSpread.argtypes = trade_args + [ctypes.POINTER(ctypes.c_double)]
+        self.lib.JpmcdsCdsoneSpreadFlatHazard.argtypes = trade_args + [ctypes.c_double,
+                                                                       ctypes.POINTER(ctypes.c_double)]
+
+        self.today = cds_yyyymmdd_to_dates([20180108])[0]
+        self.accrual_start = cds_yyyymmdd_to_dates([20171220])[0]
+        zero_dates = cds_yyyymmdd_to_dates([20190108, 20200108, 20230108, 20280108])
+        zero_rates = [0.01, 0.012, 0.015, 0.02]
+        self.discount_curve = self.lib.JpmcdsMakeTCurve(self.today, (ctypes.c_long * 4)(*zero_dates),
+                                                        (ctypes.c_double * 4)(*zero_rates), 4, 1.0,
+                                                        JPMCDS_ACT_365F)
+
+        self.coupon_interval = TDateInterval(3, b'M', 0)
+        self.stub = TStubMethod(0, 0)
+
+    def tearDown(self):
+
+        self.lib.JpmcdsFreeTCurve(self.discount_curve)
+
+    def trade_args(self, end_date, coupon_rate, upfront_charge, recovery_rate, is_clean):
+
+        return [self.today, self.today + 3, self.accrual_start, self.today + 1, self.accrual_start, end_date,
+                coupon_rate, 1, ctypes.byref(self.coupon_interval), ctypes.byref(self.stub), JPMCDS_ACT_360,
+                ord('F'), b'None', self.discount_curve, upfront_charge, recovery_rate, is_clean]
+
+    def cdsone_spread(self, *args):
+
+        spread = ctypes.c_double()
+        status = self.lib.JpmcdsCdsoneSpread(*self.trade_args(*args), ctypes.byref(spread))
+        return status, spread.value
+
+    def flat_hazard_spread(self, *args, guess=0.0):
+
+        spread = ctypes.c_double()
+        status = self.lib.JpmcdsCdsoneSpreadFlatHazard(*self.trade_args(*args), guess, ctypes.byref(spread))
+        return status, spread.value
+
+    def test_flat_hazard_matches_cdsone_spread(self):
+        """ method to test the flat hazard spread over a grid of maturities, coupons, recoveries and upfronts """
+
+        solved = 0
+        for end_date in cds_yyyymmdd_to_dates([20191220, 20221220, 20271220]):
+            for coupon_rate in [0.01, 0.05]:
+                for recovery_rate in [0.2, 0.4, 0.7]:
+                    for upfront_charge in [-0.1, -0.03, 0.0, 0.02, 0.1, 0.3]:
+                        for is_clean in [0, 1]:
+                            args = (end_date, coupon_rate, upfront_charge, recovery_rate, is_clean)
+                            expected = self.cdsone_spread(*args)
+                            actual = self.flat_hazard_spread(*args)
+
+                            # upfronts beyond the bounds of either solver fail in both
+                            self.assertEqual(expected[0], actual[0])
+                            if expected[0] == SUCCESS:
+                                self.assertAlmostEqual(expected[1], actual[1], delta=2e-12)
+                                solved += 1
+
+        self.assertGreater(solved, 150)
+
+    def test_flat_hazard_falls_back_to_brent(self):
+        """ method to test upfronts where newton leaves its bounds and brent finishes the solve """
+
+        end_date = cds_yyyymmdd_to_dates([20191220])[0]
+
+        # a 10% upfront received on a 500bp coupon is a spread of under 2bp, the
+        # newton step from the coupon goes below a zero hazard rate
+        args = (end_date, 0.05, -0.1, 0.4, 0)
+        expected = self.cdsone_spread(*args)
+        actual = self.flat_hazard_spread(*args)
+        self.assertEqual(SUCCESS, expected[0])
+        self.assertLess(expected[1], 0.0002)
+        self.assertEqual(SUCCESS, actual[0])
+        self.assertAlmostEqual(expected[1], actual[1], delta=2e-12)
+
+        # a 90% starting spread overshoots in the same way
+        args = (end_date, 0.01, 0.02, 0.4, 0)
+        expected = self.cdsone_spread(*args)
+        actual = self.flat_hazard_spread(*args, guess=0.9)
+        self.assertEqual(SUCCESS, actual[0])
+        self.assertAlmostEqual(expected[1], actual[1], delta=2e-12)
+
+
+if __name__ == '__main__':
+    unittest.main()
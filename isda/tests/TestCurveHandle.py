@@ -0,0 +1,141 @@
+import unittest
+import datetime
+
+from isda.isda import cds_all_in_one, cds_discount_curve_handle, cds_spread_curve_handle, \
+    cds_price_curve_handle, cds_release_curve_handle
+from isda.imm import imm_date_vector
+
+
+class MyTestCase(unittest.TestCase):
+    """
+        Testcase that prices trades against curves bootstrapped once and held
+        behind a handle; results must reconcile with cds_all_in_one, which
+        rebuilds the same curves on every call.
+
+    """
+
+    __name__ = "MyTestCase"
+
+    def setUp(self):
+
+        # available from markit swap feed
+        self.swap_rates = [-0.00369, -0.00340, -0.00329, -0.00271, -0.00219, -0.00187, -0.00149, 0.000040, 0.00159,
+                           0.00303, 0.00435, 0.00559, 0.00675, 0.00785, 0.00887]
+        self.swap_tenors = ['1M', '2M', '3M', '6M', '9M', '1Y', '2Y', '3Y', '4Y', '5Y', '6Y', '7Y', '8Y', '9Y', '10Y']
+        self.swap_maturity_dates = ['12/2/2018', '12/3/2018', '10/4/2018', '10/07/2018', '10/10/2018', '10/1/2019'
+            , '10/01/2020', '10/1/2021', '10/1/2022', '10/1/2023', '10/1/2024', '10/1/2025', '10/1/2026', '10/01/2027'
+            , '10/01/2028']
+
+        # spread curve download from markit
+        self.credit_spreads = [0.00137467867844589]*8
+        self.credit_spread_tenors = ['6M', '1Y', '2Y', '3Y', '4Y', '5Y', '7Y', '10Y']
+
+        # economics of trade
+        self.recovery_rate = 0.40000
+        self.coupon = 100.0
+        self.trade_date = '12/12/2014'
+        self.effective_date = '13/12/2014'
+        self.accrual_start_date = '20/9/2014'
+        self.maturity_date = '20/12/2019'
+        self.notional = 70.0
+        self.is_buy_protection = 1
+        self.verbose = 0
+
+        self.tenor_list = [0.5, 1, 2, 3, 4, 5, 7, 10]
+        self.sdate = datetime.datetime(2018, 1, 8)
+        self.value_date = self.sdate.strftime('%d/%m/%Y')
+        self.imm_dates = [f[1] for f in imm_date_vector(
+            start_date=self.sdate, tenor_list=self.tenor_list)]
+
+        self.discount_handle = cds_discount_curve_handle(self.value_date,
+                                                         self.swap_rates,
+                                                         self.swap_tenors,
+                                                         self.swap_maturity_dates,
+                                                         self.verbose)
+
+        self.spread_handle = cds_spread_curve_handle(self.value_date,
+                                                     self.effective_date,
+                                                     self.recovery_rate,
+                                                     self.discount_handle,
+                                                     self.credit_spreads,
+                                                     self.imm_dates,
+                                                     self.verbose)
+
+    def tearDown(self):
+        cds_release_curve_handle(self.spread_handle)
+        cds_release_curve_handle(self.discount_handle)
+
+    def test_buy_protection(self):
+        """ method to test buy protection single name CDS against curve handles """
+
+        pv_dirty, pv_clean, ai, cs01, dv01, status, duration = cds_price_curve_handle(self.maturity_date,
+                                                                                       self.accrual_start_date,
+                                                                                       self.coupon,
+                                                                                       self.notional,
+                                                                                       self.is_buy_protection,
+                                                                                       self.spread_handle,
+                                                                                       self.verbose)
+
+        self.assertEqual(1, status)
+        self.assertAlmostEqual(-1.23099324435, pv_dirty)
+        self.assertAlmostEqual(-1.19210435546, pv_clean)
+        self.assertAlmostEqual(0.0388888888889, ai)
+        self.assertAlmostEqual(14014.5916905, cs01 * 1.0e6)
+        self.assertAlmostEqual(131.61798715, dv01 * 1.0e6)
+
+    def test_reconcile_all_in_one(self):
+        """ method to test many trades on one handle reconcile with cds_all_in_one """
+
+        for maturity_date in ['20/12/2019', '20/06/2020', '20/12/2022']:
+            for is_buy_protection in [0, 1]:
+                f = cds_all_in_one(self.trade_date,
+                                   self.effective_date,
+                                   maturity_date,
+                                   self.value_date,
+                                   self.accrual_start_date,
+                                   self.recovery_rate,
+                                   self.coupon,
+                                   self.notional,
+                                   is_buy_protection,
+                                   self.swap_rates,
+                                   self.swap_tenors,
+                                   self.swap_maturity_dates,
+                                   self.credit_spreads,
+                                   self.credit_spread_tenors,
+                                   [],
+                                   self.imm_dates,
+                                   [],
+                                   self.verbose)
+
+                g = cds_price_curve_handle(maturity_date,
+                                           self.accrual_start_date,
+                                           self.coupon,
+                                           self.notional,
+                                           is_buy_protection,
+                                           self.spread_handle,
+                                           self.verbose)
+
+                for expected, actual in zip(f[0][:5], g[:5]):
+                    self.assertAlmostEqual(expected, actual)
+
+    def test_bad_handle(self):
+        """ method to test unknown and released handles are reported through status """
+
+        self.assertEqual(-1, cds_price_curve_handle(self.maturity_date, self.accrual_start_date, self.coupon,
+                                                    self.notional, self.is_buy_protection, -1, self.verbose)[5])
+
+        # a spread handle keeps its discount curve alive after the discount handle is released
+        self.assertEqual(1, cds_release_curve_handle(self.discount_handle))
+        self.assertEqual(-1, cds_release_curve_handle(self.discount_handle))
+        self.assertEqual(1, cds_price_curve_handle(self.maturity_date, self.accrual_start_date, self.coupon,
+                                                   self.notional, self.is_buy_protection, self.spread_handle,
+                                                   self.verbose)[5])
+
+        # a spread handle cannot stand in for a discount handle
+        self.assertEqual(-1, cds_spread_curve_handle(self.value_date, self.effective_date, self.recovery_rate,
+                                                     self.spread_handle, self.credit_spreads, self.imm_dates,
+                                                     self.verbose))
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,147 @@
+import os
+import resource
+import unittest
+import uuid
+
+from isda.isda import cds_coupon_schedule, cds_register_holidays, cds_evict_holidays, cds_holiday_cache_limit
+
+
+class MyTestCase(unittest.TestCase):
+    """
+        Testcase that registers holidays in memory under a name; schedules must
+        match those from a holiday file with the same dates, and the holiday
+        cache must honour eviction and its bound on holiday files.
+
+    """
+
+    __name__ = "MyTestCase"
+
+    def setUp(self):
+        self.accrual_start_date = '20/12/2017'
+        self.maturity_date = '20/12/2019'
+        self.coupon_interval = 'Q'
+        self.day_count_convention = 'Act/360'
+        self.stub_method = 'F'
+        self.coupon_rate = 1.0
+        self.notional = 1.0
+        self.verbose = 0
+
+        self.holiday_list = [16010101, 20180320, 20181220]
+        self.weekends = 96  # saturday and sunday
+        self.holiday_filenames = []
+
+    def tearDown(self):
+        for holiday_filename in self.holiday_filenames:
+            cds_evict_holidays(holiday_filename, self.verbose)
+            try:
+                os.remove(holiday_filename)
+            except OSError:
+                pass
+
+    def save_to_file(self, holiday_list):
+        holiday_filename = f'{uuid.uuid4()}.dat'
+        self.holiday_filenames.append(holiday_filename)
+        with open(holiday_filename, mode='wt', encoding='utf-8') as myfile:
+            myfile.write('\n'.join(str(line) for line in holiday_list))
+            myfile.write('\n')
+        return holiday_filename
+
+    def schedule(self, holiday_name):
+        return cds_coupon_schedule(self.accrual_start_date, self.maturity_date, self.coupon_interval,
+                                   self.day_count_convention, self.stub_method, holiday_name,
+                                   self.coupon_rate, self.notional, self.verbose)
+
+    def test_register_matches_file(self):
+        """ method to test registered holidays adjust payments exactly like a holiday file """
+
+        holiday_name = f'REGISTERED_{uuid.uuid4()}'
+        self.assertEqual(1, cds_register_holidays(holiday_name, self.holiday_list, self.weekends, self.verbose))
+
+        registered = self.schedule(holiday_name)
+        from_file = self.schedule(self.save_to_file(self.holiday_list))
+
+        self.assertEqual(list(from_file[1]), list(registered[1]))
+        self.assertEqual(list(from_file[2]), list(registered[2]))
+
+        # 20/03/2018 is a registered holiday, so the first payment rolls to the next day
+        self.assertEqual(21032018.0, registered[1][0])
+        self.assertEqual(20032018.0, self.schedule('NONE')[1][0])
+
+        self.assertEqual(1, cds_evict_holidays(holiday_name, self.verbose))
+
+    def test_evict(self):
+        """ method to test eviction by name, the standard calendars cannot be evicted """
+
+        holiday_name = f'REGISTERED_{uuid.uuid4()}'
+        self.assertEqual(1, cds_register_holidays(holiday_name, self.holiday_list, self.weekends, self.verbose))
+        self.assertEqual(1, cds_evict_holidays(holiday_name, self.verbose))
+        self.assertEqual(-1, cds_evict_holidays(holiday_name, self.verbose))
+        self.assertEqual(-1, cds_evict_holidays('NONE', self.verbose))
+        self.assertEqual(-1, cds_evict_holidays('NO_WEEKENDS', self.verbose))
+
+        # registering again replaces the calendar
+        self.assertEqual(1, cds_register_holidays(holiday_name, [20180321], self.weekends, self.verbose))
+        self.assertEqual(1, cds_register_holidays(holiday_name, self.holiday_list, self.weekends, self.verbose))
+        self.assertEqual(21032018.0, self.schedule(holiday_name)[1][0])
+        self.assertEqual(1, cds_evict_holidays(holiday_name, self.verbose))
+
+    def test_out_of_order(self):
+        """ method to test holidays must be in increasing order """
+
+        self.assertEqual(-1, cds_register_holidays('OUT_OF_ORDER', [20181220, 20180320], self.weekends,
+                                                   self.verbose))
+
+    def test_file_cache_limit(self):
+        """ method to test only the newest holiday files stay cached beyond the limit """
+
+        previous = cds_holiday_cache_limit(1)
+        try:
+            self.assertEqual(1, cds_holiday_cache_limit(-1))
+
+            holiday_name = f'REGISTERED_{uuid.uuid4()}'
+            self.assertEqual(1, cds_register_holidays(holiday_name, self.holiday_list, self.weekends, self.verbose))
+
+            first = self.save_to_file(self.holiday_list)
+            second = self.save_to_file(self.holiday_list)
+            self.schedule(first)
+            self.schedule(second)
+
+            # the first file was evicted when the second was loaded, registered names do not count
+            self.assertEqual(-1, cds_evict_holidays(first, self.verbose))
+            self.assertEqual(1, cds_evict_holidays(second, self.verbose))
+            self.assertEqual(1, cds_evict_holidays(holiday_name, self.verbose))
+        finally:
+            cds_holiday_cache_limit(previous)
+
+    def test_evicted_calendars_are_freed(self):
+        """ method to test registering, replacing and evicting calendars in a loop keeps memory bounded """
+
+        def cycle(count):
+            for _ in range(count):
+                holiday_name = f'REGISTERED_{uuid.uuid4()}'
+                cds_register_holidays(holiday_name, self.holiday_list, self.weekends, self.verbose)
+                self.schedule(holiday_name)
+                cds_register_holidays(holiday_name, self.holiday_list, self.weekends, self.verbose)
+                self.assertEqual(1, cds_evict_holidays(holiday_name, self.verbose))
+
+        previous = cds_holiday_cache_limit(1)
+        try:
+            cycle(200)
+            baseline = resource.getrusage(resource.RUSAGE_SELF).ru_maxrss
+
+            # every calendar carries a business day bitset of about 18KB, so keeping the
+            # 10000 lists built here would grow the peak by well over 100MB
+            cycle(5000)
+
+            # holiday files beyond the limit are evicted as the next one is loaded
+            for _ in range(50):
+                self.schedule(self.save_to_file(self.holiday_list))
+
+            growth_kb = resource.getrusage(resource.RUSAGE_SELF).ru_maxrss - baseline
+            self.assertLess(growth_kb, 16 * 1024)
+        finally:
+            cds_holiday_cache_limit(previous)
+
+
+if __name__ == '__main__':
+    unittest.main()
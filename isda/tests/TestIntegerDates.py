@@ -0,0 +1,309 @@
+import os
+import unittest
+import datetime
+import uuid
+
+from isda.isda import cds_all_in_one, cds_all_in_one_tdate, cds_coupon_schedule, cds_coupon_schedule_tdate, \
+    cds_discount_curve_handle_tdate, cds_spread_curve_handle_tdate, cds_price_curve_handle, \
+    cds_price_curve_handle_tdate, cds_portfolio_price, cds_portfolio_price_tdate, cds_release_curve_handle, \
+    cds_parse_dates, cds_yyyymmdd_to_dates, cds_dates_to_yyyymmdd, \
+    cds_all_in_one_exclude_ir_tenor_dates, cds_all_in_one_exclude_ir_tenor_dates_tdate, \
+    cds_index_all_in_one, cds_index_all_in_one_tdate, cds_index_all_in_one_parallel_tdate, \
+    compute_isda_upfront, compute_isda_upfront_tdate, compute_isda_upfront_vector, compute_isda_upfront_vector_tdate, \
+    calculate_spread_from_upfront_charge, calculate_spread_from_upfront_charge_tdate, \
+    calculate_spread_from_upfront_charge_vector, calculate_spread_from_upfront_charge_vector_tdate, \
+    cds_discount_rate_ir_tenor_dates, cds_discount_rate_ir_tenor_dates_tdate, \
+    cds_bucketed_dv01, cds_bucketed_dv01_tdate, cds_adjoint_risk, cds_adjoint_risk_tdate, \
+    cds_bucketed_cs01, cds_bucketed_cs01_tdate, cds_scenario_roll_grid, cds_scenario_roll_grid_tdate
+from isda.imm import imm_date_vector
+
+
+class MyTestCase(unittest.TestCase):
+    """
+        Testcase that the TDate entry points reconcile with the DD/MM/YYYY string
+        entry points they mirror, and that the bulk date conversions round trip.
+
+    """
+
+    __name__ = "MyTestCase"
+
+    def setUp(self):
+
+        # available from markit swap feed
+        self.swap_rates = [-0.00369, -0.00340, -0.00329, -0.00271, -0.00219, -0.00187, -0.00149, 0.000040, 0.00159,
+                           0.00303, 0.00435, 0.00559, 0.00675, 0.00785, 0.00887]
+        self.swap_tenors = ['1M', '2M', '3M', '6M', '9M', '1Y', '2Y', '3Y', '4Y', '5Y', '6Y', '7Y', '8Y', '9Y', '10Y']
+        self.swap_maturity_dates = ['12/2/2018', '12/3/2018', '10/4/2018', '10/07/2018', '10/10/2018', '10/1/2019'
+            , '10/01/2020', '10/1/2021', '10/1/2022', '10/1/2023', '10/1/2024', '10/1/2025', '10/1/2026', '10/01/2027'
+            , '10/01/2028']
+
+        # spread curve download from markit
+        self.credit_spreads = [0.00137467867844589]*8
+        self.credit_spread_tenors = ['6M', '1Y', '2Y', '3Y', '4Y', '5Y', '7Y', '10Y']
+        self.spread_roll_tenors = ['1D', '-1D', '-1W', '-1M', '-6M', '-1Y', '-5Y']
+        self.scenario_shifts = [-50, 0, 50]
+
+        # economics of trade
+        self.recovery_rate = 0.40000
+        self.coupon = 100.0
+        self.trade_date = '12/12/2014'
+        self.effective_date = '13/12/2014'
+        self.accrual_start_date = '20/9/2014'
+        self.maturity_date = '20/12/2019'
+        self.notional = 70.0
+        self.is_buy_protection = 1
+        self.verbose = 0
+
+        self.sdate = datetime.datetime(2018, 1, 8)
+        self.value_date = self.sdate.strftime('%d/%m/%Y')
+        self.imm_dates = [f[1] for f in imm_date_vector(
+            start_date=self.sdate, tenor_list=[0.5, 1, 2, 3, 4, 5, 7, 10])]
+
+    def test_parse_dates(self):
+        """ method to test the bulk parser against yyyymmdd conversion, both ways """
+
+        dates = cds_parse_dates(['20/12/2019', '1/2/2018', '29/02/2016', '31/02/2016'])
+        self.assertEqual(dates[:3], cds_yyyymmdd_to_dates([20191220, 20180201, 20160229]))
+        self.assertEqual([20191220, 20180201, 20160229], list(cds_dates_to_yyyymmdd(dates[:3])))
+        self.assertEqual(-1, dates[3])
+
+        # consecutive calendar days are consecutive TDates
+        self.assertEqual(1, dates[0] - cds_parse_dates(['19/12/2019'])[0])
+
+    def test_all_in_one(self):
+        """ method to test cds_all_in_one_tdate reconciles with cds_all_in_one """
+
+        f = cds_all_in_one(self.trade_date, self.effective_date, self.maturity_date, self.value_date,
+                           self.accrual_start_date, self.recovery_rate, self.coupon, self.notional,
+                           self.is_buy_protection, self.swap_rates, self.swap_tenors, self.swap_maturity_dates,
+                           self.credit_spreads, self.credit_spread_tenors, self.spread_roll_tenors, self.imm_dates,
+                           self.scenario_shifts, self.verbose)
+
+        trade_date, effective_date, maturity_date, value_date, accrual_start_date = cds_parse_dates(
+            [self.trade_date, self.effective_date, self.maturity_date, self.value_date, self.accrual_start_date])
+
+        g = cds_all_in_one_tdate(trade_date, effective_date, maturity_date, value_date, accrual_start_date,
+                                 self.recovery_rate, self.coupon, self.notional, self.is_buy_protection,
+                                 self.swap_rates, self.swap_tenors, cds_parse_dates(self.swap_maturity_dates),
+                                 self.credit_spreads, self.credit_spread_tenors, self.spread_roll_tenors,
+                                 cds_parse_dates(self.imm_dates), self.scenario_shifts, self.verbose)
+
+        self.assertEqual(len(f), len(g))
+        self.assertEqual(list(f[0][:5]), list(g[0][:5]))
+        self.assertEqual(list(f[1]), list(g[1]))
+        for expected, actual in zip(f[2:], g[2:]):
+            self.assertEqual(list(expected), list(actual))
+
+    def test_curve_handles(self):
+        """ method to test the TDate handle functions reconcile with the string ones """
+
+        value_date, effective_date = cds_parse_dates([self.value_date, self.effective_date])
+        discount_handle = cds_discount_curve_handle_tdate(value_date, self.swap_rates, self.swap_tenors,
+                                                          cds_parse_dates(self.swap_maturity_dates), self.verbose)
+        spread_handle = cds_spread_curve_handle_tdate(value_date, effective_date, self.recovery_rate,
+                                                      discount_handle, self.credit_spreads,
+                                                      cds_parse_dates(self.imm_dates), self.verbose)
+        try:
+            maturity_dates = ['20/12/2019', '20/06/2020', '20/12/2022']
+            f = cds_price_curve_handle(maturity_dates[0], self.accrual_start_date, self.coupon, self.notional,
+                                       self.is_buy_protection, spread_handle, self.verbose)
+            g = cds_price_curve_handle_tdate(cds_parse_dates(maturity_dates)[0],
+                                             cds_parse_dates([self.accrual_start_date])[0], self.coupon,
+                                             self.notional, self.is_buy_protection, spread_handle, self.verbose)
+            self.assertEqual(1, g[5])
+            self.assertEqual(list(f[:6]), list(g[:6]))
+            self.assertAlmostEqual(-1.23099324435, g[0])
+
+            n = len(maturity_dates)
+            f = cds_portfolio_price(maturity_dates, [self.accrual_start_date] * n, [self.coupon] * n,
+                                    [self.notional] * n, [0, 1, 0], [0] * n, [spread_handle], self.verbose)
+            g = cds_portfolio_price_tdate(cds_parse_dates(maturity_dates),
+                                          cds_parse_dates([self.accrual_start_date] * n), [self.coupon] * n,
+                                          [self.notional] * n, [0, 1, 0], [0] * n, [spread_handle], self.verbose)
+            for expected, actual in zip(f[:6], g[:6]):
+                self.assertEqual(list(expected), list(actual))
+        finally:
+            cds_release_curve_handle(spread_handle)
+            cds_release_curve_handle(discount_handle)
+
+    def assertGridEqual(self, f, g):
+        self.assertEqual(len(f), len(g))
+        for expected, actual in zip(f, g):
+            self.assertEqual(list(expected), list(actual))
+
+    def test_all_in_one_exclude_ir_tenor_dates(self):
+        """ method to test cds_all_in_one_exclude_ir_tenor_dates_tdate reconciles with the string form """
+
+        f = cds_all_in_one_exclude_ir_tenor_dates(self.trade_date, self.effective_date, self.maturity_date,
+                                                  self.value_date, self.accrual_start_date, self.recovery_rate,
+                                                  self.coupon, self.notional, self.is_buy_protection,
+                                                  self.swap_rates, self.swap_tenors, self.credit_spreads,
+                                                  self.credit_spread_tenors, self.spread_roll_tenors,
+                                                  self.imm_dates, self.scenario_shifts, self.verbose)
+
+        trade_date, effective_date, maturity_date, value_date, accrual_start_date = cds_parse_dates(
+            [self.trade_date, self.effective_date, self.maturity_date, self.value_date, self.accrual_start_date])
+
+        g = cds_all_in_one_exclude_ir_tenor_dates_tdate(trade_date, effective_date, maturity_date, value_date,
+                                                        accrual_start_date, self.recovery_rate, self.coupon,
+                                                        self.notional, self.is_buy_protection, self.swap_rates,
+                                                        self.swap_tenors, self.credit_spreads,
+                                                        self.credit_spread_tenors, self.spread_roll_tenors,
+                                                        cds_parse_dates(self.imm_dates), self.scenario_shifts,
+                                                        self.verbose)
+
+        self.assertEqual(len(f), len(g))
+        self.assertEqual(list(f[0][:5]), list(g[0][:5]))
+        self.assertGridEqual(f[1:], g[1:])
+
+    def test_index_all_in_one(self):
+        """ method to test the TDate index functions reconcile with cds_index_all_in_one """
+
+        recovery_rates = [self.recovery_rate, 0.25, 0.3]
+        spread_rates = [self.credit_spreads, [s * 2 for s in self.credit_spreads], [s * 3 for s in self.credit_spreads]]
+
+        f = cds_index_all_in_one(self.trade_date, self.effective_date, self.maturity_date, self.value_date,
+                                 self.accrual_start_date, recovery_rates, self.coupon, self.notional,
+                                 self.is_buy_protection, self.swap_rates, self.swap_tenors, self.swap_maturity_dates,
+                                 spread_rates, self.credit_spread_tenors, self.spread_roll_tenors, self.imm_dates,
+                                 self.scenario_shifts, self.verbose)
+
+        dates = cds_parse_dates(
+            [self.trade_date, self.effective_date, self.maturity_date, self.value_date, self.accrual_start_date])
+        args = list(dates) + [recovery_rates, self.coupon, self.notional, self.is_buy_protection, self.swap_rates,
+                        self.swap_tenors, cds_parse_dates(self.swap_maturity_dates), spread_rates,
+                        self.credit_spread_tenors, self.spread_roll_tenors, cds_parse_dates(self.imm_dates),
+                        self.scenario_shifts]
+
+        g = cds_index_all_in_one_tdate(*(args + [self.verbose]))
+        self.assertEqual(list(f[0]), list(g[0]))
+        self.assertEqual(list(f[1][:3]), list(g[1][:3]))
+
+        for number_of_threads in [1, 4]:
+            g = cds_index_all_in_one_parallel_tdate(*(args + [number_of_threads, self.verbose]))
+            self.assertEqual(list(f[0]), list(g[0]))
+            self.assertEqual(list(f[1][:3]), list(g[1][:3]))
+
+    def test_upfront(self):
+        """ method to test the TDate upfront and spread from upfront functions reconcile with the string ones """
+
+        holiday_filename = f'{uuid.uuid4()}.dat'
+        with open(holiday_filename, mode='wt', encoding='utf-8') as holiday_file:
+            holiday_file.write('16010101\n20180320\n')
+        try:
+            trade_date, settle_date, accrual_start_date = '10/10/2022', '13/10/2022', '20/09/2022'
+            maturity_dates = ['20/12/2023', '20/12/2027', '20/12/2032']
+            coupon_rates, recovery_rates, par_spreads = [100.0, 500.0, 100.0], [0.4, 0.25, 0.4], [0.0035, 0.08, 0.011]
+            curve_args = [self.swap_rates, self.swap_tenors, 1, holiday_filename, 'ACT/360', 'ACT/360', '1Y', '1Y']
+            trade_tdate, settle_tdate, accrual_start_tdate = cds_parse_dates(
+                [trade_date, settle_date, accrual_start_date])
+
+            f = compute_isda_upfront(trade_date, maturity_dates[0], accrual_start_date, settle_date,
+                                     recovery_rates[0], coupon_rates[0], 1.0, 0, self.swap_rates, self.swap_tenors,
+                                     par_spreads[0], *(curve_args[2:] + [self.verbose]))
+            g = compute_isda_upfront_tdate(trade_tdate, cds_parse_dates(maturity_dates)[0], accrual_start_tdate,
+                                           settle_tdate, recovery_rates[0], coupon_rates[0], 1.0, 0,
+                                           self.swap_rates, self.swap_tenors, par_spreads[0],
+                                           *(curve_args[2:] + [self.verbose]))
+            self.assertEqual(list(f[:4]), list(g[:4]))
+
+            f = calculate_spread_from_upfront_charge(trade_date, maturity_dates[0], accrual_start_date, settle_date,
+                                                     recovery_rates[0], coupon_rates[0], 1.0, 0, self.swap_rates,
+                                                     self.swap_tenors, g[0], 1, 0,
+                                                     *(curve_args[3:] + [self.verbose]))
+            g = calculate_spread_from_upfront_charge_tdate(trade_tdate, cds_parse_dates(maturity_dates)[0],
+                                                           accrual_start_tdate, settle_tdate, recovery_rates[0],
+                                                           coupon_rates[0], 1.0, 0, self.swap_rates,
+                                                           self.swap_tenors, g[0], 1, 0,
+                                                           *(curve_args[3:] + [self.verbose]))
+            self.assertEqual(list(f[:2]), list(g[:2]))
+
+            f = compute_isda_upfront_vector(trade_date, accrual_start_date, settle_date, maturity_dates,
+                                            coupon_rates, recovery_rates, par_spreads, *curve_args, 2, self.verbose)
+            g = compute_isda_upfront_vector_tdate(trade_tdate, accrual_start_tdate, settle_tdate,
+                                                  cds_parse_dates(maturity_dates), coupon_rates, recovery_rates,
+                                                  par_spreads, *curve_args, 2, self.verbose)
+            self.assertGridEqual(f[:4], g[:4])
+
+            f = calculate_spread_from_upfront_charge_vector(trade_date, accrual_start_date, settle_date,
+                                                            maturity_dates, coupon_rates, recovery_rates, g[0], [],
+                                                            0, *curve_args, 2, self.verbose)
+            g = calculate_spread_from_upfront_charge_vector_tdate(trade_tdate, accrual_start_tdate, settle_tdate,
+                                                                  cds_parse_dates(maturity_dates), coupon_rates,
+                                                                  recovery_rates, g[0], [], 0, *curve_args, 2,
+                                                                  self.verbose)
+            self.assertGridEqual(f[:2], g[:2])
+            for expected, actual in zip(par_spreads, g[0]):
+                self.assertAlmostEqual(expected, actual)
+        finally:
+            os.remove(holiday_filename)
+
+    def test_discount_rate_ir_tenor_dates(self):
+        """ method to test cds_discount_rate_ir_tenor_dates_tdate reconciles with the string form """
+
+        value_dates = ['08/01/2019', '08/01/2020', '08/01/2023', '08/01/2028']
+        f = cds_discount_rate_ir_tenor_dates(self.value_date, value_dates, self.swap_rates, self.swap_tenors,
+                                             self.verbose)
+        g = cds_discount_rate_ir_tenor_dates_tdate(cds_parse_dates([self.value_date])[0],
+                                                   cds_parse_dates(value_dates), self.swap_rates,
+                                                   self.swap_tenors, self.verbose)
+        self.assertEqual(list(f), list(g))
+
+    def test_handle_risk(self):
+        """ method to test the TDate bucketed and adjoint risk functions reconcile with the string ones """
+
+        value_date, effective_date = cds_parse_dates([self.value_date, self.effective_date])
+        discount_handle = cds_discount_curve_handle_tdate(value_date, self.swap_rates, self.swap_tenors,
+                                                          cds_parse_dates(self.swap_maturity_dates), self.verbose)
+        spread_handle = cds_spread_curve_handle_tdate(value_date, effective_date, self.recovery_rate,
+                                                      discount_handle, self.credit_spreads,
+                                                      cds_parse_dates(self.imm_dates), self.verbose)
+        try:
+            maturity_dates = ['20/12/2019', '20/06/2020', '20/12/2022']
+            n = len(maturity_dates)
+            trades = [[self.coupon] * n, [self.notional] * n, [0, 1, 0], spread_handle, self.verbose]
+
+            for string_form, tdate_form in [(cds_bucketed_dv01, cds_bucketed_dv01_tdate),
+                                            (cds_adjoint_risk, cds_adjoint_risk_tdate),
+                                            (cds_bucketed_cs01, cds_bucketed_cs01_tdate)]:
+                f = string_form(maturity_dates, [self.accrual_start_date] * n, *trades)
+                g = tdate_form(cds_parse_dates(maturity_dates), cds_parse_dates([self.accrual_start_date] * n),
+                               *trades)
+                # the last row is the wall time
+                self.assertGridEqual(f[:-1], g[:-1])
+
+            maturity_date, accrual_start_date = cds_parse_dates([self.maturity_date, self.accrual_start_date])
+            f = cds_scenario_roll_grid(self.value_date, self.effective_date, self.maturity_date,
+                                       self.accrual_start_date, self.recovery_rate, self.coupon, self.notional,
+                                       self.is_buy_protection, discount_handle, self.credit_spreads, self.imm_dates,
+                                       self.spread_roll_tenors, self.scenario_shifts, 2, self.verbose)
+            g = cds_scenario_roll_grid_tdate(value_date, effective_date, maturity_date, accrual_start_date,
+                                             self.recovery_rate, self.coupon, self.notional,
+                                             self.is_buy_protection, discount_handle, self.credit_spreads,
+                                             cds_parse_dates(self.imm_dates), self.spread_roll_tenors,
+                                             self.scenario_shifts, 2, self.verbose)
+            self.assertGridEqual(f[:3], g[:3])
+        finally:
+            cds_release_curve_handle(spread_handle)
+            cds_release_curve_handle(discount_handle)
+
+    def test_coupon_schedule(self):
+        """ method to test cds_coupon_schedule_tdate returns the same schedule on TDate payment dates """
+
+        f = cds_coupon_schedule(self.accrual_start_date, self.maturity_date, 'Q', 'Act/360', 'f/s', 'None',
+                                self.coupon, self.notional, self.verbose)
+        g = cds_coupon_schedule_tdate(cds_parse_dates([self.accrual_start_date])[0],
+                                      cds_parse_dates([self.maturity_date])[0], 'Q', 'Act/360', 'f/s', 'None',
+                                      self.coupon, self.notional, self.verbose)
+
+        self.assertEqual(1, g[0][0])
+        self.assertEqual(list(f[2]), list(g[2]))
+
+        # the string entry point keeps its DDMMYYYY numbers
+        ddmmyyyy = [int('%02d%02d%04d' % (d % 100, d // 100 % 100, d // 10000))
+                    for d in cds_dates_to_yyyymmdd([int(d) for d in g[1]])]
+        self.assertEqual(ddmmyyyy, [int(d) for d in f[1]])
+
+
+if __name__ == '__main__':
+    unittest.main()
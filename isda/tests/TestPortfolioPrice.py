@@ -0,0 +1,122 @@
+import unittest
+import datetime
+
+from isda.isda import cds_discount_curve_handle, cds_spread_curve_handle, cds_price_curve_handle, \
+    cds_release_curve_handle, cds_portfolio_price
+from isda.imm import imm_date_vector
+
+
+class MyTestCase(unittest.TestCase):
+    """
+        Testcase that prices a book of trades passed as columns in a single
+        call; each trade must reconcile with pricing it alone on its handle.
+
+    """
+
+    __name__ = "MyTestCase"
+
+    def setUp(self):
+
+        # available from markit swap feed
+        self.swap_rates = [-0.00369, -0.00340, -0.00329, -0.00271, -0.00219, -0.00187, -0.00149, 0.000040, 0.00159,
+                           0.00303, 0.00435, 0.00559, 0.00675, 0.00785, 0.00887]
+        self.swap_tenors = ['1M', '2M', '3M', '6M', '9M', '1Y', '2Y', '3Y', '4Y', '5Y', '6Y', '7Y', '8Y', '9Y', '10Y']
+        self.swap_maturity_dates = ['12/2/2018', '12/3/2018', '10/4/2018', '10/07/2018', '10/10/2018', '10/1/2019'
+            , '10/01/2020', '10/1/2021', '10/1/2022', '10/1/2023', '10/1/2024', '10/1/2025', '10/1/2026', '10/01/2027'
+            , '10/01/2028']
+
+        # spread curve download from markit
+        self.credit_spreads = [0.00137467867844589]*8
+        self.credit_spread_tenors = ['6M', '1Y', '2Y', '3Y', '4Y', '5Y', '7Y', '10Y']
+
+        # economics of trade
+        self.recovery_rate = 0.40000
+        self.coupon = 100.0
+        self.trade_date = '12/12/2014'
+        self.effective_date = '13/12/2014'
+        self.accrual_start_date = '20/9/2014'
+        self.maturity_date = '20/12/2019'
+        self.notional = 70.0
+        self.is_buy_protection = 1
+        self.verbose = 0
+
+        self.tenor_list = [0.5, 1, 2, 3, 4, 5, 7, 10]
+        self.sdate = datetime.datetime(2018, 1, 8)
+        self.value_date = self.sdate.strftime('%d/%m/%Y')
+        self.imm_dates = [f[1] for f in imm_date_vector(
+            start_date=self.sdate, tenor_list=self.tenor_list)]
+
+        self.discount_handle = cds_discount_curve_handle(self.value_date,
+                                                         self.swap_rates,
+                                                         self.swap_tenors,
+                                                         self.swap_maturity_dates,
+                                                         self.verbose)
+
+        self.spread_handle = cds_spread_curve_handle(self.value_date,
+                                                     self.effective_date,
+                                                     self.recovery_rate,
+                                                     self.discount_handle,
+                                                     self.credit_spreads,
+                                                     self.imm_dates,
+                                                     self.verbose)
+
+        # second credit with a wider curve on the same discount handle
+        self.wide_spread_handle = cds_spread_curve_handle(self.value_date,
+                                                          self.effective_date,
+                                                          self.recovery_rate,
+                                                          self.discount_handle,
+                                                          [0.0150]*8,
+                                                          self.imm_dates,
+                                                          self.verbose)
+
+    def tearDown(self):
+        cds_release_curve_handle(self.wide_spread_handle)
+        cds_release_curve_handle(self.spread_handle)
+        cds_release_curve_handle(self.discount_handle)
+
+    def test_portfolio(self):
+        """ method to test columnar book pricing reconciles trade by trade """
+
+        maturity_dates = ['20/12/2019', '20/06/2020', '20/12/2022', '20/12/2019', '20/12/2027']
+        accrual_start_dates = [self.accrual_start_date] * 5
+        coupons = [100.0, 100.0, 500.0, 500.0, 100.0]
+        notionals = [70.0, 10.0, 5.0, 1.0, 25.0]
+        directions = [1, 0, 1, 0, 1]
+        curve_indices = [0, 1, 1, 0, 1]
+        handles = [self.spread_handle, self.wide_spread_handle]
+
+        f = cds_portfolio_price(maturity_dates, accrual_start_dates, coupons, notionals, directions,
+                                curve_indices, handles, self.verbose)
+
+        pv_dirty, pv_clean, ai, cs01, dv01, status = f[0:6]
+
+        for t in range(len(maturity_dates)):
+            g = cds_price_curve_handle(maturity_dates[t],
+                                       accrual_start_dates[t],
+                                       coupons[t],
+                                       notionals[t],
+                                       directions[t],
+                                       handles[curve_indices[t]],
+                                       self.verbose)
+
+            self.assertEqual(1, status[t])
+            self.assertAlmostEqual(g[0], pv_dirty[t])
+            self.assertAlmostEqual(g[1], pv_clean[t])
+            self.assertAlmostEqual(g[2], ai[t])
+            self.assertAlmostEqual(g[3], cs01[t])
+            self.assertAlmostEqual(g[4], dv01[t])
+
+        self.assertAlmostEqual(-1.23099324435, pv_dirty[0])
+
+    def test_bad_curve_index(self):
+        """ method to test trades with an unknown curve are flagged and left at zero """
+
+        f = cds_portfolio_price([self.maturity_date] * 2, [self.accrual_start_date] * 2, [100.0] * 2,
+                                [1.0] * 2, [1, 1], [0, 2], [self.spread_handle], self.verbose)
+
+        self.assertEqual([1, -1], list(f[5]))
+        self.assertEqual(0.0, f[0][1])
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,83 @@
+import unittest
+import datetime
+
+from isda.isda import cds_all_in_one
+from isda.imm import imm_date_vector
+
+
+class MyTestCase(unittest.TestCase):
+    """
+        Testcase that checks the pvbp ladder of cds_all_in_one, one basis point
+        of the risky annuity per imm date, against repricing a trade to each imm
+        date with its coupon bumped by one basis point.
+
+    """
+
+    __name__ = "MyTestCase"
+
+    def setUp(self):
+
+        # available from markit swap feed
+        self.swap_rates = [-0.00369, -0.00340, -0.00329, -0.00271, -0.00219, -0.00187, -0.00149, 0.000040, 0.00159,
+                           0.00303, 0.00435, 0.00559, 0.00675, 0.00785, 0.00887]
+        self.swap_tenors = ['1M', '2M', '3M', '6M', '9M', '1Y', '2Y', '3Y', '4Y', '5Y', '6Y', '7Y', '8Y', '9Y', '10Y']
+        self.swap_maturity_dates = ['12/2/2018', '12/3/2018', '10/4/2018', '10/07/2018', '10/10/2018', '10/1/2019'
+            , '10/01/2020', '10/1/2021', '10/1/2022', '10/1/2023', '10/1/2024', '10/1/2025', '10/1/2026', '10/01/2027'
+            , '10/01/2028']
+
+        # upward sloping spread curve
+        self.credit_spreads = [0.0010, 0.0012, 0.0015, 0.0020, 0.0024, 0.0028, 0.0033, 0.0038]
+        self.credit_spread_tenors = ['6M', '1Y', '2Y', '3Y', '4Y', '5Y', '7Y', '10Y']
+
+        self.recovery_rate = 0.40000
+        self.trade_date = '12/12/2014'
+        self.effective_date = '13/12/2014'
+        self.verbose = 0
+
+        self.sdate = datetime.datetime(2018, 1, 8)
+        self.value_date = self.sdate.strftime('%d/%m/%Y')
+        self.imm_dates = [f[1] for f in imm_date_vector(
+            start_date=self.sdate, tenor_list=[0.5, 1, 2, 3, 4, 5, 7, 10])]
+
+    def all_in_one(self, maturity_date, coupon, is_buy_protection):
+        return cds_all_in_one(self.trade_date,
+                              self.effective_date,
+                              maturity_date,
+                              self.value_date,
+                              self.value_date,
+                              self.recovery_rate,
+                              coupon,
+                              1.0,
+                              is_buy_protection,
+                              self.swap_rates,
+                              self.swap_tenors,
+                              self.swap_maturity_dates,
+                              self.credit_spreads,
+                              self.credit_spread_tenors,
+                              [],
+                              self.imm_dates,
+                              [],
+                              self.verbose)
+
+    def test_reprice_coupon(self):
+        """ method to test each pvbp against a one basis point coupon bump to that imm date """
+
+        for is_buy_protection in [0, 1]:
+            pvbp = self.all_in_one(self.imm_dates[-1], 100.0, is_buy_protection)[1]
+            self.assertEqual(len(self.imm_dates), len(pvbp))
+
+            for r, imm_date in enumerate(self.imm_dates):
+                base = self.all_in_one(imm_date, 100.0, is_buy_protection)[0][0]
+                bumped = self.all_in_one(imm_date, 101.0, is_buy_protection)[0][0]
+                self.assertAlmostEqual(bumped - base, pvbp[r], places=12)
+
+    def test_ladder_increasing(self):
+        """ method to test longer imm dates carry more risky annuity """
+
+        pvbp = self.all_in_one(self.imm_dates[-1], 100.0, 0)[1]
+        for shorter, longer in zip(pvbp, pvbp[1:]):
+            self.assertGreater(longer, shorter)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,139 @@
+import ctypes
+import datetime
+import threading
+import unittest
+from concurrent.futures import ThreadPoolExecutor
+
+from isda.isda import cds_all_in_one, cds_index_all_in_one
+from isda.imm import imm_date_vector
+
+
+class MyTestCase(unittest.TestCase):
+    """
+        Testcase that drives the pricer from a pool of python threads; the
+        wrappers release the GIL while the C++ code runs, so the calls
+        overlap and every result must match the same call made serially.
+
+    """
+
+    __name__ = "MyTestCase"
+
+    def setUp(self):
+
+        # available from markit swap feed
+        self.swap_rates = [-0.00369, -0.00340, -0.00329, -0.00271, -0.00219, -0.00187, -0.00149, 0.000040, 0.00159,
+                           0.00303, 0.00435, 0.00559, 0.00675, 0.00785, 0.00887]
+        self.swap_tenors = ['1M', '2M', '3M', '6M', '9M', '1Y', '2Y', '3Y', '4Y', '5Y', '6Y', '7Y', '8Y', '9Y', '10Y']
+        self.swap_maturity_dates = ['12/2/2018', '12/3/2018', '10/4/2018', '10/07/2018', '10/10/2018', '10/1/2019'
+            , '10/01/2020', '10/1/2021', '10/1/2022', '10/1/2023', '10/1/2024', '10/1/2025', '10/1/2026', '10/01/2027'
+            , '10/01/2028']
+
+        # spread curve download from markit
+        self.credit_spreads = [0.84054, 0.58931, 0.40310, 0.33168, 0.30398, 0.28037, 0.25337, 0.23090]
+        self.credit_spread_tenors = ['6M', '1Y', '2Y', '3Y', '4Y', '5Y', '7Y', '10Y']
+
+        # economics of trade
+        self.recovery_rate = 0.40000
+        self.coupon = 100.0
+        self.trade_date = '12/12/2014'
+        self.effective_date = '13/12/2014'
+        self.accrual_start_date = '20/9/2014'
+        self.notional = 70.0
+        self.verbose = 0
+
+        # used to generate and shock roll dataset
+        self.spread_roll_tenors = ['1D', '-1D', '-1W', '-1M', '-6M', '-1Y', '-5Y']
+        self.scenario_shifts = [-50, -10, 0, 10, 20, 50, 150, 100]
+
+        self.value_date = datetime.datetime(2018, 1, 8).strftime('%d/%m/%Y')
+        self.imm_dates = [f[1] for f in imm_date_vector(
+            start_date=datetime.datetime(2018, 1, 8), tenor_list=[0.5, 1, 2, 3, 4, 5, 7, 10])]
+
+    def tearDown(self):
+        pass
+
+    def price_single_name(self, job):
+        maturity_date, is_buy_protection, spread_scale = job
+        return cds_all_in_one(self.trade_date, self.effective_date, maturity_date, self.value_date,
+                              self.accrual_start_date, self.recovery_rate, self.coupon, self.notional,
+                              is_buy_protection, self.swap_rates, self.swap_tenors, self.swap_maturity_dates,
+                              [s * spread_scale for s in self.credit_spreads], self.credit_spread_tenors,
+                              self.spread_roll_tenors, self.imm_dates, self.scenario_shifts, self.verbose)
+
+    def price_index(self, spread_scale):
+        return cds_index_all_in_one(self.trade_date, self.effective_date, '20/12/2022', self.value_date,
+                                    self.accrual_start_date, [self.recovery_rate] * 25, self.coupon, self.notional,
+                                    0, self.swap_rates, self.swap_tenors, self.swap_maturity_dates,
+                                    [[s * spread_scale * (1.0 + i / 25.0) for s in self.credit_spreads]
+                                     for i in range(25)],
+                                    self.credit_spread_tenors, [], self.imm_dates, [], self.verbose)
+
+    def test_thread_pool_single_name(self):
+        """ method to test concurrent cds_all_in_one calls match serial calls """
+
+        jobs = [(maturity_date, is_buy_protection, 0.5 + k / 8.0)
+                for k, maturity_date in enumerate(['20/12/2019', '20/06/2020', '20/12/2022', '20/12/2024'])
+                for is_buy_protection in [0, 1]]
+
+        serial = [self.price_single_name(job) for job in jobs]
+        with ThreadPoolExecutor(max_workers=4) as pool:
+            threaded = list(pool.map(self.price_single_name, jobs))
+
+        for f, g in zip(serial, threaded):
+            # the last entry of each row is the wall time
+            for row_f, row_g in zip(f, g):
+                self.assertEqual(list(row_f)[:-1], list(row_g)[:-1])
+
+    def test_thread_pool_index(self):
+        """ method to test concurrent cds_index_all_in_one calls match serial calls """
+
+        scales = [0.8, 0.9, 1.0, 1.1, 1.2, 1.3]
+
+        serial = [self.price_index(scale) for scale in scales]
+        with ThreadPoolExecutor(max_workers=3) as pool:
+            threaded = list(pool.map(self.price_index, scales))
+
+        for f, g in zip(serial, threaded):
+            self.assertEqual(list(f[0]), list(g[0]))
+            self.assertEqual(list(f[1][:3]), list(g[1][:3]))
+
+    @unittest.skipUnless(hasattr(ctypes.CDLL(None), 'mallinfo2'), 'needs glibc mallinfo2')
+    def test_thread_exit_frees_error_record(self):
+        """ method to test pool threads which enabled the error record release it when they exit """
+
+        class MallInfo(ctypes.Structure):
+            _fields_ = [(name, ctypes.c_size_t) for name in
+                        ['arena', 'ordblks', 'smblks', 'hblks', 'hblkhd', 'usmblks', 'fsmblks', 'uordblks',
+                         'fordblks', 'keepcost']]
+
+        mallinfo2 = ctypes.CDLL(None).mallinfo2
+        mallinfo2.restype = MallInfo
+
+        job = ('20/12/2019', 0, 1.0)
+        seen = threading.local()
+        threads = []
+
+        def price(job):
+            if not hasattr(seen, 'counted'):
+                seen.counted = True
+                threads.append(1)
+            return self.price_single_name(job)
+
+        def run_pools(number_of_pools):
+            for _ in range(number_of_pools):
+                with ThreadPoolExecutor(max_workers=4) as pool:
+                    list(pool.map(price, [job] * 4))
+
+        # warm up the caches which live for the whole process
+        run_pools(2)
+        threads.clear()
+        heap_in_use = mallinfo2().uordblks
+        run_pools(25)
+
+        # a record of 20 lines of 128 characters is about 2.8KB
+        growth = mallinfo2().uordblks - heap_in_use
+        self.assertLess(growth / len(threads), 1000)
+
+
+if __name__ == '__main__':
+    unittest.main()
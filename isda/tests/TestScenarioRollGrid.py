@@ -0,0 +1,128 @@
+import unittest
+import datetime
+
+from isda.isda import cds_all_in_one, cds_discount_curve_handle, cds_release_curve_handle, cds_scenario_roll_grid
+from isda.imm import imm_date_vector
+
+
+class MyTestCase(unittest.TestCase):
+    """
+        Testcase that prices the (scenario, roll date) grid in parallel against a
+        discount curve handle; every cell must reconcile with the roll rows of
+        cds_all_in_one, which bootstraps and prices the same grid serially.
+
+    """
+
+    __name__ = "MyTestCase"
+
+    def setUp(self):
+
+        # available from markit swap feed
+        self.swap_rates = [-0.00369, -0.00340, -0.00329, -0.00271, -0.00219, -0.00187, -0.00149, 0.000040, 0.00159,
+                           0.00303, 0.00435, 0.00559, 0.00675, 0.00785, 0.00887]
+        self.swap_tenors = ['1M', '2M', '3M', '6M', '9M', '1Y', '2Y', '3Y', '4Y', '5Y', '6Y', '7Y', '8Y', '9Y', '10Y']
+        self.swap_maturity_dates = ['12/2/2018', '12/3/2018', '10/4/2018', '10/07/2018', '10/10/2018', '10/1/2019'
+            , '10/01/2020', '10/1/2021', '10/1/2022', '10/1/2023', '10/1/2024', '10/1/2025', '10/1/2026', '10/01/2027'
+            , '10/01/2028']
+
+        # spread curve download from markit
+        self.credit_spreads = [0.00081, 0.0009, 0.00181, 0.00293, 0.00439, 0.00613, 0.00923, 0.01119]
+        self.credit_spread_tenors = ['6M', '1Y', '2Y', '3Y', '4Y', '5Y', '7Y', '10Y']
+
+        # economics of trade
+        self.recovery_rate = 0.40000
+        self.coupon = 100.0
+        self.trade_date = '12/12/2014'
+        self.effective_date = '13/12/2014'
+        self.accrual_start_date = '20/9/2014'
+        self.maturity_date = '20/12/2019'
+        self.notional = 2.0
+        self.is_buy_protection = 0
+        self.verbose = 0
+
+        self.sdate = datetime.datetime(2018, 1, 8)
+        self.value_date = self.sdate.strftime('%d/%m/%Y')
+        self.imm_dates = [f[1] for f in imm_date_vector(
+            start_date=self.sdate, tenor_list=[0.5, 1, 2, 3, 4, 5, 7, 10])]
+
+        # production sized grid
+        self.spread_roll_tenors = ['1Y', '1D', '-1D', '-1W', '-1M', '-6M', '-1Y']
+        self.scenario_shifts = [-30, -20, -10, 0, 10, 20, 30, 40]
+
+        self.discount_handle = cds_discount_curve_handle(self.value_date,
+                                                         self.swap_rates,
+                                                         self.swap_tenors,
+                                                         self.swap_maturity_dates,
+                                                         self.verbose)
+
+    def tearDown(self):
+        cds_release_curve_handle(self.discount_handle)
+
+    def grid(self, number_of_threads):
+        return cds_scenario_roll_grid(self.value_date,
+                                      self.effective_date,
+                                      self.maturity_date,
+                                      self.accrual_start_date,
+                                      self.recovery_rate,
+                                      self.coupon,
+                                      self.notional,
+                                      self.is_buy_protection,
+                                      self.discount_handle,
+                                      self.credit_spreads,
+                                      self.imm_dates,
+                                      self.spread_roll_tenors,
+                                      self.scenario_shifts,
+                                      number_of_threads,
+                                      self.verbose)
+
+    def test_reconcile_all_in_one(self):
+        """ method to test the dense grid against the serial roll rows of cds_all_in_one """
+
+        f = cds_all_in_one(self.trade_date,
+                           self.effective_date,
+                           self.maturity_date,
+                           self.value_date,
+                           self.accrual_start_date,
+                           self.recovery_rate,
+                           self.coupon,
+                           self.notional,
+                           self.is_buy_protection,
+                           self.swap_rates,
+                           self.swap_tenors,
+                           self.swap_maturity_dates,
+                           self.credit_spreads,
+                           self.credit_spread_tenors,
+                           self.spread_roll_tenors,
+                           self.imm_dates,
+                           self.scenario_shifts,
+                           self.verbose)
+
+        cube, shape, status = self.grid(4)[:3]
+
+        scenarios, rolls = len(self.scenario_shifts), len(self.spread_roll_tenors)
+        self.assertEqual([scenarios, rolls, 2], list(shape))
+        self.assertEqual([1.0] * scenarios, list(status))
+        self.assertEqual(scenarios * rolls * 2, len(cube))
+
+        for s in range(scenarios):
+            for r in range(rolls):
+                # all in one returns clean rows for every scenario, then dirty rows
+                self.assertAlmostEqual(f[3 + scenarios + s][r], cube[(s * rolls + r) * 2])
+                self.assertAlmostEqual(f[3 + s][r], cube[(s * rolls + r) * 2 + 1])
+
+    def test_threads_agree(self):
+        """ method to test the grid does not depend on the number of workers """
+
+        self.assertEqual(list(self.grid(1)[0]), list(self.grid(0)[0]))
+
+    def test_bad_handle(self):
+        """ method to test an unknown discount handle is reported through status """
+
+        handle, self.discount_handle = self.discount_handle, -1
+        status = self.grid(0)[2]
+        self.discount_handle = handle
+        self.assertEqual([-1] * len(self.scenario_shifts), list(status))
+
+
+if __name__ == '__main__':
+    unittest.main()
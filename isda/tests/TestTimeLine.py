@@ -0,0 +1,207 @@
+import ctypes
+import unittest
+
+from isda import isda
+from isda.isda import cds_yyyymmdd_to_dates
+
+JPMCDS_ACT_365F = 2
+SUCCESS = 0
+
+
+class TRatePt(ctypes.Structure):
+    _fields_ = [('fDate', ctypes.c_long), ('fRate', ctypes.c_double)]
+
+
+class TCurve(ctypes.Structure):
+    _fields_ = [('fNumItems', ctypes.c_int), ('fArray', ctypes.POINTER(TRatePt)), ('fBaseDate', ctypes.c_long),
+                ('fBasis', ctypes.c_double), ('fDayCountConv', ctypes.c_long)]
+
+
+class TDateList(ctypes.Structure):
+    _fields_ = [('fNumItems', ctypes.c_int), ('fArray', ctypes.POINTER(ctypes.c_long))]
+
+
+class TLegPVCache(ctypes.Structure):
+    _fields_ = [('fixedDate', ctypes.c_long), ('valid', ctypes.c_int), ('tl', ctypes.POINTER(TDateList)),
+                ('tlSize', ctypes.c_int), ('nbFixed', ctypes.c_int), ('pv', ctypes.c_double),
+                ('survival', ctypes.c_double), ('discount', ctypes.c_double)]
+
+
+class MyTestCase(unittest.TestCase):
+    """
+        Testcase that checks the risky timelines of the single pass merge
+        against the merge and truncate of date lists they used to be built
+        with, called directly from the extension library.
+
+    """
+
+    __name__ = "MyTestCase"
+
+    def setUp(self):
+
+        self.lib = ctypes.CDLL(isda._isda.__file__)
+        curve = ctypes.POINTER(TCurve)
+        date_list = ctypes.POINTER(TDateList)
+        self.lib.JpmcdsMakeTCurve.restype = curve
+        self.lib.JpmcdsMakeTCurve.argtypes = [ctypes.c_long, ctypes.POINTER(ctypes.c_long),
+                                              ctypes.POINTER(ctypes.c_double), ctypes.c_int, ctypes.c_double,
+                                              ctypes.c_long]
+        self.lib.JpmcdsFreeTCurve.argtypes = [curve]
+        self.lib.JpmcdsNewDateListFromDates.restype = date_list
+        self.lib.JpmcdsNewDateListFromDates.argtypes = [ctypes.POINTER(ctypes.c_long), ctypes.c_int]
+        self.lib.JpmcdsNewDateListFromTCurve.restype = date_list
+        self.lib.JpmcdsNewDateListFromTCurve.argtypes = [curve]
+        self.lib.JpmcdsDateListAddDates.restype = date_list
+        self.lib.JpmcdsDateListAddDates.argtypes = [date_list, ctypes.c_int, ctypes.POINTER(ctypes.c_long)]
+        self.lib.JpmcdsDateListAddDatesFreeOld.restype = date_list
+        self.lib.JpmcdsDateListAddDatesFreeOld.argtypes = [date_list, ctypes.c_int, ctypes.POINTER(ctypes.c_long)]
+        self.lib.JpmcdsDateListTruncate.restype = date_list
+        self.lib.JpmcdsDateListTruncate.argtypes = [date_list, ctypes.c_long, ctypes.c_int, ctypes.c_int,
+                                                    ctypes.c_int]
+        self.lib.JpmcdsFreeDateList.argtypes = [date_list]
+        self.lib.JpmcdsRiskyTimeLine.restype = date_list
+        self.lib.JpmcdsRiskyTimeLine.argtypes = [ctypes.c_long, ctypes.c_long, curve, curve]
+        self.lib.JpmcdsRiskyTimeLineDates.argtypes = [ctypes.c_long, ctypes.c_long, curve, curve,
+                                                      ctypes.POINTER(ctypes.c_long), ctypes.POINTER(ctypes.c_int)]
+        self.lib.JpmcdsTruncateTimeLine.restype = date_list
+        self.lib.JpmcdsTruncateTimeLine.argtypes = [date_list, ctypes.c_long, ctypes.c_long]
+        self.lib.JpmcdsLegPVCacheInit.argtypes = [ctypes.POINTER(TLegPVCache), ctypes.c_long]
+        self.lib.JpmcdsLegPVCacheReset.argtypes = [ctypes.POINTER(TLegPVCache), ctypes.c_long]
+        self.lib.JpmcdsLegPVCacheClear.argtypes = [ctypes.POINTER(TLegPVCache)]
+        self.lib.JpmcdsLegPVCacheTimeLine.restype = date_list
+        self.lib.JpmcdsLegPVCacheTimeLine.argtypes = [ctypes.POINTER(TLegPVCache), ctypes.c_long, ctypes.c_long,
+                                                      curve, curve]
+
+        self.today = cds_yyyymmdd_to_dates([20180108])[0]
+
+        # both curves share their 3M, 1Y and 5Y dates
+        self.discount_curve = self.make_curve([30, 90, 180, 365, 730, 1825])
+        self.spread_curve = self.make_curve([90, 182, 365, 1000, 1825])
+
+        # every curve date, the days either side of it and dates outside both curves
+        curve_dates = set(self.curve_dates(self.discount_curve) + self.curve_dates(self.spread_curve))
+        self.dates = sorted(set([self.today, self.today + 3000] + [d + k for d in curve_dates for k in [-1, 0, 1]]))
+
+    def make_curve(self, days):
+
+        dates = [self.today + d for d in days]
+        rates = [0.01 + 0.001 * i for i in range(len(days))]
+        curve = self.lib.JpmcdsMakeTCurve(self.today, (ctypes.c_long * len(days))(*dates),
+                                          (ctypes.c_double * len(days))(*rates), len(days), 1.0, JPMCDS_ACT_365F)
+        self.assertTrue(curve)
+        self.addCleanup(self.lib.JpmcdsFreeTCurve, curve)
+        return curve
+
+    @staticmethod
+    def curve_dates(curve):
+
+        return [curve.contents.fArray[i].fDate for i in range(curve.contents.fNumItems)]
+
+    def read_date_list(self, tl, free=True):
+
+        self.assertTrue(tl)
+        dates = [tl.contents.fArray[i] for i in range(tl.contents.fNumItems)]
+        if free:
+            self.lib.JpmcdsFreeDateList(tl)
+        return dates
+
+    def old_risky_timeline(self, start_date, end_date, discount_curve, spread_curve):
+        """ the merges and truncations JpmcdsRiskyTimeLine was made of """
+
+        spread_dates = self.curve_dates(spread_curve)
+        tl = self.lib.JpmcdsNewDateListFromTCurve(discount_curve)
+        tl = self.lib.JpmcdsDateListAddDatesFreeOld(tl, len(spread_dates),
+                                                    (ctypes.c_long * len(spread_dates))(*spread_dates))
+        tl = self.lib.JpmcdsDateListAddDatesFreeOld(tl, 1, ctypes.byref(ctypes.c_long(start_date)))
+        tl = self.lib.JpmcdsDateListAddDatesFreeOld(tl, 1, ctypes.byref(ctypes.c_long(end_date)))
+        tl = self.lib.JpmcdsDateListTruncate(tl, start_date, 1, 1, 1)
+        tl = self.lib.JpmcdsDateListTruncate(tl, end_date, 1, 0, 1)
+        return self.read_date_list(tl)
+
+    def old_truncate_timeline(self, critical_dates, start_date, end_date):
+        """ the merge and truncations JpmcdsTruncateTimeLine was made of """
+
+        tl = self.lib.JpmcdsDateListAddDates(critical_dates, 2, (ctypes.c_long * 2)(start_date, end_date))
+        tl = self.lib.JpmcdsDateListTruncate(tl, start_date, 1, 1, 1)
+        tl = self.lib.JpmcdsDateListTruncate(tl, end_date, 1, 0, 1)
+        return self.read_date_list(tl)
+
+    def risky_timeline_dates(self, start_date, end_date, discount_curve, spread_curve):
+
+        size = discount_curve.contents.fNumItems + spread_curve.contents.fNumItems + 2
+        dates = (ctypes.c_long * size)()
+        num_dates = ctypes.c_int()
+        status = self.lib.JpmcdsRiskyTimeLineDates(start_date, end_date, discount_curve, spread_curve, dates,
+                                                   ctypes.byref(num_dates))
+        self.assertEqual(SUCCESS, status)
+        return dates[:num_dates.value]
+
+    def date_ranges(self):
+
+        for start_date in self.dates:
+            for end_date in self.dates:
+                if end_date > start_date:
+                    yield start_date, end_date
+
+    def test_risky_timeline(self):
+        """ method to test the risky timeline with start and end dates on, next to and outside the curve dates """
+
+        curve_pairs = [(self.discount_curve, self.spread_curve), (self.spread_curve, self.discount_curve),
+                       (self.discount_curve, self.discount_curve), (self.discount_curve, self.make_curve([365]))]
+        for discount_curve, spread_curve in curve_pairs:
+            for start_date, end_date in self.date_ranges():
+                expected = self.old_risky_timeline(start_date, end_date, discount_curve, spread_curve)
+                self.assertEqual(expected, self.read_date_list(
+                    self.lib.JpmcdsRiskyTimeLine(start_date, end_date, discount_curve, spread_curve)))
+                self.assertEqual(expected, self.risky_timeline_dates(start_date, end_date, discount_curve,
+                                                                     spread_curve))
+
+    def test_truncate_timeline(self):
+        """ method to test the truncated timeline of critical dates, including none """
+
+        critical = self.curve_dates(self.discount_curve)
+        critical_dates = self.lib.JpmcdsNewDateListFromDates((ctypes.c_long * len(critical))(*critical),
+                                                             len(critical))
+        self.addCleanup(self.lib.JpmcdsFreeDateList, critical_dates)
+        for start_date, end_date in self.date_ranges():
+            for dates in [critical_dates, None]:
+                self.assertEqual(self.old_truncate_timeline(dates, start_date, end_date),
+                                 self.read_date_list(self.lib.JpmcdsTruncateTimeLine(dates, start_date, end_date)))
+
+    def test_leg_cache_timeline(self):
+        """ method to test the timeline of a leg cache is refilled in place after a reset """
+
+        cache = TLegPVCache()
+        self.lib.JpmcdsLegPVCacheInit(ctypes.byref(cache), 0)
+        self.addCleanup(self.lib.JpmcdsLegPVCacheClear, ctypes.byref(cache))
+
+        fill = self.lib.JpmcdsLegPVCacheTimeLine(ctypes.byref(cache), self.today, self.today + 400,
+                                                 self.discount_curve, self.spread_curve)
+        dates = ctypes.addressof(cache.tl.contents.fArray.contents)
+        self.assertEqual(self.old_risky_timeline(self.today, self.today + 400, self.discount_curve,
+                                                 self.spread_curve), self.read_date_list(fill, free=False))
+
+        # later calls keep the timeline, resets refill the same dates
+        again = self.lib.JpmcdsLegPVCacheTimeLine(ctypes.byref(cache), self.today + 1, self.today + 3000,
+                                                  self.discount_curve, self.spread_curve)
+        self.assertEqual(self.read_date_list(fill, free=False), self.read_date_list(again, free=False))
+        for start_date, end_date in self.date_ranges():
+            self.lib.JpmcdsLegPVCacheReset(ctypes.byref(cache), start_date)
+            tl = self.lib.JpmcdsLegPVCacheTimeLine(ctypes.byref(cache), start_date, end_date, self.discount_curve,
+                                                   self.spread_curve)
+            self.assertEqual(self.old_risky_timeline(start_date, end_date, self.discount_curve, self.spread_curve),
+                             self.read_date_list(tl, free=False))
+            self.assertEqual(dates, ctypes.addressof(cache.tl.contents.fArray.contents))
+
+        # curves with more dates need a larger allocation
+        longer_curve = self.make_curve([30, 60, 90, 120, 180, 270, 365, 730, 1095, 1825, 2555, 3650])
+        self.lib.JpmcdsLegPVCacheReset(ctypes.byref(cache), 0)
+        tl = self.lib.JpmcdsLegPVCacheTimeLine(ctypes.byref(cache), self.today, self.today + 3000,
+                                               self.discount_curve, longer_curve)
+        self.assertEqual(self.old_risky_timeline(self.today, self.today + 3000, self.discount_curve, longer_curve),
+                         self.read_date_list(tl, free=False))
+        self.assertEqual(cache.tlSize, longer_curve.contents.fNumItems + self.discount_curve.contents.fNumItems + 2)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,146 @@
+import os
+import unittest
+import uuid
+
+from isda.isda import compute_isda_upfront, calculate_spread_from_upfront_charge, \
+    compute_isda_upfront_vector, calculate_spread_from_upfront_charge_vector
+
+
+class MyTestCase(unittest.TestCase):
+    """
+        Testcase that converts many quotes against one discount curve in a
+        single call; results must reconcile with the one quote at a time
+        functions, whatever the number of worker threads.
+
+    """
+
+    __name__ = "MyTestCase"
+
+    def setUp(self):
+        # available from markit swap feed
+        self.is_rofr = 1
+        self.swap_rates = [0.032869, 0.035129, 0.037749, 0.04169, 0.04442, 0.043513, 0.041393, 0.039835, 0.038784,
+                           0.037992, 0.037292, 0.036762, 0.036352, 0.036092, 0.035742, 0.035332, 0.034192, 0.032562,
+                           0.031092]
+        self.swap_tenors = ['1M', '2M', '3M', '6M', '1Y', '2Y', '3Y', '4Y', '5Y', '6Y', '7Y', '8Y', '9Y', '10Y', '12Y',
+                            '15Y', '20Y', '25Y', '30Y']
+
+        self.swapFixedDayCountConvention = 'ACT/360'
+        self.swapFloatingDayCountConvention = 'ACT/360'
+        self.swapFixedPaymentFrequency = '1Y'
+        self.swapFloatingPaymentFrequency = '1Y'
+
+        self.trade_date = '10/10/2022'
+        self.settle_date = '13/10/2022'
+        self.accrual_start_date = '20/09/2022'
+        self.verbose = 0
+
+        # one quote per maturity, coupon, recovery and spread
+        self.maturity_dates = ['20/12/2023', '20/12/2025', '20/12/2027', '20/12/2029', '20/12/2032'] * 4
+        self.coupon_rates = [100.0] * 10 + [500.0] * 10
+        self.recovery_rates = [0.4, 0.25, 0.3, 0.4, 0.2] * 4
+        self.par_spreads = [s / 10000.0 for s in [35, 80, 120, 250, 410, 90, 520, 775, 1100, 60] * 2]
+
+        self.holiday_filename = f'{uuid.uuid4()}.dat'
+        with open(self.holiday_filename, mode='wt', encoding='utf-8') as holiday_file:
+            holiday_file.write('16010101\n20180320\n')
+
+    def tearDown(self):
+        os.remove(self.holiday_filename)
+
+    def curve_args(self):
+        return [self.swap_rates, self.swap_tenors, self.is_rofr, self.holiday_filename,
+                self.swapFloatingDayCountConvention, self.swapFixedDayCountConvention,
+                self.swapFixedPaymentFrequency, self.swapFloatingPaymentFrequency]
+
+    def test_upfront_vector(self):
+        """ method to test batch upfronts reconcile with compute_isda_upfront """
+
+        for number_of_threads in [1, 4]:
+            dirty, clean, ai, status, duration = compute_isda_upfront_vector(
+                self.trade_date, self.accrual_start_date, self.settle_date, self.maturity_dates,
+                self.coupon_rates, self.recovery_rates, self.par_spreads, *self.curve_args(),
+                number_of_threads, self.verbose)
+
+            for q in range(len(self.maturity_dates)):
+                f = compute_isda_upfront(self.trade_date, self.maturity_dates[q], self.accrual_start_date,
+                                         self.settle_date, self.recovery_rates[q], self.coupon_rates[q], 1.0, 0,
+                                         self.swap_rates, self.swap_tenors, self.par_spreads[q], self.is_rofr,
+                                         self.holiday_filename, self.swapFloatingDayCountConvention,
+                                         self.swapFixedDayCountConvention, self.swapFixedPaymentFrequency,
+                                         self.swapFloatingPaymentFrequency, self.verbose)
+                self.assertEqual(1, status[q])
+                self.assertEqual(f[0], dirty[q])
+                self.assertEqual(f[1], clean[q])
+                self.assertEqual(f[2], ai[q])
+
+    def test_round_trip_vector(self):
+        """ method to test batch spreads recover the quoted spreads and reconcile one quote at a time """
+
+        for is_upfront_clean in [0, 1]:
+            upfronts = compute_isda_upfront_vector(
+                self.trade_date, self.accrual_start_date, self.settle_date, self.maturity_dates,
+                self.coupon_rates, self.recovery_rates, self.par_spreads, *self.curve_args(),
+                0, self.verbose)[is_upfront_clean]
+
+            spreads, status, duration = calculate_spread_from_upfront_charge_vector(
+                self.trade_date, self.accrual_start_date, self.settle_date, self.maturity_dates,
+                self.coupon_rates, self.recovery_rates, upfronts, [], is_upfront_clean, *self.curve_args(),
+                0, self.verbose)
+
+            for q in range(len(self.maturity_dates)):
+                g = calculate_spread_from_upfront_charge(self.trade_date, self.maturity_dates[q],
+                                                         self.accrual_start_date, self.settle_date,
+                                                         self.recovery_rates[q], self.coupon_rates[q], 1.0, 0,
+                                                         self.swap_rates, self.swap_tenors, upfronts[q],
+                                                         self.is_rofr, is_upfront_clean, self.holiday_filename,
+                                                         self.swapFloatingDayCountConvention,
+                                                         self.swapFixedDayCountConvention,
+                                                         self.swapFixedPaymentFrequency,
+                                                         self.swapFloatingPaymentFrequency, self.verbose)
+                self.assertEqual(1, status[q])
+                self.assertEqual(g[0], spreads[q])
+                self.assertAlmostEqual(self.par_spreads[q] * 10000., spreads[q] * 10000.)
+
+    def test_spread_guesses(self):
+        """ method to test warm starts converge to the spreads solved from the coupons """
+
+        upfronts = compute_isda_upfront_vector(
+            self.trade_date, self.accrual_start_date, self.settle_date, self.maturity_dates,
+            self.coupon_rates, self.recovery_rates, self.par_spreads, *self.curve_args(),
+            0, self.verbose)[0]
+
+        cold = calculate_spread_from_upfront_charge_vector(
+            self.trade_date, self.accrual_start_date, self.settle_date, self.maturity_dates,
+            self.coupon_rates, self.recovery_rates, upfronts, [], 0, *self.curve_args(),
+            0, self.verbose)
+
+        # close guesses as from a previous solve, and guesses far enough off
+        # that the newton steps leave the bounds and brent finishes the solve
+        for guesses in [[s * 1.05 for s in self.par_spreads], [0.9] * len(self.par_spreads)]:
+            spreads, status, duration = calculate_spread_from_upfront_charge_vector(
+                self.trade_date, self.accrual_start_date, self.settle_date, self.maturity_dates,
+                self.coupon_rates, self.recovery_rates, upfronts, guesses, 0, *self.curve_args(),
+                0, self.verbose)
+            self.assertEqual([1] * len(self.maturity_dates), list(status))
+            for q in range(len(self.maturity_dates)):
+                self.assertAlmostEqual(cold[0][q], spreads[q], delta=1e-12)
+
+        spreads, status, duration = calculate_spread_from_upfront_charge_vector(
+            self.trade_date, self.accrual_start_date, self.settle_date, self.maturity_dates,
+            self.coupon_rates, self.recovery_rates, upfronts, self.par_spreads[:-1], 0, *self.curve_args(),
+            0, self.verbose)
+        self.assertEqual([-1] * len(self.maturity_dates), list(status))
+
+    def test_bad_columns(self):
+        """ method to test mismatched quote columns are reported through status """
+
+        dirty, clean, ai, status, duration = compute_isda_upfront_vector(
+            self.trade_date, self.accrual_start_date, self.settle_date, self.maturity_dates,
+            self.coupon_rates[:-1], self.recovery_rates, self.par_spreads, *self.curve_args(),
+            0, self.verbose)
+        self.assertEqual([-1] * len(self.maturity_dates), list(status))
+
+
+if __name__ == '__main__':
+    unittest.main()
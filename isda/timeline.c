@@ -16,6 +16,54 @@
 #include "tcurve.h"
 
 
+/*
+***************************************************************************
+** Returns the index of the first date in a curve strictly after a date.
+***************************************************************************
+*/
+static int curveDatesAfter
+(TCurve *curve,
+ TDate   date)
+{
+    int lo = 0;
+    int hi = curve->fNumItems;
+
+    while (lo < hi)
+    {
+        int mid = (lo + hi) / 2;
+        if (curve->fArray[mid].fDate <= date)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+
+/*
+***************************************************************************
+** Returns the index of the first date in a date list strictly after a date.
+***************************************************************************
+*/
+static int datesAfter
+(TDateList *dl,
+ TDate      date)
+{
+    int lo = 0;
+    int hi = dl->fNumItems;
+
+    while (lo < hi)
+    {
+        int mid = (lo + hi) / 2;
+        if (dl->fArray[mid] <= date)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+
 /*
 ***************************************************************************
 ** Returns a timeline for use with risky integrations assuming flat
@@ -39,38 +87,151 @@ TDateList* JpmcdsRiskyTimeLine
     static char routine[] = "JpmcdsRiskyTimeLine";
 
     TDateList *tl  = NULL;
-    TDate     *dates = NULL;
 
     REQUIRE (discCurve != NULL);
     REQUIRE (spreadCurve != NULL);
     REQUIRE (endDate > startDate);
-    REQUIRE (spreadCurve != NULL);
 
-    /*
-    ** Timeline is points on the spreadCurve between startDate and endDate,
-    ** plus the startDate and endDate, plus the critical dates.
-    */
-    tl = JpmcdsNewDateListFromTCurve(discCurve);
-    if (tl == NULL) goto done;
-
-    dates = JpmcdsDatesFromCurve(spreadCurve);
-    tl = JpmcdsDateListAddDatesFreeOld(tl, spreadCurve->fNumItems, dates);
-    if (tl == NULL) goto done;
-    tl = JpmcdsDateListAddDatesFreeOld(tl, 1, &startDate);
-    if (tl == NULL) goto done;
-    tl = JpmcdsDateListAddDatesFreeOld(tl, 1, &endDate);
-    if (tl == NULL) goto done;
-
-    /* remove dates strictly before startDate and strictly after endDate */
-    tl = JpmcdsDateListTruncate(tl, startDate, TRUE, TRUE, TRUE);
-    tl = JpmcdsDateListTruncate(tl, endDate, TRUE, FALSE, TRUE);
-    
+    tl = JpmcdsNewEmptyDateList (JPMCDS_RISKY_TIMELINE_SIZE(discCurve, spreadCurve));
+    if (tl == NULL)
+        goto done;
+
+    if (JpmcdsRiskyTimeLineDates (startDate,
+                                  endDate,
+                                  discCurve,
+                                  spreadCurve,
+                                  tl->fArray,
+                                  &tl->fNumItems) != SUCCESS)
+    {
+        JpmcdsFreeDateList (tl);
+        tl = NULL;
+    }
+
  done:
 
     if (tl == NULL)
         JpmcdsErrMsgFailure(routine);
 
-    FREE (dates);
+    return tl;
+}
+
+
+/*
+***************************************************************************
+** Writes the timeline of JpmcdsRiskyTimeLine into a buffer.
+**
+** The curve dates strictly between startDate and endDate are found by
+** binary search and merged in a single pass, dropping dates which are in
+** both curves.
+***************************************************************************
+*/
+int JpmcdsRiskyTimeLineDates
+(TDate             startDate,
+ TDate             endDate,
+ TCurve           *discCurve,
+ TCurve           *spreadCurve,
+ TDate            *dates,
+ int              *numDates)
+{
+    static char routine[] = "JpmcdsRiskyTimeLineDates";
+    int         status    = FAILURE;
+
+    int i;
+    int iEnd;
+    int j;
+    int jEnd;
+    int k = 0;
+
+    REQUIRE (discCurve != NULL);
+    REQUIRE (spreadCurve != NULL);
+    REQUIRE (endDate > startDate);
+    REQUIRE (dates != NULL);
+    REQUIRE (numDates != NULL);
+
+    i    = curveDatesAfter (discCurve, startDate);
+    iEnd = curveDatesAfter (discCurve, endDate - 1);
+    j    = curveDatesAfter (spreadCurve, startDate);
+    jEnd = curveDatesAfter (spreadCurve, endDate - 1);
+
+    dates[k++] = startDate;
+    while (i < iEnd || j < jEnd)
+    {
+        TDate next;
+
+        if (j == jEnd || (i < iEnd && discCurve->fArray[i].fDate <= spreadCurve->fArray[j].fDate))
+            next = discCurve->fArray[i++].fDate;
+        else
+            next = spreadCurve->fArray[j++].fDate;
+
+        if (next > dates[k-1])
+            dates[k++] = next;
+    }
+    dates[k++] = endDate;
+
+    *numDates = k;
+    status    = SUCCESS;
+
+ done:
+
+    if (status != SUCCESS)
+        JpmcdsErrMsgFailure(routine);
+
+    return status;
+}
+
+
+/*
+***************************************************************************
+** Returns the timeline of a cached leg, which is owned by the cache.
+***************************************************************************
+*/
+TDateList* JpmcdsLegPVCacheTimeLine
+(TLegPVCache      *cache,
+ TDate             startDate,
+ TDate             endDate,
+ TCurve           *discCurve,
+ TCurve           *spreadCurve)
+{
+    static char routine[] = "JpmcdsLegPVCacheTimeLine";
+
+    TDateList *tl = NULL;
+    int        size;
+
+    REQUIRE (cache != NULL);
+    REQUIRE (discCurve != NULL);
+    REQUIRE (spreadCurve != NULL);
+
+    /* a filled timeline has at least startDate and endDate */
+    if (cache->tl != NULL && cache->tl->fNumItems > 0)
+        return cache->tl;
+
+    size = JPMCDS_RISKY_TIMELINE_SIZE(discCurve, spreadCurve);
+    if (cache->tl == NULL || cache->tlSize < size)
+    {
+        JpmcdsFreeDateList (cache->tl);
+        cache->tlSize = 0;
+        cache->tl = JpmcdsNewEmptyDateList (size);
+        if (cache->tl == NULL)
+            goto done;
+        cache->tlSize = size;
+    }
+
+    if (JpmcdsRiskyTimeLineDates (startDate,
+                                  endDate,
+                                  discCurve,
+                                  spreadCurve,
+                                  cache->tl->fArray,
+                                  &cache->tl->fNumItems) != SUCCESS)
+    {
+        cache->tl->fNumItems = 0;
+        goto done;
+    }
+    tl = cache->tl;
+
+ done:
+
+    if (tl == NULL)
+        JpmcdsErrMsgFailure(routine);
 
     return tl;
 }
@@ -96,20 +257,26 @@ TDateList* JpmcdsTruncateTimeLine
     static char routine[] = "JpmcdsTruncateTimeLine";
     
     TDateList *tl = NULL;
-    TDate      startEndDate[2];
+    int        first = 0;
+    int        last  = 0;
 
     REQUIRE (endDate > startDate);
 
-    startEndDate[0] = startDate;
-    startEndDate[1] = endDate;
+    /* critical dates strictly between startDate and endDate */
+    if (criticalDates != NULL)
+    {
+        first = datesAfter (criticalDates, startDate);
+        last  = datesAfter (criticalDates, endDate - 1);
+    }
 
-    tl = JpmcdsDateListAddDates (criticalDates, 2, startEndDate);
+    tl = JpmcdsNewEmptyDateList (last - first + 2);
     if (tl == NULL)
         goto done;
 
-    /* remove dates strictly before startDate and strictly after endDate */
-    tl = JpmcdsDateListTruncate (tl, startDate, TRUE, TRUE, TRUE);
-    tl = JpmcdsDateListTruncate (tl, endDate, TRUE, FALSE, TRUE);
+    tl->fArray[0] = startDate;
+    if (last > first)
+        COPY_ARRAY (tl->fArray + 1, criticalDates->fArray + first, TDate, last - first);
+    tl->fArray[last - first + 1] = endDate;
     
  done:
 
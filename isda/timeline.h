@@ -39,6 +39,44 @@ TDateList* JpmcdsRiskyTimeLine
  TCurve           *riskyCurve);
 
 
+/*
+** Number of dates a buffer needs for JpmcdsRiskyTimeLineDates.
+*/
+#define JPMCDS_RISKY_TIMELINE_SIZE(discCurve, riskyCurve) \
+    ((discCurve)->fNumItems + (riskyCurve)->fNumItems + 2)
+
+/*f
+***************************************************************************
+** Writes the timeline of JpmcdsRiskyTimeLine into a caller provided buffer
+** of at least JPMCDS_RISKY_TIMELINE_SIZE dates, without allocating.
+***************************************************************************
+*/
+int JpmcdsRiskyTimeLineDates
+(TDate             startDate,
+ TDate             endDate,
+ TCurve           *discCurve,
+ TCurve           *riskyCurve,
+ TDate            *dates,      /* (O) Timeline */
+ int              *numDates);  /* (O) Number of dates in the timeline */
+
+
+/*f
+***************************************************************************
+** Returns the timeline of a cached leg, which is owned by the cache.
+**
+** The first call after JpmcdsLegPVCacheInit or JpmcdsLegPVCacheReset
+** fills it with JpmcdsRiskyTimeLineDates, reusing the dates allocated for
+** an earlier leg when there are enough. Later calls return it unchanged.
+***************************************************************************
+*/
+TDateList* JpmcdsLegPVCacheTimeLine
+(TLegPVCache      *cache,
+ TDate             startDate,
+ TDate             endDate,
+ TCurve           *discCurve,
+ TCurve           *riskyCurve);
+
+
 /*f
 ***************************************************************************
 ** Truncate timeline.